@@ -0,0 +1,446 @@
+// throughput benchmarks for the public API on generated corpora. Prints GB/s (of utf8 bytes) and
+// millions of codepoints per second for every function and corpus. Pass a string as the first
+// argument to only run the benchmarks whose name or corpus contains it.
+
+#include <utf8er/utf8er.hpp>
+#include <utf8er/utf8er_parallel.hpp>
+#include <utf8er/utf8er_unicode.hpp>
+
+#if defined(UTF8ER_BENCH_UTFCPP)
+#include <utf8cpp/utf8.h>
+#endif
+
+#if defined(UTF8ER_BENCH_UTF8H)
+#include <utf8.h>
+#endif
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+
+struct corpus
+{
+    const char * name;
+    std::string bytes;
+    std::vector<uint32_t> codepoints;
+    bool valid;
+};
+
+// every corpus is generated from a weighted list of codepoint ranges.
+struct cp_range
+{
+    uint32_t first;
+    uint32_t last;
+    uint32_t weight;
+};
+
+static const size_t corpus_size = 1 << 22;
+
+// keeps the optimizer from removing the benchmarked calls.
+static volatile size_t g_sink;
+
+corpus make_corpus(const char * _name, std::initializer_list<cp_range> _ranges, uint32_t _seed)
+{
+    std::mt19937 rng(_seed);
+    uint32_t total_weight = 0;
+    for (const cp_range & r : _ranges)
+        total_weight += r.weight;
+
+    corpus c;
+    c.name = _name;
+    c.valid = true;
+    while (c.bytes.size() < corpus_size)
+    {
+        uint32_t pick = rng() % total_weight;
+        for (const cp_range & r : _ranges)
+        {
+            if (pick < r.weight)
+            {
+                uint32_t cp = r.first + rng() % (r.last - r.first + 1);
+                utf8er::append(cp, c.bytes);
+                c.codepoints.push_back(cp);
+                break;
+            }
+            pick -= r.weight;
+        }
+    }
+    return c;
+}
+
+// valid looking text with an invalid byte every few dozen bytes that hits all error kinds.
+corpus make_invalid_corpus(const corpus & _mixed)
+{
+    static const uint8_t bad_bytes[] = { 0x80, 0xBF, 0xC0, 0xC1, 0xE0,
+                                         0xED, 0xF0, 0xF4, 0xF5, 0xFF };
+    std::mt19937 rng(7);
+    corpus c;
+    c.name = "invalid";
+    c.valid = false;
+    c.bytes = _mixed.bytes;
+    // only used to report codepoints per second, which is roughly the same.
+    c.codepoints = _mixed.codepoints;
+    for (size_t i = rng() % 64; i < c.bytes.size(); i += 1 + rng() % 64)
+        c.bytes[i] = static_cast<char>(bad_bytes[rng() % sizeof(bad_bytes)]);
+    return c;
+}
+
+std::vector<corpus> make_corpora()
+{
+    std::vector<corpus> result;
+    result.push_back(make_corpus("ascii", { { 0x20, 0x7E, 30 }, { 0x0A, 0x0A, 1 } }, 1));
+    result.push_back(make_corpus("latin1", { { 0x20, 0x7E, 7 }, { 0xA0, 0xFF, 3 } }, 2));
+    result.push_back(make_corpus("cyrillic", { { 0x0400, 0x04FF, 6 }, { 0x20, 0x20, 1 } }, 3));
+    result.push_back(make_corpus("cjk", { { 0x4E00, 0x9FFF, 9 }, { 0x3000, 0x303F, 1 } }, 4));
+    result.push_back(
+        make_corpus("emoji", { { 0x1F300, 0x1FAFF, 1 }, { 0x20, 0x7E, 2 }, { 0x200D, 0x200D, 1 } },
+                    5));
+    result.push_back(make_corpus("mixed",
+                                 { { 0x20, 0x7E, 4 },
+                                   { 0xA0, 0x7FF, 2 },
+                                   { 0x800, 0xD7FF, 2 },
+                                   { 0xE000, 0xFFFD, 1 },
+                                   { 0x10000, 0x10FFFF, 1 } },
+                                 6));
+    result.push_back(make_invalid_corpus(result.back()));
+    return result;
+}
+
+// runs _fn until at least 0.25 seconds passed and prints the best run.
+template <class F>
+void run(const char * _filter, const char * _name, const corpus & _corpus, F _fn)
+{
+    if (_filter && !std::strstr(_name, _filter) && !std::strstr(_corpus.name, _filter))
+        return;
+
+    using clock = std::chrono::steady_clock;
+    double best = 1e9;
+    clock::time_point start = clock::now();
+    do
+    {
+        clock::time_point t = clock::now();
+        g_sink = _fn();
+        best = std::min(best, std::chrono::duration<double>(clock::now() - t).count());
+    } while (std::chrono::duration<double>(clock::now() - start).count() < 0.25);
+
+    std::printf("%-36s %-10s %8.2f GB/s %10.1f Mcp/s\n",
+                _name,
+                _corpus.name,
+                _corpus.bytes.size() / best / 1e9,
+                _corpus.codepoints.size() / best / 1e6);
+}
+
+// calls _fn on the input following every error, so that invalid input is processed as a whole.
+template <class F>
+size_t resume_after_errors(const char * _begin, const char * _end, F _fn)
+{
+    size_t errors = 0;
+    while (_begin != _end)
+    {
+        const char * stop = _fn(_begin, _end);
+        if (stop == _end)
+            break;
+        ++errors;
+        _begin = stop + 1;
+    }
+    return errors;
+}
+
+void run_utf8er(const char * _filter, const corpus & _c)
+{
+    const char * begin = _c.bytes.data();
+    const char * end = begin + _c.bytes.size();
+    const uint32_t * cp_begin = _c.codepoints.data();
+    const uint32_t * cp_end = cp_begin + _c.codepoints.size();
+    std::vector<uint32_t> utf32(_c.bytes.size());
+    std::vector<char> utf8(_c.codepoints.size() * 4);
+    std::string str;
+
+    run(_filter, "validate", _c, [&]() {
+        return resume_after_errors(begin, end, [](const char * _b, const char * _e) {
+            auto res = utf8er::validate(_b, _e);
+            return res.first ? res.second : _e;
+        });
+    });
+    run(_filter, "validate_parallel", _c, [&]() {
+        return resume_after_errors(begin, end, [](const char * _b, const char * _e) {
+            auto res = utf8er::validate_parallel(_b, static_cast<size_t>(_e - _b));
+            return res.first ? res.second : _e;
+        });
+    });
+    run(_filter, "transcode_to_utf32", _c, [&]() {
+        return resume_after_errors(begin, end, [&](const char * _b, const char * _e) {
+            auto res = utf8er::transcode_to_utf32(_b, static_cast<size_t>(_e - _b), utf32.data());
+            return _b + res.consumed;
+        });
+    });
+    run(_filter, "decode_range_safe", _c, [&]() {
+        return resume_after_errors(begin, end, [&](const char * _b, const char * _e) {
+            utf8er::error_report err;
+            uint32_t * out = utf8er::decode_range_safe(_b, _e, utf32.data(), err);
+            // the error position is not reported, find it like a caller would have to.
+            return err ? _b + utf8er::utf8_length(utf32.data(), out) : _e;
+        });
+    });
+    run(_filter, "decode_range_lossy", _c, [&]() {
+        return static_cast<size_t>(utf8er::decode_range_lossy(begin, end, utf32.data()) -
+                                   utf32.data());
+    });
+    std::vector<char> sanitized(_c.bytes.size() * 3);
+    run(_filter, "sanitize", _c, [&]() {
+        return static_cast<size_t>(utf8er::sanitize(begin, end, sanitized.data()) -
+                                   sanitized.data());
+    });
+
+    // the remaining functions expect valid input.
+    if (!_c.valid)
+        return;
+
+    run(_filter, "decode_range", _c, [&]() {
+        return static_cast<size_t>(utf8er::decode_range(begin, end, utf32.data()) - utf32.data());
+    });
+    run(_filter, "decode_range (back_inserter)", _c, [&]() {
+        std::vector<uint32_t> out;
+        utf8er::decode_range(begin, end, std::back_inserter(out));
+        return out.size();
+    });
+    run(_filter, "transcode_to_utf32_parallel", _c, [&]() {
+        return utf8er::transcode_to_utf32_parallel(begin, _c.bytes.size(), utf32.data()).produced;
+    });
+    run(_filter, "transcode_to_utf32 (4096 capacity)", _c, [&]() {
+        size_t produced = 0;
+        for (size_t consumed = 0; consumed < _c.bytes.size();)
+        {
+            auto res = utf8er::transcode_to_utf32(
+                begin + consumed, _c.bytes.size() - consumed, utf32.data(), 4096);
+            consumed += res.consumed;
+            produced += res.produced;
+        }
+        return produced;
+    });
+    run(_filter, "codepoint_array", _c, [&]() {
+        utf8er::error_report err;
+        return utf8er::codepoint_array(begin, end, err).size();
+    });
+    utf8er::error_report array_err;
+    utf8er::codepoint_array array(begin, end, array_err);
+    run(_filter, "codepoint_array encode", _c, [&]() {
+        return static_cast<size_t>(array.encode(utf8.data()) - utf8.data());
+    });
+    run(_filter, "encode_range", _c, [&]() {
+        return static_cast<size_t>(utf8er::encode_range(cp_begin, cp_end, utf8.data()) -
+                                   utf8.data());
+    });
+    run(_filter, "encode_range_safe", _c, [&]() {
+        utf8er::error_report err;
+        return static_cast<size_t>(
+            utf8er::encode_range_safe(cp_begin, cp_end, utf8.data(), err) - utf8.data());
+    });
+    run(_filter, "transcode_to_utf8", _c, [&]() {
+        return utf8er::transcode_to_utf8(cp_begin, _c.codepoints.size(), utf8.data()).produced;
+    });
+    std::vector<uint16_t> utf16(utf8er::utf8_to_utf16_length(begin, _c.bytes.size()));
+    std::vector<uint16_t> utf16_be(utf16.size());
+    utf8er::utf8_to_utf16(begin, _c.bytes.size(), utf16.data());
+    utf8er::utf8_to_utf16(begin, _c.bytes.size(), utf16_be.data(), utf8er::byte_order::big_endian);
+    run(_filter, "transcode_to_utf8 (4096 capacity)", _c, [&]() {
+        size_t produced = 0;
+        for (size_t consumed = 0; consumed < _c.codepoints.size();)
+        {
+            auto res = utf8er::transcode_to_utf8(
+                cp_begin + consumed, _c.codepoints.size() - consumed, utf8.data(), 4096);
+            consumed += res.consumed;
+            produced += res.produced;
+        }
+        return produced;
+    });
+    run(_filter, "utf8_to_utf16", _c, [&]() {
+        return utf8er::utf8_to_utf16(begin, _c.bytes.size(), utf16.data()).produced;
+    });
+    run(_filter, "utf16_to_utf8", _c, [&]() {
+        return utf8er::utf16_to_utf8(utf16.data(), utf16.size(), utf8.data()).produced;
+    });
+    run(_filter, "utf16_to_utf8 (big endian)", _c, [&]() {
+        return utf8er::utf16_to_utf8(
+                   utf16_be.data(), utf16_be.size(), utf8.data(), utf8er::byte_order::big_endian)
+            .produced;
+    });
+    if (std::all_of(cp_begin, cp_end, [](uint32_t _cp) { return _cp < 0x100; }))
+    {
+        std::string latin1;
+        for (const uint32_t * it = cp_begin; it != cp_end; ++it)
+            latin1.push_back(static_cast<char>(*it));
+        run(_filter, "latin1_to_utf8", _c, [&]() {
+            return utf8er::latin1_to_utf8(latin1.data(), latin1.size(), utf8.data());
+        });
+        run(_filter, "utf8_to_latin1", _c, [&]() {
+            return utf8er::utf8_to_latin1(begin, _c.bytes.size(), &latin1[0]).produced;
+        });
+    }
+    std::string normalized;
+    run(_filter, "normalize nfc", _c, [&]() {
+        utf8er::error_report err;
+        auto res = utf8er::normalize(begin, end, utf8er::normalization_form::nfc, normalized, err);
+        return static_cast<size_t>(res.second - res.first);
+    });
+    run(_filter, "normalize nfd", _c, [&]() {
+        utf8er::error_report err;
+        auto res = utf8er::normalize(begin, end, utf8er::normalization_form::nfd, normalized, err);
+        return static_cast<size_t>(res.second - res.first);
+    });
+    std::string cased(_c.bytes.size() * 3, '\0');
+    run(_filter, "to_lower", _c, [&]() {
+        utf8er::error_report err;
+        return static_cast<size_t>(utf8er::to_lower(begin, end, &cased[0], err) - cased.data());
+    });
+    run(_filter, "fold_case", _c, [&]() {
+        utf8er::error_report err;
+        return static_cast<size_t>(utf8er::fold_case(begin, end, &cased[0], err) - cased.data());
+    });
+    run(_filter, "count_graphemes", _c, [&]() { return utf8er::count_graphemes(begin, end); });
+    run(_filter, "next_grapheme loop", _c, [&]() {
+        size_t n = 0;
+        for (const char * it = begin; it != end; ++n)
+            it = utf8er::next_grapheme(it, end);
+        return n;
+    });
+    run(_filter, "append_range", _c, [&]() {
+        str.clear();
+        utf8er::append_range(cp_begin, cp_end, str);
+        return str.size();
+    });
+    run(_filter, "append_range_safe", _c, [&]() {
+        str.clear();
+        utf8er::error_report err;
+        utf8er::append_range_safe(cp_begin, cp_end, str, err);
+        return str.size();
+    });
+    run(_filter, "count", _c, [&]() { return utf8er::count(begin); });
+    run(_filter, "distance", _c, [&]() {
+        return static_cast<size_t>(utf8er::distance(begin, end));
+    });
+    run(_filter, "codepoint_index build", _c, [&]() {
+        return utf8er::codepoint_index(begin, end).size();
+    });
+    run(_filter, "next loop", _c, [&]() {
+        size_t n = 0;
+        for (const char * it = begin; it != end; it = utf8er::next(it))
+            ++n;
+        return n;
+    });
+    run(_filter, "previous loop", _c, [&]() {
+        size_t n = 0;
+        for (const char * it = end; it != begin; it = utf8er::previous(it))
+            ++n;
+        return n;
+    });
+    run(_filter, "decode_and_next loop", _c, [&]() {
+        size_t sum = 0;
+        uint32_t cp;
+        for (const char * it = begin; it != end;)
+        {
+            it = utf8er::decode_and_next(it, cp);
+            sum += cp;
+        }
+        return sum;
+    });
+    run(_filter, "codepoint_range loop", _c, [&]() {
+        size_t sum = 0;
+        for (uint32_t cp : utf8er::codepoint_range(begin, end))
+            sum += cp;
+        return sum;
+    });
+    run(_filter, "decode_and_next_safe loop", _c, [&]() {
+        size_t sum = 0;
+        uint32_t cp;
+        utf8er::error_report err;
+        for (const char * it = begin; it != end && !err;)
+        {
+            it = utf8er::decode_and_next_safe(it, end, cp, err);
+            sum += cp;
+        }
+        return sum;
+    });
+}
+
+#if defined(UTF8ER_BENCH_UTFCPP)
+void run_utfcpp(const char * _filter, const corpus & _c)
+{
+    const char * begin = _c.bytes.data();
+    const char * end = begin + _c.bytes.size();
+    std::vector<uint32_t> utf32(_c.bytes.size());
+    std::vector<char> utf8(_c.codepoints.size() * 4);
+
+    run(_filter, "utfcpp find_invalid", _c, [&]() {
+        return resume_after_errors(begin, end, [](const char * _b, const char * _e) {
+            return utf8::find_invalid(_b, _e);
+        });
+    });
+    if (!_c.valid)
+        return;
+    run(_filter, "utfcpp utf8to32", _c, [&]() {
+        return static_cast<size_t>(utf8::utf8to32(begin, end, utf32.data()) - utf32.data());
+    });
+    run(_filter, "utfcpp unchecked::utf8to32", _c, [&]() {
+        return static_cast<size_t>(utf8::unchecked::utf8to32(begin, end, utf32.data()) -
+                                   utf32.data());
+    });
+    run(_filter, "utfcpp utf32to8", _c, [&]() {
+        return static_cast<size_t>(
+            utf8::utf32to8(_c.codepoints.begin(), _c.codepoints.end(), utf8.data()) -
+            utf8.data());
+    });
+    run(_filter, "utfcpp distance", _c, [&]() {
+        return static_cast<size_t>(utf8::distance(begin, end));
+    });
+}
+#endif
+
+#if defined(UTF8ER_BENCH_UTF8H)
+void run_utf8h(const char * _filter, const corpus & _c)
+{
+    const char * begin = _c.bytes.data();
+    const char * end = begin + _c.bytes.size();
+
+    run(_filter, "utf8.h utf8valid", _c, [&]() {
+        return resume_after_errors(begin, end, [](const char * _b, const char * _e) {
+            // utf8valid works on zero terminated strings only.
+            const char * res = reinterpret_cast<const char *>(
+                utf8valid(reinterpret_cast<const utf8_int8_t *>(_b)));
+            return res ? res : _e;
+        });
+    });
+    if (!_c.valid)
+        return;
+    run(_filter, "utf8.h utf8len", _c, [&]() {
+        return utf8len(reinterpret_cast<const utf8_int8_t *>(begin));
+    });
+}
+#endif
+
+} // namespace
+
+int main(int _argc, char ** _argv)
+{
+    const char * filter = _argc > 1 ? _argv[1] : nullptr;
+    std::vector<corpus> corpora = make_corpora();
+    for (const corpus & c : corpora)
+    {
+        run_utf8er(filter, c);
+#if defined(UTF8ER_BENCH_UTFCPP)
+        run_utfcpp(filter, c);
+#endif
+#if defined(UTF8ER_BENCH_UTF8H)
+        run_utf8h(filter, c);
+#endif
+    }
+    return 0;
+}
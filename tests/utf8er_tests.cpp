@@ -1,7 +1,12 @@
 #include <utf8er/utf8er.hpp>
+#include <utf8er/utf8er_parallel.hpp>
+#include <utf8er/utf8er_unicode.hpp>
 #define JC_TEST_IMPLEMENTATION
 #include "jc_test.h"
 
+#include <algorithm>
+#include <deque>
+#include <random>
 #include <string>
 #include <vector>
 
@@ -18,6 +23,98 @@ TEST(utf8er, validate)
     ASSERT_FALSE(utf8::validate(str2, str2 + std::strlen(str2)).first);
 }
 
+// generates a random utf8 string with codepoints of all lengths. If _corrupt is true, a few bytes
+// are randomly replaced.
+static std::string random_utf8(std::mt19937 & _rng, std::size_t _cp_count, bool _corrupt)
+{
+    static const uint32_t ranges[][2] = { { 0x20, 0x7E },
+                                          { 0x80, 0x7FF },
+                                          { 0x800, 0xD7FF },
+                                          { 0xE000, 0xFFFF },
+                                          { 0x10000, 0x10FFFF } };
+    std::string ret;
+    for (std::size_t i = 0; i < _cp_count; ++i)
+    {
+        // favor ascii to get long ascii runs, too.
+        std::size_t r = _rng() % 10;
+        r = r < 5 ? 0 : r - 5;
+        uint32_t cp = ranges[r][0] + _rng() % (ranges[r][1] - ranges[r][0] + 1);
+        utf8::append(cp, ret);
+    }
+    if (_corrupt && !ret.empty())
+    {
+        for (std::size_t i = 0, n = 1 + _rng() % 3; i < n; ++i)
+            ret[_rng() % ret.size()] = static_cast<char>(_rng() % 256);
+    }
+    return ret;
+}
+
+// random codepoints of all lengths. If _invalid is true, some surrogates and codepoints beyond the
+// unicode range are mixed in.
+static std::vector<utf8::uint32_t> random_codepoints(std::mt19937 & _rng,
+                                                    std::size_t _count,
+                                                    bool _invalid)
+{
+    std::string str = random_utf8(_rng, _count, false);
+    std::vector<utf8::uint32_t> ret;
+    utf8::decode_range(str.begin(), str.end(), std::back_inserter(ret));
+    if (_invalid && !ret.empty())
+        ret[_rng() % ret.size()] = _rng() % 2 ? 0xD800 + _rng() % 0x800 : 0x110000 + _rng();
+    return ret;
+}
+
+TEST(utf8er, validate_errors)
+{
+    const char * cases[] = { "\xc0\xaf", "\xe0\x80\xaf", "\xf0\x80\x80\xaf", "\xf8\x80\x80\x80\xaf",
+                             "\xc0\xc0", "\xe2\x82", "\xed\xa0\x80", "\xf4\x90\x80\x80",
+                             "\x80", "\xe2\x82" "A" };
+    utf8::error_code expected[] = {
+        utf8::error_code::overlong_sequence,     utf8::error_code::overlong_sequence,
+        utf8::error_code::overlong_sequence,     utf8::error_code::bad_leading_byte,
+        utf8::error_code::bad_continuation_byte, utf8::error_code::incomplete_sequence,
+        utf8::error_code::bad_codepoint,         utf8::error_code::bad_codepoint,
+        utf8::error_code::bad_leading_byte,      utf8::error_code::bad_continuation_byte
+    };
+
+    // put every broken sequence at different offsets into long valid strings so that the bulk
+    // code paths are hit, too.
+    for (std::size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); ++i)
+    {
+        for (std::size_t prefix = 0; prefix < 140; prefix += 13)
+        {
+            std::string s(prefix, 'a');
+            s += "ä€";
+            std::size_t pos = s.size();
+            s += cases[i];
+            auto res = utf8::validate(s.begin(), s.end());
+            ASSERT_EQ(res.first, expected[i]);
+            ASSERT_EQ((std::size_t)(res.second - s.begin()), pos);
+
+            s += std::string(100, 'b');
+            res = utf8::validate(s.begin(), s.end());
+            ASSERT_TRUE(res.first);
+            ASSERT_EQ((std::size_t)(res.second - s.begin()), pos);
+        }
+    }
+}
+
+TEST(utf8er, validate_random)
+{
+    std::mt19937 rng(1234);
+    for (int i = 0; i < 2000; ++i)
+    {
+        std::string s = random_utf8(rng, rng() % 200, i % 2 == 1);
+
+        // std::deque is not contiguous and goes through the generic path.
+        std::deque<char> d(s.begin(), s.end());
+        auto expected = utf8::validate(d.begin(), d.end());
+        auto res = utf8::validate(s.data(), s.data() + s.size());
+        ASSERT_EQ(res.first, expected.first);
+        if (res.first)
+            ASSERT_EQ(res.second - s.data(), expected.second - d.begin());
+    }
+}
+
 TEST(utf8er, distance)
 {
     ASSERT_EQ(utf8::distance(str, str + std::strlen(str)), 11);
@@ -25,6 +122,31 @@ TEST(utf8er, distance)
     ASSERT_EQ(utf8::distance(str2 + std::strlen(str2), str2), -11);
 }
 
+TEST(utf8er, count)
+{
+    ASSERT_EQ(utf8::count(str), (std::size_t)11);
+    ASSERT_EQ(utf8::count(str2), (std::size_t)11);
+    ASSERT_EQ(utf8::count(""), (std::size_t)0);
+
+    std::mt19937 rng(11);
+    for (int i = 0; i < 500; ++i)
+    {
+        std::string s = random_utf8(rng, rng() % 300, false);
+        std::deque<char> d(s.begin(), s.end());
+        auto expected = utf8::distance(d.begin(), d.end());
+        ASSERT_EQ(utf8::distance(s.begin(), s.end()), expected);
+        ASSERT_EQ(utf8::distance(s.end(), s.begin()), -expected);
+        ASSERT_EQ(utf8::count(s.c_str()), (std::size_t)expected);
+
+        // start at different alignments.
+        std::size_t offset = 0;
+        for (int j = 0; j < 3 && offset < s.size(); ++j)
+            offset += utf8::byte_count(s[offset]);
+        ASSERT_EQ(utf8::count(s.c_str() + offset),
+                  (std::size_t)utf8::distance(d.begin() + offset, d.end()));
+    }
+}
+
 TEST(utf8er, is_ascii)
 {
     ASSERT_TRUE(utf8::is_ascii(str[0]));
@@ -99,6 +221,51 @@ TEST(utf8er, decode_safe)
     ASSERT_EQ(err, utf8::error_code::incomplete_sequence);
 }
 
+template <class IT>
+static void expect_same_decode(IT _begin, IT _end)
+{
+    utf8::error_report err_a, err_b;
+    uint8_t bc_a = 0xFF, bc_b = 0xFF;
+    uint32_t a = utf8::detail::_decode_safe_branches(_begin, _end, err_a, &bc_a);
+    uint32_t b = utf8::detail::_decode_safe_dfa(_begin, _end, err_b, &bc_b);
+    ASSERT_EQ(a, b);
+    ASSERT_EQ(err_a.code, err_b.code);
+    ASSERT_EQ(bc_a, bc_b);
+}
+
+TEST(utf8er, decode_safe_dfa)
+{
+    // all one and two byte inputs, also truncated to a single byte.
+    uint8_t buf[4];
+    for (uint32_t i = 0; i < 0x10000; ++i)
+    {
+        buf[0] = static_cast<uint8_t>(i >> 8);
+        buf[1] = static_cast<uint8_t>(i);
+        expect_same_decode(buf, buf + 2);
+        expect_same_decode(buf, buf + 1);
+    }
+
+    // all three byte inputs for the interesting leading bytes, random ones for the rest.
+    std::mt19937 rng(8);
+    const uint8_t leads[] = { 0xE0, 0xE1, 0xED, 0xEF, 0xF0, 0xF3, 0xF4, 0xF5, 0xF7 };
+    for (uint8_t lead : leads)
+    {
+        for (uint32_t i = 0; i < 0x10000; ++i)
+        {
+            buf[0] = lead;
+            buf[1] = static_cast<uint8_t>(i >> 8);
+            buf[2] = static_cast<uint8_t>(i);
+            buf[3] = static_cast<uint8_t>(0x80 | (rng() % 0x50));
+            for (size_t len = 1; len <= 4; ++len)
+                expect_same_decode(buf, buf + len);
+        }
+    }
+
+    std::string s = random_utf8(rng, 2000, true);
+    for (auto it = s.begin(); it != s.end(); ++it)
+        expect_same_decode(it, s.end());
+}
+
 TEST(utf8er, append)
 {
     std::string str;
@@ -153,6 +320,145 @@ TEST(utf8er, append_range)
     ASSERT_EQ(str, "A1äÑ𝄢𩶘");
 }
 
+TEST(utf8er, lengths)
+{
+    uint32_t input[] = { 0x0041, 0x0031, 0x00E4, 0x00D1, 0x1D122, 0x29D98 };
+    ASSERT_EQ(utf8::utf8_length(&input[0], &input[0] + 6), std::strlen("A1äÑ𝄢𩶘"));
+    std::string s("A1äÑ𝄢𩶘");
+    ASSERT_EQ(utf8::utf32_length(s.begin(), s.end()), (std::size_t)6);
+
+    std::mt19937 rng(5);
+    for (int i = 0; i < 200; ++i)
+    {
+        std::vector<utf8::uint32_t> cps = random_codepoints(rng, rng() % 100, false);
+        std::deque<utf8::uint32_t> d(cps.begin(), cps.end());
+        std::string expected;
+        utf8::encode_range(d.begin(), d.end(), std::back_inserter(expected));
+        ASSERT_EQ(utf8::utf8_length(cps.begin(), cps.end()), expected.size());
+        ASSERT_EQ(utf8::utf8_length(d.begin(), d.end()), expected.size());
+        ASSERT_EQ(utf8::utf32_length(expected.begin(), expected.end()), cps.size());
+    }
+}
+
+TEST(utf8er, append_range_resize)
+{
+    std::mt19937 rng(6);
+    for (int i = 0; i < 200; ++i)
+    {
+        std::vector<utf8::uint32_t> cps = random_codepoints(rng, rng() % 100, i % 2 == 1);
+        std::string expected("prefix");
+        utf8::error_report expected_err;
+        for (auto cp : cps)
+        {
+            utf8::encode_safe(cp, std::back_inserter(expected), expected_err);
+            if (expected_err)
+                break;
+        }
+
+        std::string str("prefix");
+        utf8::error_report err;
+        utf8::append_range_safe(cps.begin(), cps.end(), str, err);
+        ASSERT_EQ(err, expected_err);
+        ASSERT_EQ(str, expected);
+
+        std::vector<char> vec(6, 'p');
+        utf8::append_range(cps.begin(), cps.end(), vec);
+        ASSERT_EQ(vec.size(), 6 + utf8::utf8_length(cps.begin(), cps.end()));
+
+        if (!err)
+        {
+            std::vector<utf8::uint32_t> decoded(1, 0x20);
+            utf8::decode_range_and_append(str.begin() + 6, str.end(), decoded);
+            ASSERT_EQ(decoded.size(), cps.size() + 1);
+            ASSERT_TRUE(std::equal(cps.begin(), cps.end(), decoded.begin() + 1));
+        }
+    }
+}
+
+// a container that only supports appending whole blocks, to test the bulk sink interface.
+template <class T>
+struct block_container
+{
+    std::vector<T> data;
+    std::size_t reserved = 0;
+    std::size_t writes = 0;
+    std::size_t commits = 0;
+};
+
+template <class T>
+struct block_sink
+{
+    void reserve(std::size_t _count)
+    {
+        container->reserved += _count;
+    }
+
+    void write(const T * _data, std::size_t _count)
+    {
+        container->data.insert(container->data.end(), _data, _data + _count);
+        ++container->writes;
+    }
+
+    void commit()
+    {
+        ++container->commits;
+    }
+
+    block_container<T> * container;
+};
+
+namespace utf8er
+{
+template <class T>
+struct output_iterator_picker<block_container<T>>
+{
+    using output_iter = block_sink<T>;
+    static output_iter iter(block_container<T> & _container)
+    {
+        return block_sink<T>{ &_container };
+    }
+};
+} // namespace utf8er
+
+TEST(utf8er, bulk_sink)
+{
+    std::mt19937 rng(8);
+    std::vector<utf8::uint32_t> cps = random_codepoints(rng, 1000, false);
+    std::string expected;
+    utf8::encode_range(cps.begin(), cps.end(), std::back_inserter(expected));
+
+    block_container<utf8::uint8_t> bytes;
+    utf8::append_range(cps.begin(), cps.end(), bytes);
+    ASSERT_EQ(std::string(bytes.data.begin(), bytes.data.end()), expected);
+    ASSERT_EQ(bytes.reserved, expected.size());
+    ASSERT_EQ(bytes.writes, (std::size_t)4);
+    ASSERT_EQ(bytes.commits, (std::size_t)1);
+
+    // non contiguous input.
+    std::deque<utf8::uint32_t> d(cps.begin(), cps.end());
+    block_container<utf8::uint8_t> bytes2;
+    utf8::append_range(d.begin(), d.end(), bytes2);
+    ASSERT_TRUE(bytes2.data == bytes.data);
+
+    block_container<utf8::uint32_t> decoded;
+    utf8::decode_range_and_append(expected.begin(), expected.end(), decoded);
+    ASSERT_TRUE(decoded.data == cps);
+    ASSERT_EQ(decoded.reserved, cps.size());
+    ASSERT_EQ(decoded.commits, (std::size_t)1);
+
+    std::string broken = expected;
+    std::size_t pos = broken.size() / 2;
+    while ((broken[pos] & 0xC0) == 0x80)
+        --pos;
+    broken[pos] = (char)0xFF;
+    block_container<utf8::uint32_t> decoded2;
+    utf8::error_report err;
+    block_sink<utf8::uint32_t> sink{ &decoded2 };
+    utf8::decode_range_safe(broken.begin(), broken.end(), sink, err);
+    ASSERT_EQ(err, utf8::error_code::bad_leading_byte);
+    ASSERT_EQ(decoded2.data.size(), utf8::utf32_length(broken.begin(), broken.begin() + pos));
+}
+
 TEST(utf8er, next)
 {
     std::string str("ᚠᛇᚻ᛫ᛒᛦᚦ᛫");
@@ -239,6 +545,547 @@ TEST(utf8er, decode_range_safe)
     ASSERT_EQ(out.size(), (std::size_t)4);
 }
 
+TEST(utf8er, decode_range_bulk)
+{
+    std::mt19937 rng(4321);
+    for (int i = 0; i < 500; ++i)
+    {
+        std::string s = random_utf8(rng, rng() % 300, false);
+        std::deque<char> d(s.begin(), s.end());
+        std::vector<utf8::uint32_t> expected;
+        utf8::decode_range(d.begin(), d.end(), std::back_inserter(expected));
+
+        std::vector<utf8::uint32_t> out;
+        utf8::decode_range(s.begin(), s.end(), std::back_inserter(out));
+        ASSERT_TRUE(out == expected);
+
+        // raw pointer output takes the widening fast path.
+        std::vector<utf8::uint32_t> raw(s.size() + 1);
+        utf8::error_report err;
+        utf8::uint32_t * end =
+            utf8::decode_range_safe(s.data(), s.data() + s.size(), raw.data(), err);
+        ASSERT_FALSE(err);
+        raw.resize(end - raw.data());
+        ASSERT_TRUE(raw == expected);
+    }
+
+    std::string broken(100, 'a');
+    broken += "\xe2\x82";
+    broken += std::string(40, 'b');
+    std::vector<utf8::uint32_t> out;
+    utf8::error_report err;
+    utf8::decode_range_safe(broken.begin(), broken.end(), std::back_inserter(out), err);
+    ASSERT_EQ(err, utf8::error_code::bad_continuation_byte);
+    ASSERT_EQ(out.size(), (std::size_t)100);
+}
+
+TEST(utf8er, transcode_to_utf32)
+{
+    std::mt19937 rng(99);
+    for (int i = 0; i < 2000; ++i)
+    {
+        std::string s = random_utf8(rng, rng() % 300, i % 3 == 2);
+        std::deque<char> d(s.begin(), s.end());
+        std::vector<utf8::uint32_t> expected;
+        utf8::error_report err;
+        utf8::decode_range_safe(d.begin(), d.end(), std::back_inserter(expected), err);
+        auto vres = utf8::validate(d.begin(), d.end());
+
+        std::vector<utf8::uint32_t> out(s.size());
+        utf8::transcode_result res = utf8::transcode_to_utf32(s.data(), s.size(), out.data());
+        ASSERT_EQ(res.error, err);
+        ASSERT_EQ(res.produced, expected.size());
+        out.resize(res.produced);
+        ASSERT_TRUE(out == expected);
+        if (err)
+            ASSERT_EQ((long)res.consumed, (long)(vres.second - d.begin()));
+        else
+            ASSERT_EQ(res.consumed, s.size());
+    }
+}
+
+// feeds _bytes in random sized chunks to a stream_validator and a stream_decoder and checks the
+// results against the validation and decoding of the whole buffer.
+template <class C>
+static void check_stream(std::mt19937 & _rng, const C & _bytes)
+{
+    auto expected = utf8::validate(_bytes.begin(), _bytes.end());
+    std::vector<uint32_t> expected_cps;
+    utf8::error_report err;
+    utf8::decode_range_safe(_bytes.begin(), _bytes.end(), std::back_inserter(expected_cps), err);
+
+    utf8::stream_validator validator;
+    utf8::stream_decoder decoder;
+    std::vector<uint32_t> cps;
+    for (auto it = _bytes.begin(); it != _bytes.end();)
+    {
+        auto chunk_end = it + std::min<std::ptrdiff_t>(_rng() % 9, _bytes.end() - it);
+        validator.feed(it, chunk_end);
+        decoder.feed(it, chunk_end, std::back_inserter(cps));
+        ASSERT_LE(validator.pending(), 3u);
+        it = chunk_end;
+    }
+    ASSERT_EQ(validator.finish(), !expected.first);
+    ASSERT_EQ(decoder.finish(), !expected.first);
+    ASSERT_EQ(validator.offset(), (uint64_t)_bytes.size());
+    ASSERT_EQ(validator.error().code, expected.first.code);
+    ASSERT_EQ(decoder.error().code, expected.first.code);
+    ASSERT_TRUE(cps == expected_cps);
+    if (expected.first)
+    {
+        uint64_t pos = static_cast<uint64_t>(expected.second - _bytes.begin());
+        ASSERT_EQ(validator.error_offset(), pos);
+        ASSERT_EQ(decoder.error_offset(), pos);
+    }
+}
+
+TEST(utf8er, stream)
+{
+    std::mt19937 rng(9);
+    for (int i = 0; i < 300; ++i)
+    {
+        std::string s = random_utf8(rng, rng() % 100, i % 3 == 1);
+        if (i % 5 == 0 && !s.empty())
+            s.pop_back(); // likely truncates the last sequence
+        check_stream(rng, s);
+        check_stream(rng, std::deque<char>(s.begin(), s.end()));
+    }
+
+    // a sequence split in three chunks.
+    const char euro[] = "\xe2\x82\xac";
+    uint32_t cp = 0;
+    utf8::stream_decoder decoder;
+    ASSERT_EQ(decoder.feed(euro, euro + 1, &cp), &cp);
+    ASSERT_EQ(decoder.feed(euro + 1, euro + 2, &cp), &cp);
+    ASSERT_EQ(decoder.pending(), 2u);
+    ASSERT_EQ(decoder.feed(euro + 2, euro + 3, &cp), &cp + 1);
+    ASSERT_EQ(cp, (uint32_t)0x20AC);
+    ASSERT_TRUE(decoder.finish());
+
+    // the error offset is absolute, also if the invalid sequence started in an earlier chunk.
+    utf8::stream_validator validator;
+    ASSERT_TRUE(validator.feed(euro, euro + 3));
+    ASSERT_TRUE(validator.feed(euro, euro + 2));
+    ASSERT_FALSE(validator.feed(euro, euro + 1));
+    ASSERT_EQ(validator.error().code, utf8::error_code::bad_continuation_byte);
+    ASSERT_EQ(validator.error_offset(), (uint64_t)3);
+    ASSERT_FALSE(validator.feed(euro, euro + 3));
+    validator.reset();
+    ASSERT_TRUE(validator.feed(euro, euro + 2));
+    ASSERT_FALSE(validator.finish());
+    ASSERT_EQ(validator.error().code, utf8::error_code::incomplete_sequence);
+    ASSERT_EQ(validator.error_offset(), (uint64_t)0);
+}
+
+TEST(utf8er, parallel)
+{
+    ASSERT_FALSE(utf8::validate_parallel(nullptr, 0).first);
+    ASSERT_EQ(utf8::transcode_to_utf32_parallel(nullptr, 0, nullptr).produced, 0u);
+
+    std::mt19937 rng(10);
+    std::string valid = random_utf8(rng, 300000, false);
+    for (int i = 0; i < 12; ++i)
+    {
+        std::string s = valid;
+        if (i % 3 != 0)
+        {
+            // corrupt a few bytes, the reported error has to be the first one.
+            for (int j = 0; j < i; ++j)
+                s[rng() % s.size()] = static_cast<char>(0x80 | (rng() % 0x7F));
+        }
+        size_t threads = 1 + i % 5;
+
+        auto expected = utf8::validate(s.data(), s.data() + s.size());
+        auto result = utf8::validate_parallel(s.data(), s.size(), threads);
+        ASSERT_EQ(result.first.code, expected.first.code);
+        ASSERT_EQ(result.second, expected.second);
+
+        std::vector<uint32_t> expected_cps(s.size());
+        std::vector<uint32_t> cps(s.size());
+        auto expected_res = utf8::transcode_to_utf32(s.data(), s.size(), expected_cps.data());
+        auto res = utf8::transcode_to_utf32_parallel(s.data(), s.size(), cps.data(), threads);
+        ASSERT_EQ(res.error.code, expected_res.error.code);
+        ASSERT_EQ(res.consumed, expected_res.consumed);
+        ASSERT_EQ(res.produced, expected_res.produced);
+        ASSERT_TRUE(std::equal(cps.begin(), cps.begin() + res.produced, expected_cps.begin()));
+    }
+
+    // a truncated sequence right in front of the split between two chunks is followed by more
+    // input, which makes it a bad continuation byte and not an incomplete sequence.
+    std::string split(200000, 'a');
+    split.replace(99998, 2, "\xE2\x82");
+    auto result = utf8::validate_parallel(split.data(), split.size(), 2);
+    ASSERT_EQ(result.first.code, utf8::error_code::bad_continuation_byte);
+    ASSERT_EQ(result.second, split.data() + 99998);
+    std::vector<uint32_t> cps(split.size());
+    auto res = utf8::transcode_to_utf32_parallel(split.data(), split.size(), cps.data(), 2);
+    ASSERT_EQ(res.error.code, utf8::error_code::bad_continuation_byte);
+    ASSERT_EQ(res.consumed, 99998u);
+    ASSERT_EQ(res.produced, 99998u);
+}
+
+TEST(utf8er, codepoint_index)
+{
+    std::mt19937 rng(13);
+    const size_t strides[] = { 1, 3, 64, 1000 };
+    for (size_t stride : strides)
+    {
+        std::string s = random_utf8(rng, 500, false);
+        const char * begin = s.data();
+        const char * end = begin + s.size();
+        utf8::codepoint_index index(begin, end, stride);
+        ASSERT_EQ(index.size(), (size_t)utf8::distance(begin, end));
+
+        size_t n = 0;
+        for (const char * it = begin; it != end; it = utf8::next(it), ++n)
+        {
+            ASSERT_EQ(index.nth(n), it);
+            for (const char * b = it; b != utf8::next(it); ++b)
+                ASSERT_EQ(index.index_at(static_cast<size_t>(b - begin)), n);
+        }
+        ASSERT_EQ(index.nth(n), end);
+        ASSERT_EQ(index.index_at(s.size()), n);
+    }
+
+    utf8::codepoint_index empty(str, str);
+    ASSERT_EQ(empty.size(), 0u);
+    ASSERT_EQ(empty.nth(0), str);
+    ASSERT_EQ(empty.index_at(0), 0u);
+}
+
+TEST(utf8er, utf8_view)
+{
+    utf8::error_report err;
+    utf8::utf8_view invalid("A\xe2\x82", err);
+    ASSERT_EQ(err, utf8::error_code::incomplete_sequence);
+    ASSERT_TRUE(invalid.empty());
+    ASSERT_EQ(invalid.count(), 0u);
+
+    err = utf8::error_report();
+    utf8::utf8_view view(str2, err);
+    ASSERT_FALSE(err);
+    ASSERT_EQ(view.size(), std::strlen(str2));
+    ASSERT_EQ(view.count(), (size_t)11);
+
+    std::vector<uint32_t> cps;
+    view.decode_range(std::back_inserter(cps));
+    ASSERT_EQ(cps.size(), view.count());
+
+    size_t n = 0;
+    for (const char * it = view.begin(); it != view.end(); it = view.next(it), ++n)
+    {
+        ASSERT_EQ(view.decode(it), cps[n]);
+        ASSERT_EQ(view.nth(n), it);
+        ASSERT_EQ(view.index_at(static_cast<size_t>(it - view.begin())), n);
+    }
+    for (const char * it = view.end(); it != view.begin(); --n)
+    {
+        it = view.previous(it);
+        ASSERT_EQ(view.decode(it), cps[n - 1]);
+    }
+
+    utf8::utf8_view sub = view.subview(2, 3);
+    ASSERT_EQ(sub.count(), (size_t)3);
+    ASSERT_EQ(sub.begin(), view.nth(2));
+    ASSERT_EQ(sub.end(), view.nth(5));
+    ASSERT_EQ(sub.decode(sub.begin()), (uint32_t)0x00E4);
+    ASSERT_EQ(view.subview(9).count(), (size_t)2);
+    ASSERT_TRUE(view.subview(20).empty());
+}
+
+// all of these are evaluated at compile time.
+using namespace utf8::literals;
+static constexpr auto literal = "A1äÑÝ€îꜳ𝄢ů𩶘"_u8v;
+static_assert(literal.count() == 11, "");
+static_assert(literal.size() == 26, "");
+static_assert(utf8::count("A1äÑÝ€îꜳ𝄢ů𩶘") == 11, "");
+static_assert(utf8::distance(literal.begin(), literal.end()) == 11, "");
+static_assert(!utf8::validate("A1äÑÝ€îꜳ𝄢ů𩶘").first, "");
+static_assert(utf8::validate("\xe2\x82").first.code == utf8::error_code::incomplete_sequence, "");
+static_assert(utf8::byte_count(0xF0) == 4, "");
+static_assert(utf8::decode("𝄢") == 0x1D122, "");
+static_assert(utf8::next(literal.begin()) + 1 == literal.begin() + 2, "");
+
+static constexpr utf8::uint32_t constexpr_decode_safe(const char * _str)
+{
+    utf8::error_report err;
+    utf8::uint32_t cp = utf8::decode_safe(_str, err);
+    return err ? utf8::not_a_character : cp;
+}
+static_assert(constexpr_decode_safe("ꜳ") == 0xA733, "");
+static_assert(constexpr_decode_safe("\xed\xa0\x80") == utf8::not_a_character, "");
+
+static constexpr char constexpr_encode(utf8::uint32_t _cp, int _byte)
+{
+    char bytes[4] = {};
+    utf8::encode(_cp, bytes);
+    return bytes[_byte];
+}
+static_assert(constexpr_encode(0x20AC, 0) == '\xe2' && constexpr_encode(0x20AC, 2) == '\xac', "");
+
+TEST(utf8er, static_utf8)
+{
+    ASSERT_EQ(std::string(literal.begin(), literal.end()), str2);
+    utf8::utf8_view view = literal.view();
+    ASSERT_EQ(view.count(), 11u);
+    ASSERT_EQ(view.decode(view.nth(8)), 0x1D122u);
+
+    // the same functions still work at runtime.
+    std::string s = str2;
+    ASSERT_EQ(utf8::count(s.c_str()), 11u);
+    ASSERT_FALSE(utf8::validate(s.c_str()).first);
+}
+
+TEST(utf8er, codepoint_array)
+{
+    utf8::error_report err;
+    utf8::codepoint_array ascii("hello", err);
+    ASSERT_FALSE(err);
+    ASSERT_EQ(ascii.width(), (std::size_t)1);
+    ASSERT_EQ(ascii.size(), (std::size_t)5);
+    ASSERT_EQ(ascii[1], (utf8::uint32_t)'e');
+    ASSERT_EQ(utf8::codepoint_array("grüße", err).width(), (std::size_t)1);
+    ASSERT_EQ(utf8::codepoint_array("ČSSR €", err).width(), (std::size_t)2);
+    ASSERT_EQ(utf8::codepoint_array("😀", err).width(), (std::size_t)4);
+    ASSERT_TRUE(utf8::codepoint_array(std::string().c_str(), err).empty());
+    ASSERT_FALSE(err);
+
+    // dense two and three byte sequences fill the SIMD stores up to the end of the input.
+    const char * dense[] = { "\xC3\xA9", "\xD0\x96", "\xE2\x82\xAC", "\xF0\x9F\x98\x80" };
+    for (const char * seq : dense)
+    {
+        std::string s;
+        for (int i = 0; i < 40; ++i)
+            s += seq;
+        utf8::codepoint_array arr(s.data(), s.data() + s.size(), err);
+        ASSERT_FALSE(err);
+        ASSERT_EQ(arr.size(), (std::size_t)40);
+        ASSERT_EQ(arr.to_utf8(), s);
+    }
+
+    utf8::codepoint_array broken("abc\xC3", err);
+    ASSERT_EQ(err, utf8::error_code::incomplete_sequence);
+    ASSERT_TRUE(broken.empty());
+    utf8::codepoint_array stray("\xF0\x9F\x98\x80\x80", err);
+    ASSERT_TRUE(err);
+    ASSERT_TRUE(stray.empty());
+
+    std::mt19937 rng(22);
+    for (int i = 0; i < 1000; ++i)
+    {
+        // limits the codepoints to every width in turn.
+        std::vector<utf8::uint32_t> cps = random_codepoints(rng, rng() % 300, false);
+        utf8::uint32_t limit = i % 3 == 0 ? 0x100 : i % 3 == 1 ? 0x10000 : 0x110000;
+        for (utf8::uint32_t & cp : cps)
+            cp %= limit;
+        std::string s;
+        utf8::append_range(cps.begin(), cps.end(), s);
+        if (i % 5 == 4 && !s.empty())
+            s[rng() % s.size()] = static_cast<char>(0x80 | rng() % 0x80);
+
+        std::vector<utf8::uint32_t> expected;
+        utf8::error_report expected_err;
+        utf8::decode_range_safe(s.begin(), s.end(), std::back_inserter(expected), expected_err);
+
+        utf8::codepoint_array arr(s.data(), s.data() + s.size(), err);
+        ASSERT_EQ(err, expected_err);
+        if (err)
+        {
+            ASSERT_TRUE(arr.empty());
+            continue;
+        }
+        ASSERT_TRUE(std::vector<utf8::uint32_t>(arr.begin(), arr.end()) == expected);
+        ASSERT_EQ(arr.size(), expected.size());
+        utf8::uint32_t max =
+            expected.empty() ? 0 : *std::max_element(expected.begin(), expected.end());
+        ASSERT_EQ(arr.width(), (std::size_t)(max < 0x100 ? 1 : max < 0x10000 ? 2 : 4));
+        for (std::size_t j = 0; j < arr.size(); j += 7)
+            ASSERT_EQ(arr[j], expected[j]);
+
+        ASSERT_EQ(arr.utf8_length(), s.size());
+        ASSERT_EQ(arr.to_utf8(), s);
+        std::string generic;
+        arr.encode(std::back_inserter(generic));
+        ASSERT_EQ(generic, s);
+    }
+}
+
+TEST(utf8er, codepoint_range)
+{
+    std::vector<uint32_t> expected;
+    utf8::decode_c_str(str2, std::back_inserter(expected));
+    std::vector<uint32_t> cps;
+    for (uint32_t cp : utf8::codepoint_range(str2))
+        cps.push_back(cp);
+    ASSERT_TRUE(cps == expected);
+
+    std::mt19937 rng(15);
+    for (int i = 0; i < 200; ++i)
+    {
+        std::string s = random_utf8(rng, rng() % 1000, i % 2 == 1);
+        const char * begin = s.data();
+        const char * end = begin + s.size();
+
+        expected.clear();
+        utf8::error_report err;
+        utf8::decode_range_safe(begin, end, std::back_inserter(expected), err);
+        auto valid = utf8::validate(begin, end);
+
+        utf8::codepoint_range range(begin, end);
+        cps.assign(range.begin(), range.end());
+        ASSERT_TRUE(cps == expected);
+        ASSERT_EQ(range.error().code, err.code);
+        ASSERT_EQ(range.error_position(), valid.first ? valid.second : nullptr);
+    }
+
+    utf8::codepoint_range range(str2);
+    auto above_latin1 = [](uint32_t _cp) { return _cp > 0xFF; };
+    ASSERT_EQ(std::count_if(range.begin(), range.end(), above_latin1), 5);
+    utf8::codepoint_range empty(str, str);
+    ASSERT_TRUE(empty.begin() == empty.end());
+}
+
+TEST(utf8er, decode_range_lossy)
+{
+    // the example of table 3-8 in the unicode standard.
+    const char * input = "\x61\xF1\x80\x80\xE1\x80\xC2\x62\x80\x63\x80\xBF\x64";
+    const std::vector<uint32_t> expected = { 0x61, 0xFFFD, 0xFFFD, 0xFFFD, 0x62, 0xFFFD,
+                                             0x63, 0xFFFD, 0xFFFD, 0x64 };
+    const std::vector<size_t> expected_errors = { 1, 4, 6, 8, 10, 11 };
+    std::vector<uint32_t> cps;
+    std::vector<size_t> errors;
+    utf8::decode_range_lossy(input, input + std::strlen(input), std::back_inserter(cps), &errors);
+    ASSERT_TRUE(cps == expected);
+    ASSERT_TRUE(errors == expected_errors);
+
+    std::string sanitized;
+    utf8::sanitize(input, input + std::strlen(input), std::back_inserter(sanitized));
+    ASSERT_EQ(sanitized, std::string("a\xEF\xBF\xBD\xEF\xBF\xBD\xEF\xBF\xBD"
+                                     "b\xEF\xBF\xBD" "c\xEF\xBF\xBD\xEF\xBF\xBD" "d"));
+
+    // overlong sequences, surrogates and codepoints beyond 0x10FFFF are replaced byte by byte.
+    const char * bad = "\xE0\x80\xAF\xED\xA0\x80\xF4\x90\x80\x80\xF0\x9F\x98";
+    cps.clear();
+    utf8::decode_range_lossy(bad, bad + std::strlen(bad), std::back_inserter(cps));
+    ASSERT_TRUE(cps == std::vector<uint32_t>(11, 0xFFFD));
+
+    std::mt19937 rng(16);
+    for (int i = 0; i < 200; ++i)
+    {
+        // the later strings span several of the blocks the contiguous input is decoded in.
+        std::string s = random_utf8(rng, rng() % (i < 100 ? 300 : 3000), i % 2 == 1);
+        std::deque<char> d(s.begin(), s.end());
+
+        // contiguous and generic iterators agree.
+        std::vector<uint32_t> a, b;
+        std::vector<size_t> errors_a, errors_b;
+        utf8::decode_range_lossy(s.begin(), s.end(), std::back_inserter(a), &errors_a);
+        utf8::decode_range_lossy(d.begin(), d.end(), std::back_inserter(b), &errors_b);
+        ASSERT_TRUE(a == b);
+        ASSERT_TRUE(errors_a == errors_b);
+
+        // sanitized output is valid and decodes to the same codepoints.
+        std::string sa;
+        std::vector<char> sb;
+        errors.clear();
+        utf8::sanitize(s.begin(), s.end(), std::back_inserter(sa), &errors);
+        utf8::sanitize(d.begin(), d.end(), std::back_inserter(sb));
+        ASSERT_TRUE(std::equal(sa.begin(), sa.end(), sb.begin()) && sa.size() == sb.size());
+        ASSERT_TRUE(errors == errors_a);
+        ASSERT_FALSE(utf8::validate(sa.begin(), sa.end()).first);
+        cps.clear();
+        utf8::decode_range(sa.begin(), sa.end(), std::back_inserter(cps));
+        ASSERT_TRUE(cps == a);
+
+        if (errors_a.empty())
+            ASSERT_EQ(sa, s);
+    }
+}
+
+TEST(utf8er, policies)
+{
+    const char * input = "\x61\xF1\x80\x80\xE1\x80\xC2\x62\x80\x63\x80\xBF\x64";
+    const char * input_end = input + std::strlen(input);
+    std::vector<uint32_t> cps;
+    utf8::error_report err;
+    utf8::decode_range<utf8::policy::skip>(input, input_end, std::back_inserter(cps), err);
+    ASSERT_TRUE(cps == std::vector<uint32_t>({ 'a', 'b', 'c', 'd' }));
+    ASSERT_EQ(err.code, utf8::error_code::bad_continuation_byte);
+
+    cps.clear();
+    err = utf8::error_report();
+    utf8::decode_range<utf8::policy::report_first>(input, input_end, std::back_inserter(cps), err);
+    ASSERT_TRUE(cps == std::vector<uint32_t>({ 'a' }));
+    ASSERT_EQ(err.code, utf8::error_code::bad_continuation_byte);
+
+    std::mt19937 rng(20);
+    for (int i = 0; i < 200; ++i)
+    {
+        std::string s = random_utf8(rng, rng() % 300, i % 2 == 1);
+        std::deque<char> d(s.begin(), s.end());
+
+        // replace is decode_range_lossy, skip drops the replacements (if the input has no
+        // replacement characters of its own).
+        std::vector<uint32_t> lossy, replaced, skipped, skipped_generic;
+        std::vector<size_t> errors;
+        utf8::decode_range_lossy(s.begin(), s.end(), std::back_inserter(lossy), &errors);
+        utf8::error_report replace_err, skip_err, skip_generic_err;
+        utf8::decode_range<utf8::policy::replace>(
+            s.begin(), s.end(), std::back_inserter(replaced), replace_err);
+        utf8::decode_range<utf8::policy::skip>(
+            s.begin(), s.end(), std::back_inserter(skipped), skip_err);
+        utf8::decode_range<utf8::policy::skip>(
+            d.begin(), d.end(), std::back_inserter(skipped_generic), skip_generic_err);
+        ASSERT_TRUE(replaced == lossy);
+        ASSERT_TRUE(skipped == skipped_generic);
+        ASSERT_EQ(skipped.size(), lossy.size() - errors.size());
+        ASSERT_EQ(skip_err, skip_generic_err);
+        ASSERT_EQ(!!replace_err, !errors.empty());
+        ASSERT_EQ(!!skip_err, !errors.empty());
+        if (std::find(s.begin(), s.end(), '\xEF') == s.end())
+        {
+            lossy.erase(std::remove(lossy.begin(), lossy.end(), utf8::replacement_character),
+                        lossy.end());
+            ASSERT_TRUE(skipped == lossy);
+        }
+
+        // encoding replaces or drops surrogates and codepoints beyond 0x10FFFF.
+        std::vector<uint32_t> codepoints = random_codepoints(rng, rng() % 300, i % 2 == 1);
+        std::vector<uint32_t> valid, sanitized;
+        for (uint32_t cp : codepoints)
+        {
+            bool ok = cp <= 0x10FFFF && (cp < 0xD800 || cp > 0xDFFF);
+            sanitized.push_back(ok ? cp : utf8::replacement_character);
+            if (ok)
+                valid.push_back(cp);
+        }
+        std::string expected_replaced, expected_skipped;
+        utf8::encode_range(
+            sanitized.begin(), sanitized.end(), std::back_inserter(expected_replaced));
+        utf8::encode_range(valid.begin(), valid.end(), std::back_inserter(expected_skipped));
+
+        std::vector<char> out(codepoints.size() * 4);
+        std::deque<uint32_t> dcps(codepoints.begin(), codepoints.end());
+        std::string generic;
+        err = utf8::error_report();
+        char * end = utf8::encode_range<utf8::policy::replace>(
+            codepoints.data(), codepoints.data() + codepoints.size(), out.data(), err);
+        utf8::encode_range<utf8::policy::replace>(
+            dcps.begin(), dcps.end(), std::back_inserter(generic), err);
+        ASSERT_EQ(std::string(out.data(), end), expected_replaced);
+        ASSERT_EQ(generic, expected_replaced);
+        ASSERT_EQ(!!err, valid.size() != codepoints.size());
+
+        generic.clear();
+        end = utf8::encode_range<utf8::policy::skip>(
+            codepoints.data(), codepoints.data() + codepoints.size(), out.data(), err);
+        utf8::encode_range<utf8::policy::skip>(
+            dcps.begin(), dcps.end(), std::back_inserter(generic), err);
+        ASSERT_EQ(std::string(out.data(), end), expected_skipped);
+        ASSERT_EQ(generic, expected_skipped);
+    }
+}
+
 TEST(utf8er, encode_range)
 {
     uint32_t input[] = { 0x0041, 0x0031, 0x00E4, 0x00D1, 0x1D122, 0x29D98 };
@@ -248,6 +1095,564 @@ TEST(utf8er, encode_range)
     ASSERT_EQ(out, "A1äÑ𝄢𩶘");
 }
 
+TEST(utf8er, transcode_to_utf8)
+{
+    std::mt19937 rng(7);
+    for (int i = 0; i < 2000; ++i)
+    {
+        std::vector<utf8::uint32_t> cps = random_codepoints(rng, rng() % 200, i % 3 == 2);
+
+        std::string expected;
+        utf8::error_report err;
+        std::size_t err_idx = 0;
+        for (; err_idx < cps.size(); ++err_idx)
+        {
+            utf8::append_safe(cps[err_idx], expected, err);
+            if (err)
+                break;
+        }
+
+        // sized for exactly the encoded length, so any overflow is caught by the sanitizer.
+        std::vector<char> out(expected.size());
+        utf8::transcode_result res = utf8::transcode_to_utf8(cps.data(), cps.size(), out.data());
+        ASSERT_EQ(res.error, err);
+        ASSERT_EQ(res.consumed, err_idx);
+        ASSERT_EQ(res.produced, expected.size());
+        ASSERT_TRUE(std::string(out.begin(), out.end()) == expected);
+
+        if (!err)
+        {
+            std::vector<char> out2(expected.size());
+            char * end = utf8::encode_range(cps.data(), cps.data() + cps.size(), out2.data());
+            ASSERT_EQ((std::size_t)(end - out2.data()), expected.size());
+            ASSERT_TRUE(out2 == out);
+        }
+    }
+}
+
+TEST(utf8er, transcode_bounded)
+{
+    std::mt19937 rng(21);
+    for (int i = 0; i < 1000; ++i)
+    {
+        // decodes into small, exactly sized buffers and resumes after every one of them.
+        std::string s = random_utf8(rng, rng() % 300, i % 3 == 2);
+        std::vector<utf8::uint32_t> expected(s.size());
+        utf8::transcode_result expected_res =
+            utf8::transcode_to_utf32(s.data(), s.size(), expected.data());
+        expected.resize(expected_res.produced);
+
+        std::vector<utf8::uint32_t> cps;
+        utf8::transcode_result res;
+        for (std::size_t consumed = 0; consumed < s.size();)
+        {
+            std::size_t capacity = 1 + rng() % (i % 2 ? 8 : 80);
+            std::vector<utf8::uint32_t> out(capacity);
+            res = utf8::transcode_to_utf32(
+                s.data() + consumed, s.size() - consumed, out.data(), capacity);
+            cps.insert(cps.end(), out.begin(), out.begin() + res.produced);
+            consumed += res.consumed;
+            if (res.error)
+            {
+                ASSERT_EQ(res.error, expected_res.error);
+                ASSERT_EQ(consumed, expected_res.consumed);
+                break;
+            }
+            if (consumed < s.size())
+                ASSERT_EQ(res.produced, capacity);
+        }
+        ASSERT_EQ(res.error, expected_res.error);
+        ASSERT_TRUE(cps == expected);
+
+        // same for encoding.
+        std::vector<utf8::uint32_t> codepoints = random_codepoints(rng, rng() % 200, i % 3 == 2);
+        std::vector<char> expected_bytes(codepoints.size() * 4);
+        expected_res =
+            utf8::transcode_to_utf8(codepoints.data(), codepoints.size(), expected_bytes.data());
+        expected_bytes.resize(expected_res.produced);
+
+        std::vector<char> bytes;
+        res = utf8::transcode_result();
+        for (std::size_t consumed = 0; consumed < codepoints.size();)
+        {
+            std::size_t capacity = 4 + rng() % (i % 2 ? 8 : 300);
+            std::vector<char> out(capacity);
+            res = utf8::transcode_to_utf8(
+                codepoints.data() + consumed, codepoints.size() - consumed, out.data(), capacity);
+            bytes.insert(bytes.end(), out.begin(), out.begin() + res.produced);
+            consumed += res.consumed;
+            if (res.error)
+            {
+                ASSERT_EQ(consumed, expected_res.consumed);
+                break;
+            }
+            if (consumed < codepoints.size())
+                ASSERT_TRUE(res.produced + 4 > capacity);
+        }
+        ASSERT_EQ(res.error, expected_res.error);
+        ASSERT_TRUE(bytes == expected_bytes);
+    }
+
+    // a sequence that does not fit is not an error, even if it is cut off by the capacity.
+    const char * str = "a\xE2\x82\xAC";
+    utf8::uint32_t cp;
+    utf8::transcode_result res = utf8::transcode_to_utf32(str, 4, &cp, 1);
+    ASSERT_FALSE(res.error);
+    ASSERT_EQ(res.consumed, (std::size_t)1);
+    char bytes[3];
+    utf8::uint32_t cps[] = { 'a', 0x20AC };
+    res = utf8::transcode_to_utf8(cps, 2, bytes, 3);
+    ASSERT_FALSE(res.error);
+    ASSERT_EQ(res.consumed, (std::size_t)1);
+    ASSERT_EQ(res.produced, (std::size_t)1);
+}
+
+// the utf16 encoding of _cps, with the bytes of every unit swapped if _swap is true.
+static std::vector<utf8::uint16_t> to_utf16(const std::vector<utf8::uint32_t> & _cps, bool _swap)
+{
+    std::vector<utf8::uint16_t> ret;
+    for (utf8::uint32_t cp : _cps)
+    {
+        if (cp >= 0x10000)
+        {
+            ret.push_back(static_cast<utf8::uint16_t>(0xD800 | ((cp - 0x10000) >> 10)));
+            cp = 0xDC00 | (cp & 0x3FF);
+        }
+        ret.push_back(static_cast<utf8::uint16_t>(cp));
+    }
+    if (_swap)
+    {
+        for (utf8::uint16_t & unit : ret)
+            unit = static_cast<utf8::uint16_t>((unit << 8) | (unit >> 8));
+    }
+    return ret;
+}
+
+TEST(utf8er, utf16)
+{
+    // long runs without surrogates for the SIMD path.
+    std::string bmp;
+    for (int i = 0; i < 100; ++i)
+        bmp += "Съешь же ещё этих ಬಾ ಇಲ್ಲಿ ಸಂಭವಿಸು! ";
+
+    std::mt19937 rng(9);
+    for (int i = 0; i < 2000; ++i)
+    {
+        std::string str = i == 0 ? bmp : random_utf8(rng, i % 50 == 0 ? 3000 : rng() % 200,
+                                                     i % 3 == 2);
+        std::vector<utf8::uint32_t> cps(str.size());
+        utf8::transcode_result ref = utf8::transcode_to_utf32(str.data(), str.size(), cps.data());
+        cps.resize(ref.produced);
+
+        for (utf8::byte_order order : { utf8::byte_order::little_endian,
+                                        utf8::byte_order::big_endian })
+        {
+            std::vector<utf8::uint16_t> expected = to_utf16(cps, order != utf8::native_byte_order);
+            std::vector<utf8::uint16_t> out(utf8::utf8_to_utf16_length(str.data(), str.size()));
+            if (!ref.error)
+                ASSERT_EQ(out.size(), expected.size());
+            utf8::transcode_result res =
+                utf8::utf8_to_utf16(str.data(), str.size(), out.data(), order);
+            ASSERT_EQ(res.error, ref.error);
+            ASSERT_EQ(res.consumed, ref.consumed);
+            ASSERT_EQ(res.produced, expected.size());
+            ASSERT_TRUE(std::equal(expected.begin(), expected.end(), out.begin()));
+            if (ref.error)
+                continue;
+
+            // sized for exactly the encoded length, so any overflow is caught by the sanitizer.
+            std::vector<char> back(
+                utf8::utf16_to_utf8_length(expected.data(), expected.size(), order));
+            ASSERT_EQ(back.size(), str.size());
+            res = utf8::utf16_to_utf8(expected.data(), expected.size(), back.data(), order);
+            ASSERT_FALSE(res.error);
+            ASSERT_EQ(res.consumed, expected.size());
+            ASSERT_EQ(res.produced, str.size());
+            ASSERT_TRUE(std::string(back.begin(), back.end()) == str);
+
+            // a lone low surrogate anywhere stops the transcoding right there.
+            std::size_t pos = rng() % (expected.size() + 1);
+            utf8::uint16_t high = expected.empty() || pos == 0 ? 0 : expected[pos - 1];
+            if (order != utf8::native_byte_order)
+                high = static_cast<utf8::uint16_t>((high << 8) | (high >> 8));
+            if (high >= 0xD800 && high < 0xDC00)
+                continue;
+            utf8::uint16_t low = static_cast<utf8::uint16_t>(0xDC00 + rng() % 0x400);
+            if (order != utf8::native_byte_order)
+                low = static_cast<utf8::uint16_t>((low << 8) | (low >> 8));
+            expected.insert(expected.begin() + pos, low);
+            back.resize(utf8::utf16_to_utf8_length(expected.data(), expected.size(), order));
+            res = utf8::utf16_to_utf8(expected.data(), expected.size(), back.data(), order);
+            ASSERT_EQ(res.error.code, utf8::error_code::bad_codepoint);
+            ASSERT_EQ(res.consumed, pos);
+            ASSERT_EQ(res.produced, utf8::utf16_to_utf8_length(expected.data(), pos, order));
+            ASSERT_TRUE(std::equal(back.begin(), back.begin() + res.produced, str.begin()));
+        }
+    }
+
+    const utf8::uint16_t lone_low[] = { 'a', 0xDC00, 'b' };
+    const utf8::uint16_t lone_high[] = { 'a', 0xD800, 'b' };
+    const utf8::uint16_t truncated[] = { 'a', 0xD83D };
+    const utf8::uint16_t pair[] = { 0xD83D, 0xDE00 };
+    char out[8];
+    utf8::transcode_result res = utf8::utf16_to_utf8(lone_low, 3, out);
+    ASSERT_EQ(res.error.code, utf8::error_code::bad_codepoint);
+    ASSERT_EQ(res.consumed, 1u);
+    ASSERT_EQ(res.produced, 1u);
+    res = utf8::utf16_to_utf8(lone_high, 3, out);
+    ASSERT_EQ(res.error.code, utf8::error_code::bad_codepoint);
+    ASSERT_EQ(res.consumed, 1u);
+    res = utf8::utf16_to_utf8(truncated, 2, out);
+    ASSERT_EQ(res.error.code, utf8::error_code::incomplete_sequence);
+    ASSERT_EQ(res.consumed, 1u);
+    res = utf8::utf16_to_utf8(pair, 2, out);
+    ASSERT_FALSE(res.error);
+    ASSERT_EQ(std::string(out, res.produced), "😀");
+}
+
+TEST(utf8er, latin1)
+{
+    std::mt19937 rng(11);
+    for (int i = 0; i < 2000; ++i)
+    {
+        // favor ascii to get long ascii runs, too.
+        std::string latin1(i % 50 == 0 ? 3000 : rng() % 200, '\0');
+        for (char & c : latin1)
+            c = static_cast<char>(rng() % 3 ? rng() % 0x80 : rng() % 0x100);
+
+        std::string expected;
+        for (char c : latin1)
+            utf8::append(static_cast<unsigned char>(c), expected);
+
+        // sized for exactly the encoded length, so any overflow is caught by the sanitizer.
+        std::vector<char> out(utf8::latin1_to_utf8_length(latin1.data(), latin1.size()));
+        ASSERT_EQ(out.size(), expected.size());
+        ASSERT_EQ(utf8::latin1_to_utf8(latin1.data(), latin1.size(), out.data()), out.size());
+        ASSERT_TRUE(std::string(out.begin(), out.end()) == expected);
+
+        std::vector<char> back(expected.size());
+        utf8::transcode_result res = utf8::utf8_to_latin1(expected.data(), expected.size(),
+                                                          back.data());
+        ASSERT_FALSE(res.error);
+        ASSERT_EQ(res.consumed, expected.size());
+        ASSERT_EQ(res.produced, latin1.size());
+        ASSERT_TRUE(std::string(back.begin(), back.begin() + res.produced) == latin1);
+
+        // a codepoint beyond latin1 or invalid utf8 stops the conversion right there.
+        std::size_t pos = rng() % (latin1.size() + 1);
+        std::string broken = expected;
+        std::size_t offset = pos;
+        for (std::size_t j = 0; j < pos; ++j)
+            offset += static_cast<unsigned char>(latin1[j]) >= 0x80;
+        bool invalid = rng() % 2;
+        broken.insert(offset, invalid ? "\xC3" : "€");
+        back.resize(broken.size());
+        res = utf8::utf8_to_latin1(broken.data(), broken.size(), back.data());
+        ASSERT_EQ(res.error.code, invalid ? utf8::validate(broken.begin(), broken.end()).first.code
+                                          : utf8::error_code::bad_codepoint);
+        ASSERT_EQ(res.consumed, offset);
+        ASSERT_EQ(res.produced, pos);
+        ASSERT_TRUE(std::string(back.begin(), back.begin() + pos) == latin1.substr(0, pos));
+    }
+}
+
+TEST(utf8er, normalize)
+{
+    // the input followed by its NFC, NFD, NFKC and NFKD normalization.
+    const char * cases[][5] = {
+        { "e\xCC\x81", "\xC3\xA9", "e\xCC\x81", "\xC3\xA9", "e\xCC\x81" },
+        { "\xC3\xA9", "\xC3\xA9", "e\xCC\x81", "\xC3\xA9", "e\xCC\x81" },
+        { "\xE1\xB8\x8B\xCC\xA3",
+          "\xE1\xB8\x8D\xCC\x87",
+          "d\xCC\xA3\xCC\x87",
+          "\xE1\xB8\x8D\xCC\x87",
+          "d\xCC\xA3\xCC\x87" },
+        { "q\xCC\x87\xCC\xA3",
+          "q\xCC\xA3\xCC\x87",
+          "q\xCC\xA3\xCC\x87",
+          "q\xCC\xA3\xCC\x87",
+          "q\xCC\xA3\xCC\x87" },
+        { "\xE2\x84\xAB", "\xC3\x85", "A\xCC\x8A", "\xC3\x85", "A\xCC\x8A" },
+        { "\xEF\xAC\x81", "\xEF\xAC\x81", "\xEF\xAC\x81", "fi", "fi" },
+        { "\xEA\xB0\x80\xE1\x86\xA8",
+          "\xEA\xB0\x81",
+          "\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8",
+          "\xEA\xB0\x81",
+          "\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8" },
+        { "\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8",
+          "\xEA\xB0\x81",
+          "\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8",
+          "\xEA\xB0\x81",
+          "\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8" },
+        { "\xE0\xA5\x98",
+          "\xE0\xA4\x95\xE0\xA4\xBC",
+          "\xE0\xA4\x95\xE0\xA4\xBC",
+          "\xE0\xA4\x95\xE0\xA4\xBC",
+          "\xE0\xA4\x95\xE0\xA4\xBC" },
+        { "\xE1\xBA\x9B\xCC\xA3",
+          "\xE1\xBA\x9B\xCC\xA3",
+          "\xC5\xBF\xCC\xA3\xCC\x87",
+          "\xE1\xB9\xA9",
+          "s\xCC\xA3\xCC\x87" },
+        { "a\xCC\xA8\xCC\x81\xCC\x82",
+          "\xC4\x85\xCC\x81\xCC\x82",
+          "a\xCC\xA8\xCC\x81\xCC\x82",
+          "\xC4\x85\xCC\x81\xCC\x82",
+          "a\xCC\xA8\xCC\x81\xCC\x82" },
+        { "caf\xC3\xA9 \xE2\x91\xA0 x\xC2\xB2",
+          "caf\xC3\xA9 \xE2\x91\xA0 x\xC2\xB2",
+          "cafe\xCC\x81 \xE2\x91\xA0 x\xC2\xB2",
+          "caf\xC3\xA9 1 x2",
+          "cafe\xCC\x81 1 x2" },
+    };
+    const utf8::normalization_form forms[] = { utf8::normalization_form::nfc,
+                                               utf8::normalization_form::nfd,
+                                               utf8::normalization_form::nfkc,
+                                               utf8::normalization_form::nfkd };
+    utf8::error_report err;
+    std::string buffer;
+    for (const auto & c : cases)
+    {
+        const char * end = c[0] + std::strlen(c[0]);
+        for (int i = 0; i < 4; ++i)
+        {
+            auto res = utf8::normalize(c[0], end, forms[i], buffer, err);
+            ASSERT_FALSE(err);
+            ASSERT_EQ(std::string(res.first, res.second), std::string(c[i + 1]));
+            // normalized input is returned as is.
+            bool normalized = std::strcmp(c[0], c[i + 1]) == 0;
+            ASSERT_EQ(utf8::is_normalized(c[0], end, forms[i], err), normalized);
+            if (utf8::quick_check(c[0], end, forms[i], err) == utf8::quick_check_result::yes)
+                ASSERT_EQ(res.first, c[0]);
+            if (!normalized)
+                ASSERT_NE(utf8::quick_check(c[0], end, forms[i], err),
+                          utf8::quick_check_result::yes);
+        }
+    }
+
+    std::string invalid = "abc\xC3";
+    auto res = utf8::normalize(invalid.data(), invalid.data() + invalid.size(),
+                               utf8::normalization_form::nfc, buffer, err);
+    ASSERT_EQ(err, utf8::error_code::incomplete_sequence);
+    ASSERT_EQ(res.first, res.second);
+
+    // normalizing twice does not change anything, decomposing the compositions gets back the
+    // decompositions. Only the stretches around the codepoints that don't pass the quick
+    // check are normalized, mixing in ascii keeps them apart.
+    std::mt19937 rng(23);
+    for (int i = 0; i < 500; ++i)
+    {
+        std::string s = random_utf8(rng, rng() % 40, false);
+        for (std::size_t j = 0; j < 5; ++j)
+        {
+            std::size_t pos = rng() % (s.size() + 1);
+            while (pos < s.size() && (s[pos] & 0xC0) == 0x80)
+                ++pos;
+            s.insert(pos, i % 2 ? "e\xCC\x81\xCC\xA3" : " ");
+        }
+        for (utf8::normalization_form form : forms)
+        {
+            std::string n = utf8::normalize(s, form, err);
+            ASSERT_FALSE(err);
+            ASSERT_TRUE(utf8::is_normalized(n.data(), n.data() + n.size(), form, err));
+            ASSERT_EQ(utf8::normalize(n, form, err), n);
+        }
+        std::string nfd = utf8::normalize(s, utf8::normalization_form::nfd, err);
+        std::string nfc = utf8::normalize(s, utf8::normalization_form::nfc, err);
+        ASSERT_EQ(utf8::normalize(nfc, utf8::normalization_form::nfd, err), nfd);
+        ASSERT_EQ(utf8::normalize(nfd, utf8::normalization_form::nfc, err), nfc);
+    }
+}
+
+TEST(utf8er, case_mapping)
+{
+    // the input followed by its lower case, upper case and case folding.
+    const char * cases[][4] = {
+        { "The Quick Brown Fox Jumps Over The Lazy Dog, 0123456789 @[`{",
+          "the quick brown fox jumps over the lazy dog, 0123456789 @[`{",
+          "THE QUICK BROWN FOX JUMPS OVER THE LAZY DOG, 0123456789 @[`{",
+          "the quick brown fox jumps over the lazy dog, 0123456789 @[`{" },
+        { "Stra\xC3\x9F" "e", "stra\xC3\x9F" "e", "STRASSE", "strasse" },
+        { "\xC4\xB0stanbul", "i\xCC\x87stanbul", "\xC4\xB0STANBUL", "i\xCC\x87stanbul" },
+        { "\xCE\x90", "\xCE\x90", "\xCE\x99\xCC\x88\xCC\x81", "\xCE\xB9\xCC\x88\xCC\x81" },
+        { "\xC8\xBA\xC8\xBE",
+          "\xE2\xB1\xA5\xE2\xB1\xA6",
+          "\xC8\xBA\xC8\xBE",
+          "\xE2\xB1\xA5\xE2\xB1\xA6" },
+        { "\xEF\xAC\x83 caf\xC3\xA9", "\xEF\xAC\x83 caf\xC3\xA9", "FFI CAF\xC3\x89", "ffi caf\xC3\xA9" },
+        { "\xD0\x9F\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82",
+          "\xD0\xBF\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82",
+          "\xD0\x9F\xD0\xA0\xD0\x98\xD0\x92\xD0\x95\xD0\xA2",
+          "\xD0\xBF\xD1\x80\xD0\xB8\xD0\xB2\xD0\xB5\xD1\x82" },
+        { "\xF0\x90\x90\x80\xF0\x90\x90\xA8",
+          "\xF0\x90\x90\xA8\xF0\x90\x90\xA8",
+          "\xF0\x90\x90\x80\xF0\x90\x90\x80",
+          "\xF0\x90\x90\xA8\xF0\x90\x90\xA8" },
+        { "\xC7\x85", "\xC7\x86", "\xC7\x84", "\xC7\x86" },
+        { "\xE1\xBA\x9E", "\xC3\x9F", "\xE1\xBA\x9E", "ss" },
+        // a capital sigma at the end of a word lower cases to the final sigma, skipping case
+        // ignorable codepoints (like the combining acute accent and the full stop) to find it.
+        { "\xCE\xA3\xCE\x91\xCE\xA3",
+          "\xCF\x83\xCE\xB1\xCF\x82",
+          "\xCE\xA3\xCE\x91\xCE\xA3",
+          "\xCF\x83\xCE\xB1\xCF\x83" },
+        { "\xCE\x9F\xCE\x94\xCE\x9F\xCE\xA3",
+          "\xCE\xBF\xCE\xB4\xCE\xBF\xCF\x82",
+          "\xCE\x9F\xCE\x94\xCE\x9F\xCE\xA3",
+          "\xCE\xBF\xCE\xB4\xCE\xBF\xCF\x83" },
+        { "\xCE\x91\xCC\x81\xCE\xA3. A\xCE\xA3 b",
+          "\xCE\xB1\xCC\x81\xCF\x82. a\xCF\x82 b",
+          "\xCE\x91\xCC\x81\xCE\xA3. A\xCE\xA3 B",
+          "\xCE\xB1\xCC\x81\xCF\x83. a\xCF\x83 b" },
+        { "\xC4\xB0\xCE\xA3", "i\xCC\x87\xCF\x82", "\xC4\xB0\xCE\xA3", "i\xCC\x87\xCF\x83" },
+        // in the middle of a word and on its own, it does not.
+        { "\xCE\x91\xCE\xA3\xCE\x91",
+          "\xCE\xB1\xCF\x83\xCE\xB1",
+          "\xCE\x91\xCE\xA3\xCE\x91",
+          "\xCE\xB1\xCF\x83\xCE\xB1" },
+        { "\xCE\x91\xCE\xA3\xCC\x81\xCE\x91",
+          "\xCE\xB1\xCF\x83\xCC\x81\xCE\xB1",
+          "\xCE\x91\xCE\xA3\xCC\x81\xCE\x91",
+          "\xCE\xB1\xCF\x83\xCC\x81\xCE\xB1" },
+        { "\xCE\xA3", "\xCF\x83", "\xCE\xA3", "\xCF\x83" },
+        { "1 \xCE\xA3.", "1 \xCF\x83.", "1 \xCE\xA3.", "1 \xCF\x83." },
+    };
+    using map_fn = std::string (*)(const std::string &, utf8::error_report &);
+    using in_place_fn = char * (*)(char *, char *, utf8::error_report &);
+    using in_place_str_fn = void (*)(std::string &, utf8::error_report &);
+    const map_fn maps[] = { utf8::to_lower, utf8::to_upper, utf8::fold_case };
+    const in_place_fn in_place[] = {
+        utf8::to_lower_in_place, utf8::to_upper_in_place, utf8::fold_case_in_place
+    };
+    const in_place_str_fn in_place_str[] = {
+        utf8::to_lower_in_place, utf8::to_upper_in_place, utf8::fold_case_in_place
+    };
+    utf8::error_report err;
+    for (const auto & c : cases)
+    {
+        for (int i = 0; i < 3; ++i)
+        {
+            ASSERT_EQ(maps[i](c[0], err), std::string(c[i + 1]));
+            ASSERT_FALSE(err);
+
+            std::string s = c[0];
+            in_place_str[i](s, err);
+            ASSERT_EQ(s, std::string(c[i + 1]));
+
+            // stops in front of the first codepoint whose mapping has a different length.
+            s = c[0];
+            char * stop = in_place[i](&s[0], &s[0] + s.size(), err);
+            std::size_t mapped = static_cast<std::size_t>(stop - s.data());
+            ASSERT_EQ(s.substr(0, mapped), std::string(c[i + 1]).substr(0, mapped));
+            if (mapped == s.size())
+                ASSERT_EQ(s, std::string(c[i + 1]));
+            else
+                ASSERT_NE(maps[i](s.substr(mapped, 4), err).size(), s.substr(mapped, 4).size());
+        }
+    }
+
+    std::string invalid = "ABC\xC3";
+    char out[12];
+    ASSERT_EQ(utf8::to_lower(invalid.data(), invalid.data() + invalid.size(), out, err), out);
+    ASSERT_EQ(err, utf8::error_code::incomplete_sequence);
+    utf8::to_upper_in_place(invalid, err);
+    ASSERT_EQ(err, utf8::error_code::incomplete_sequence);
+    ASSERT_EQ(invalid, "ABC\xC3");
+
+    // mapping a whole string (and the SIMD ascii path stopping at every position of a block)
+    // gives the same as mapping every codepoint on its own, apart from the final sigma.
+    std::mt19937 rng(24);
+    for (int i = 0; i < 300; ++i)
+    {
+        std::string s = random_utf8(rng, rng() % 80, false);
+        for (size_t sigma; (sigma = s.find("\xCE\xA3")) != std::string::npos;)
+            s.erase(sigma, 2);
+        for (int j = 0; j < 3; ++j)
+        {
+            std::string expected;
+            for (auto it = s.begin(); it != s.end();)
+            {
+                auto next = utf8::next(it);
+                expected += maps[j](std::string(it, next), err);
+                it = next;
+            }
+            ASSERT_EQ(maps[j](s, err), expected);
+            std::string mapped = s;
+            in_place_str[j](mapped, err);
+            ASSERT_EQ(mapped, expected);
+        }
+    }
+}
+
+TEST(utf8er, graphemes)
+{
+    // a string followed by the byte lengths of its grapheme clusters.
+    struct grapheme_case
+    {
+        const char * str;
+        std::vector<std::size_t> lengths;
+    };
+    const grapheme_case cases[] = {
+        { "abc", { 1, 1, 1 } },
+        // CR LF, controls.
+        { "a\r\n\r\nb\n\r", { 1, 2, 2, 1, 1, 1 } },
+        // combining marks, also after ascii and behind a run of ascii.
+        { "e\xCC\x81x\xCC\x88\xCC\x88!", { 3, 5, 1 } },
+        { "abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyz\xCC\x81",
+          { 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+            1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3 } },
+        // hangul syllables made of jamo.
+        { "\xE1\x84\x80\xE1\x85\xA1\xE1\x86\xA8\xE1\x84\x80", { 9, 3 } },
+        // family emoji zwj sequence, a skin tone modifier and a zwj without emoji in front.
+        { "\xF0\x9F\x91\xA8\xE2\x80\x8D\xF0\x9F\x91\xA9\xE2\x80\x8D\xF0\x9F\x91\xA7"
+          "\xF0\x9F\x91\x8D\xF0\x9F\x8F\xBD"
+          "a\xE2\x80\x8D\xF0\x9F\x91\xA7",
+          { 18, 8, 4, 4 } },
+        // flags pair up regional indicators.
+        { "\xF0\x9F\x87\xA9\xF0\x9F\x87\xAA\xF0\x9F\x87\xBA\xF0\x9F\x87\xB8\xF0\x9F\x87\xAB",
+          { 8, 8, 4 } },
+        // spacing mark and prepend.
+        { "\xE0\xA4\x95\xE0\xA4\xBF\xD8\x80" "1", { 6, 3 } },
+    };
+    for (const auto & c : cases)
+    {
+        std::string str = c.str;
+        ASSERT_EQ(utf8::count_graphemes(str.begin(), str.end()), c.lengths.size());
+        std::deque<char> deq(str.begin(), str.end());
+        ASSERT_EQ(utf8::count_graphemes(deq.begin(), deq.end()), c.lengths.size());
+
+        auto it = str.begin();
+        for (std::size_t length : c.lengths)
+        {
+            auto next = utf8::next_grapheme(it, str.end());
+            ASSERT_EQ((std::size_t)(next - it), length);
+            it = next;
+        }
+        for (auto len = c.lengths.rbegin(); len != c.lengths.rend(); ++len)
+        {
+            auto previous = utf8::previous_grapheme(it, str.begin());
+            ASSERT_EQ((std::size_t)(it - previous), *len);
+            it = previous;
+        }
+    }
+
+    // stepping back and forth through random text finds the same boundaries.
+    std::mt19937 rng(25);
+    for (int i = 0; i < 300; ++i)
+    {
+        std::string s = random_utf8(rng, rng() % 60, false);
+        std::vector<std::string::iterator> forward;
+        for (auto it = s.begin(); it != s.end(); forward.push_back(it))
+            it = utf8::next_grapheme(it, s.end());
+        std::vector<std::string::iterator> backward;
+        for (auto it = s.end(); it != s.begin(); it = utf8::previous_grapheme(it, s.begin()))
+            backward.push_back(it);
+        std::reverse(backward.begin(), backward.end());
+        ASSERT_TRUE(forward == backward);
+        ASSERT_EQ(utf8::count_graphemes(s.data(), s.data() + s.size()), forward.size());
+    }
+}
+
 TEST(utf8er, encode_range_safe)
 {
     std::vector<utf8::uint32_t> input = { 0xCAC, 0xCBE, 0x20, 0xC87, 0xCB2, 0xCCD, 0xCB2, 0xCBF, 0x20, 0xCB8, 0xC82, 0xCAD, 0xCB5, 0xCBF, 0xCB8, 0xCC1 };
@@ -0,0 +1,353 @@
+#!/usr/bin/env python3
+# generates utf8er/utf8er_unicode_data.hpp, the tables used by utf8er/utf8er_unicode.hpp, from the
+# unicode database that ships with python (unicodedata and the case mappings of str). unicodedata
+# lacks the cased, case ignorable, grapheme cluster break and extended pictographic properties,
+# they are taken from the unicode database of perl (Unicode::UCD), which has to be of the same
+# unicode version. Run it from the repository root with the python version whose unicode version
+# the tables should have:
+#
+#   python3 tools/generate_unicode_data.py > utf8er/utf8er_unicode_data.hpp
+
+import subprocess
+import sys
+import unicodedata as ud
+
+# no codepoint at or above this has any of the properties in the tables below.
+LIMIT = 0x30000
+
+# codepoints per block of the two stage tables.
+SHIFT = 6
+
+S_BASE, L_BASE, V_BASE, T_BASE = 0xAC00, 0x1100, 0x1161, 0x11A7
+L_COUNT, V_COUNT, T_COUNT = 19, 21, 28
+S_COUNT = L_COUNT * V_COUNT * T_COUNT
+
+
+def is_hangul_syllable(cp):
+    return S_BASE <= cp < S_BASE + S_COUNT
+
+
+def is_hangul_vt(cp):
+    return V_BASE <= cp < V_BASE + V_COUNT or T_BASE < cp < T_BASE + T_COUNT
+
+
+def normalize(form, cps):
+    return [ord(c) for c in ud.normalize(form, ''.join(chr(cp) for cp in cps))]
+
+
+def two_stage(values, limit):
+    # splits values into blocks of 1 << SHIFT entries and stores every distinct block once.
+    size = 1 << SHIFT
+    blocks = {}
+    stage1 = []
+    stage2 = []
+    for start in range(0, limit, size):
+        block = tuple(values[start:start + size])
+        if block not in blocks:
+            blocks[block] = len(blocks)
+            stage2.extend(block)
+        stage1.append(blocks[block])
+    return stage1, stage2
+
+
+def emit_array(out, ctype, name, values):
+    out.append('template <class T>')
+    out.append('const %s _unicode_data<T>::%s[] = {' % (ctype, name))
+    line = '   '
+    for v in values:
+        item = ' %d,' % v
+        if len(line) + len(item) > 100:
+            out.append(line)
+            line = '   '
+        line += item
+    out.append(line)
+    out.append('};')
+    out.append('')
+
+
+def normalization_tables():
+    # primary composites, i.e. the pairs that compose during NFC.
+    pairs = {}
+    for cp in range(LIMIT):
+        d = ud.decomposition(chr(cp))
+        if not d or d.startswith('<'):
+            continue
+        parts = [int(x, 16) for x in d.split()]
+        if len(parts) == 2 and normalize('NFC', [cp]) == [cp]:
+            pairs[(parts[0], parts[1])] = cp
+    second = set(p[1] for p in pairs)
+
+    props = [0] * LIMIT
+    canonical = []
+    compat = []
+    for cp in range(LIMIT):
+        ccc = ud.combining(chr(cp))
+        nfd = normalize('NFD', [cp])
+        nfkd = normalize('NFKD', [cp])
+        maybe = cp in second or is_hangul_vt(cp)
+        nfc_qc = 2 if normalize('NFC', [cp]) != [cp] else 1 if maybe else 0
+        nfkc_qc = 2 if normalize('NFKC', [cp]) != [cp] else 1 if maybe else 0
+        value = ccc | nfc_qc << 8 | nfkc_qc << 10
+        if nfd != [cp]:
+            value |= 1 << 12
+            if not is_hangul_syllable(cp):
+                canonical.append((cp, nfd))
+        if nfkd != nfd:
+            value |= 1 << 13
+            compat.append((cp, nfkd))
+        props[cp] = value
+
+        # the quick check of a single codepoint has to agree with python.
+        for form, qc in (('NFC', nfc_qc), ('NFKC', nfkc_qc)):
+            assert (qc == 2) == (not ud.is_normalized(form, chr(cp))), (form, hex(cp))
+        assert (nfd != [cp]) == (not ud.is_normalized('NFD', chr(cp)))
+        assert (nfkd != [cp]) == (not ud.is_normalized('NFKD', chr(cp)))
+
+    out = []
+    stage1, stage2 = two_stage(props, LIMIT)
+    assert max(stage1) < 256
+    emit_array(out, 'uint8_t', 'normalization_stage1', stage1)
+    emit_array(out, 'uint16_t', 'normalization_stage2', stage2)
+
+    # sorted by codepoint, every entry is codepoint << 14 | offset into the pool. The length
+    # follows from the offset of the next entry, the last entry only marks the end of the pool.
+    for name, entries in (('canonical', canonical), ('compat', compat)):
+        keys = []
+        pool = []
+        for cp, d in entries:
+            keys.append(cp << 14 | len(pool))
+            pool.extend(d)
+        assert len(pool) < 1 << 14
+        keys.append(LIMIT << 14 | len(pool))
+        emit_array(out, 'uint32_t', name + '_decompositions', keys)
+        emit_array(out, 'uint32_t', name + '_pool', pool)
+
+    # sorted by first and second codepoint, followed by the composite.
+    composites = []
+    for (first, second), cp in sorted(pairs.items()):
+        composites.extend((first, second, cp))
+    emit_array(out, 'uint32_t', 'composites', composites)
+
+    members = [
+        ('uint8_t', 'normalization_stage1'),
+        ('uint16_t', 'normalization_stage2'),
+        ('uint32_t', 'canonical_decompositions'),
+        ('uint32_t', 'canonical_pool'),
+        ('uint32_t', 'compat_decompositions'),
+        ('uint32_t', 'compat_pool'),
+        ('uint32_t', 'composites'),
+    ]
+    sizes = {
+        'canonical_count': len(canonical),
+        'compat_count': len(compat),
+        'composite_count': len(pairs),
+    }
+    return members, sizes, out
+
+
+# case mappings with more than one codepoint are marked by this bit, everything below it is the
+# difference between the mapped codepoint and the codepoint.
+CASE_EXPANSION = 1 << 24
+
+# the bits of the fourth column of the case records, the properties the final sigma rule looks at.
+CASED = 1
+CASE_IGNORABLE = 2
+
+
+def invlist_flags(invlist, flag, flags):
+    # sets flag in flags for the codepoints of an inversion list (the starts of the ranges that
+    # have the property, alternating with the starts of those that don't).
+    for i in range(0, len(invlist), 2):
+        end = invlist[i + 1] if i + 1 < len(invlist) else 0x110000
+        for cp in range(invlist[i], end):
+            flags[cp] |= flag
+
+
+def case_tables(perl):
+    flags = [0] * 0x110000
+    invlist_flags([int(x) for x in perl[3].split()], CASED, flags)
+    invlist_flags([int(x) for x in perl[4].split()], CASE_IGNORABLE, flags)
+
+    # the final sigma rule looks at the last codepoint in front of a sigma that is not case
+    # ignorable, which utf8er/utf8er_unicode.hpp expects to not change when lower cased in place.
+    def last_cased(s):
+        for c in reversed(s):
+            if not flags[ord(c)] & CASE_IGNORABLE:
+                return flags[ord(c)] & CASED
+        return None
+
+    for cp in range(0x110000):
+        if not 0xD800 <= cp < 0xE000:
+            assert last_cased(chr(cp).lower()) == last_cased(chr(cp)), hex(cp)
+
+    # above the table, only the tags and variation selectors of plane 14 are case ignorable, which
+    # utf8er/utf8er_unicode.hpp knows.
+    for cp in range(LIMIT, 0x110000):
+        ignorable = cp == 0xE0001 or 0xE0020 <= cp < 0xE0080 or 0xE0100 <= cp < 0xE01F0
+        assert flags[cp] == (CASE_IGNORABLE if ignorable else 0), hex(cp)
+
+    # the full case mappings without the conditional ones of SpecialCasing.txt, str.lower() only
+    # applies the final sigma rule to strings of more than one codepoint. The first two records are
+    # the ones of the codepoints above the table.
+    mappings = {(0, 0, 0, 0): 0, (0, 0, 0, CASE_IGNORABLE): 1}
+    props = [0] * LIMIT
+    pool = []
+    expansions = {}
+    for cp in range(0x110000):
+        c = chr(cp)
+        record = []
+        for mapped in (c.lower(), c.upper(), c.casefold()):
+            if len(mapped) == 1:
+                record.append(ord(mapped) - cp)
+                continue
+            if mapped not in expansions:
+                expansions[mapped] = CASE_EXPANSION | len(pool) << 2 | len(mapped)
+                pool.extend(ord(x) for x in mapped)
+            record.append(expansions[mapped])
+        # the flags above the table were checked above.
+        record = tuple(record + [flags[cp] if cp < LIMIT else 0])
+        if record == (0, 0, 0, 0):
+            continue
+        assert cp < LIMIT, hex(cp)
+        # in place mapping relies on the output of a codepoint never being more than three times
+        # as long.
+        size = len(c.encode('utf-8', 'surrogatepass'))
+        for mapped in (c.lower(), c.upper(), c.casefold()):
+            assert len(mapped.encode('utf-8')) <= 3 * size
+        props[cp] = mappings.setdefault(record, len(mappings))
+
+    out = []
+    stage1, stage2 = two_stage(props, LIMIT)
+    assert max(stage1) < 256 and len(mappings) < 1 << 16 and len(pool) < 1 << 20
+    emit_array(out, 'uint8_t', 'case_stage1', stage1)
+    emit_array(out, 'uint16_t', 'case_stage2', stage2)
+    # the lower, upper and folded mapping and the flags of every distinct record.
+    records = sorted(mappings, key=lambda r: mappings[r])
+    emit_array(out, 'int32_t', 'case_mappings', [v for r in records for v in r])
+    emit_array(out, 'uint32_t', 'case_pool', pool)
+
+    members = [
+        ('uint8_t', 'case_stage1'),
+        ('uint16_t', 'case_stage2'),
+        ('int32_t', 'case_mappings'),
+        ('uint32_t', 'case_pool'),
+    ]
+    return members, out
+
+
+# the grapheme cluster break values in the order of the constants in utf8er/utf8er_unicode.hpp,
+# extended pictographic codepoints have GRAPHEME_PICTOGRAPHIC set in addition.
+GRAPHEME_BREAKS = ['Other', 'CR', 'LF', 'Control', 'Extend', 'ZWJ', 'Regional_Indicator',
+                   'Prepend', 'SpacingMark', 'L', 'V', 'T', 'LV', 'LVT']
+GRAPHEME_PICTOGRAPHIC = 16
+
+PERL_PROPERTIES = r"""
+use Unicode::UCD qw(prop_invmap prop_invlist);
+print Unicode::UCD::UnicodeVersion(), "\n";
+my ($starts, $values) = prop_invmap('Grapheme_Cluster_Break');
+print join(' ', map { "$starts->[$_]:$values->[$_]" } 0 .. $#$starts), "\n";
+print join(' ', prop_invlist('Extended_Pictographic')), "\n";
+print join(' ', prop_invlist('Cased')), "\n";
+print join(' ', prop_invlist('Case_Ignorable')), "\n";
+"""
+
+
+def perl_properties():
+    # the lines printed by PERL_PROPERTIES.
+    lines = subprocess.check_output(['perl', '-e', PERL_PROPERTIES]).decode().split('\n')
+    assert lines[0] == ud.unidata_version, (lines[0], ud.unidata_version)
+    return lines
+
+
+def expand_ranges(starts, values):
+    # turns an inversion map (the start of every range and its value) into one value per codepoint.
+    ret = []
+    for i, start in enumerate(starts):
+        end = starts[i + 1] if i + 1 < len(starts) else 0x110000
+        ret.extend([values[i]] * (end - start))
+    return ret
+
+
+def grapheme_tables(lines):
+    ranges = [item.split(':') for item in lines[1].split()]
+    # perl merges extended pictographic into the values of codepoints that are Other otherwise.
+    breaks = expand_ranges([int(start) for start, _ in ranges],
+                           [GRAPHEME_BREAKS.index(value.replace('ExtPict_XX', 'Other'))
+                            for _, value in ranges])
+    props = breaks
+    invlist_flags([int(x) for x in lines[2].split()], GRAPHEME_PICTOGRAPHIC, props)
+
+    # above the table, only the first 4096 codepoints of plane 14 have properties, which
+    # utf8er/utf8er_unicode.hpp knows.
+    extend, control = GRAPHEME_BREAKS.index('Extend'), GRAPHEME_BREAKS.index('Control')
+    for cp in range(LIMIT, 0x110000):
+        expected = 0
+        if cp >> 12 == 0xE0:
+            expected = extend if 0xE0020 <= cp < 0xE0080 or 0xE0100 <= cp < 0xE01F0 else control
+        assert props[cp] == expected, hex(cp)
+
+    out = []
+    stage1, stage2 = two_stage(props[:LIMIT], LIMIT)
+    assert max(stage1) < 256
+    emit_array(out, 'uint8_t', 'grapheme_stage1', stage1)
+    emit_array(out, 'uint8_t', 'grapheme_stage2', stage2)
+    members = [
+        ('uint8_t', 'grapheme_stage1'),
+        ('uint8_t', 'grapheme_stage2'),
+    ]
+    return members, out
+
+
+HEADER = """// generated by tools/generate_unicode_data.py (unicode %s), do not edit.
+// license: public domain, see utf8er/utf8er.hpp.
+
+#ifndef UTF8ER_UTF8ER_UNICODE_DATA_HPP
+#define UTF8ER_UTF8ER_UNICODE_DATA_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace utf8er
+{
+namespace detail
+{
+
+// the tables as static members of a template, so that they exist once across translation units.
+template <class T = void>
+struct _unicode_data
+{
+    // no codepoint at or above limit has any of the properties below.
+    static constexpr std::uint32_t limit = 0x%X;
+    // the two stage tables are made of blocks of 1 << shift codepoints.
+    static constexpr std::uint32_t shift = %d;
+    // case mappings at or above this bit are made of more than one codepoint.
+    static constexpr std::int32_t case_expansion = 0x%X;
+"""
+
+
+def main():
+    members, sizes, arrays = normalization_tables()
+    perl = perl_properties()
+    for tables in (case_tables, grapheme_tables):
+        more_members, more_arrays = tables(perl)
+        members += more_members
+        arrays += more_arrays
+    out = [HEADER % (ud.unidata_version, LIMIT, SHIFT, CASE_EXPANSION)]
+    for name, value in sizes.items():
+        out.append('    static constexpr std::size_t %s = %d;' % (name, value))
+    out.append('')
+    for ctype, name in members:
+        out.append('    static const std::%s %s[];' % (ctype, name))
+    out.append('};')
+    out.append('')
+    for line in arrays:
+        line = line.replace('const uint', 'const std::uint')
+        out.append(line.replace('const int', 'const std::int'))
+    out.append('} // namespace detail')
+    out.append('} // namespace utf8er')
+    out.append('')
+    out.append('#endif // UTF8ER_UTF8ER_UNICODE_DATA_HPP')
+    print('\n'.join(out))
+
+
+main()
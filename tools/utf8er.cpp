@@ -0,0 +1,469 @@
+// command line tool to validate, count, transcode and sanitize utf8 files. Input files are
+// memory mapped and handed to the library as a whole, multiple files are processed in parallel.
+
+#include <utf8er/utf8er.hpp>
+#include <utf8er/utf8er_parallel.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <fcntl.h>
+#include <io.h>
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace utf8 = utf8er;
+
+namespace
+{
+
+// read only memory mapping of a whole file.
+class mapped_file
+{
+  public:
+    mapped_file() : m_data(nullptr), m_size(0)
+    {
+    }
+
+    mapped_file(const mapped_file &) = delete;
+    mapped_file & operator=(const mapped_file &) = delete;
+
+    ~mapped_file()
+    {
+        close();
+    }
+
+    // maps the file at _path. Returns false and sets _out_error on failure.
+    bool open(const char * _path, std::string & _out_error)
+    {
+#if defined(_WIN32)
+        HANDLE file = CreateFileA(_path,
+                                  GENERIC_READ,
+                                  FILE_SHARE_READ,
+                                  nullptr,
+                                  OPEN_EXISTING,
+                                  FILE_FLAG_SEQUENTIAL_SCAN,
+                                  nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            _out_error = "could not open file";
+            return false;
+        }
+        LARGE_INTEGER size;
+        GetFileSizeEx(file, &size);
+        m_size = static_cast<size_t>(size.QuadPart);
+        if (m_size)
+        {
+            HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+            if (mapping)
+            {
+                m_data = static_cast<const char *>(
+                    MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+                CloseHandle(mapping);
+            }
+        }
+        CloseHandle(file);
+#else
+        int fd = ::open(_path, O_RDONLY);
+        if (fd < 0)
+        {
+            _out_error = "could not open file";
+            return false;
+        }
+        struct stat st;
+        if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode))
+        {
+            ::close(fd);
+            _out_error = "not a regular file";
+            return false;
+        }
+        m_size = static_cast<size_t>(st.st_size);
+        if (m_size)
+        {
+            void * data = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (data != MAP_FAILED)
+            {
+                madvise(data, m_size, MADV_SEQUENTIAL);
+                m_data = static_cast<const char *>(data);
+            }
+        }
+        ::close(fd);
+#endif
+        if (m_size && !m_data)
+        {
+            _out_error = "could not map file";
+            m_size = 0;
+            return false;
+        }
+        return true;
+    }
+
+    void close()
+    {
+        if (!m_data)
+            return;
+#if defined(_WIN32)
+        UnmapViewOfFile(m_data);
+#else
+        munmap(const_cast<char *>(m_data), m_size);
+#endif
+        m_data = nullptr;
+        m_size = 0;
+    }
+
+    const char * data() const
+    {
+        return m_data;
+    }
+
+    size_t size() const
+    {
+        return m_size;
+    }
+
+  private:
+    const char * m_data;
+    size_t m_size;
+};
+
+enum class command
+{
+    validate,
+    count,
+    utf32,
+    utf16,
+    sanitize
+};
+
+struct options
+{
+    command cmd;
+    std::vector<const char *> files;
+    const char * output = nullptr;
+    size_t threads = 0;
+    bool quiet = false;
+};
+
+// the result of processing a single file, printed in the order of the files once all are done.
+struct file_result
+{
+    bool ok = true;
+    std::string message;
+    size_t count = 0;
+};
+
+// transcoding works in blocks of this many bytes so that the output buffer stays small.
+static constexpr size_t block_size = 1 << 24;
+
+void print_usage()
+{
+    std::fprintf(stderr,
+                 "usage: utf8er <command> [options] <file>...\n"
+                 "\n"
+                 "commands:\n"
+                 "  validate   checks that the files are valid utf8\n"
+                 "  count      prints the number of codepoints of each file (like wc -m)\n"
+                 "  utf32      transcodes the files to utf32 in native byte order\n"
+                 "  utf16      transcodes the files to utf16 in native byte order\n"
+                 "  sanitize   replaces invalid sequences with U+FFFD\n"
+                 "\n"
+                 "options:\n"
+                 "  -j <n>     number of threads (default: one per hardware thread)\n"
+                 "  -o <file>  writes the output to <file> instead of stdout\n"
+                 "  -q         only prints invalid files (validate)\n");
+}
+
+bool parse_options(int _argc, char ** _argv, options & _out_options)
+{
+    if (_argc < 2)
+        return false;
+
+    std::string cmd = _argv[1];
+    if (cmd == "validate")
+        _out_options.cmd = command::validate;
+    else if (cmd == "count")
+        _out_options.cmd = command::count;
+    else if (cmd == "utf32")
+        _out_options.cmd = command::utf32;
+    else if (cmd == "utf16")
+        _out_options.cmd = command::utf16;
+    else if (cmd == "sanitize")
+        _out_options.cmd = command::sanitize;
+    else
+        return false;
+
+    for (int i = 2; i < _argc; ++i)
+    {
+        std::string arg = _argv[i];
+        if (arg == "-j" && i + 1 < _argc)
+            _out_options.threads = std::strtoul(_argv[++i], nullptr, 10);
+        else if (arg == "-o" && i + 1 < _argc)
+            _out_options.output = _argv[++i];
+        else if (arg == "-q")
+            _out_options.quiet = true;
+        else if (arg.size() > 1 && arg[0] == '-')
+            return false;
+        else
+            _out_options.files.push_back(_argv[i]);
+    }
+    return !_out_options.files.empty();
+}
+
+std::string error_string(utf8::error_code _code, size_t _offset)
+{
+    return std::string(utf8::error_message(_code)) + " at byte " + std::to_string(_offset);
+}
+
+// moves _end back to the start of the sequence it points into, so that a block ending there does
+// not cut a sequence in two.
+const char * block_end(const char * _begin, const char * _end)
+{
+    for (int i = 0; i < 3 && _end != _begin && (*_end & 0xC0) == 0x80; ++i)
+        --_end;
+    return _end;
+}
+
+bool write_all(std::FILE * _out, const void * _data, size_t _size)
+{
+    return std::fwrite(_data, 1, _size, _out) == _size;
+}
+
+file_result validate_file(const mapped_file & _file, size_t _threads)
+{
+    file_result result;
+    auto res = utf8::validate_parallel(_file.data(), _file.size(), _threads);
+    if (res.first)
+    {
+        result.ok = false;
+        result.message = error_string(res.first.code, res.second - _file.data());
+    }
+    return result;
+}
+
+file_result count_file(const mapped_file & _file)
+{
+    file_result result;
+    result.count = utf8::distance(_file.data(), _file.data() + _file.size());
+    return result;
+}
+
+file_result transcode_file(const mapped_file & _file, command _cmd, std::FILE * _out)
+{
+    file_result result;
+    std::vector<uint32_t> utf32;
+    std::vector<uint16_t> utf16;
+    if (_cmd == command::utf16)
+        utf16.resize(block_size);
+    else
+        utf32.resize(block_size);
+
+    const char * it = _file.data();
+    const char * end = it + _file.size();
+    while (it != end)
+    {
+        const char * stop = end;
+        if (static_cast<size_t>(end - it) > block_size)
+            stop = block_end(it, it + block_size);
+
+        utf8::transcode_result res;
+        bool written;
+        if (_cmd == command::utf32)
+        {
+            res = utf8::transcode_to_utf32(it, static_cast<size_t>(stop - it), utf32.data());
+            written = write_all(_out, utf32.data(), res.produced * sizeof(uint32_t));
+        }
+        else
+        {
+            res = utf8::utf8_to_utf16(it, static_cast<size_t>(stop - it), utf16.data());
+            written = write_all(_out, utf16.data(), res.produced * sizeof(uint16_t));
+        }
+
+        if (!written)
+        {
+            result.ok = false;
+            result.message = "could not write output";
+            return result;
+        }
+        if (res.error)
+        {
+            // a sequence cut off at the end of a block is checked against the rest of the file,
+            // so that the error is the same the library reports for the whole file.
+            utf8::error_report err = res.error;
+            if (err.code == utf8::error_code::incomplete_sequence && stop != end)
+            {
+                err = utf8::error_report();
+                utf8::decode_safe(it + res.consumed, end, err);
+                if (!err)
+                    err = res.error;
+            }
+            result.ok = false;
+            result.message = error_string(err.code, (it - _file.data()) + res.consumed);
+            return result;
+        }
+        it = stop;
+    }
+    return result;
+}
+
+// writes valid blocks straight from the mapping, only blocks with invalid sequences are copied
+// to a buffer by sanitize.
+file_result sanitize_file(const mapped_file & _file, size_t _threads, std::FILE * _out)
+{
+    file_result result;
+    std::vector<char> buffer;
+    std::vector<size_t> errors;
+    const char * it = _file.data();
+    const char * end = it + _file.size();
+    while (it != end)
+    {
+        const char * stop = end;
+        if (static_cast<size_t>(end - it) > block_size)
+            stop = block_end(it, it + block_size);
+
+        bool written;
+        if (!utf8::validate_parallel(it, static_cast<size_t>(stop - it), _threads).first)
+        {
+            written = write_all(_out, it, static_cast<size_t>(stop - it));
+        }
+        else
+        {
+            // every replaced byte turns into three at most.
+            buffer.resize(static_cast<size_t>(stop - it) * 3);
+            errors.clear();
+            char * out = utf8::sanitize(it, stop, buffer.data(), &errors);
+            result.count += errors.size();
+            written = write_all(_out, buffer.data(), static_cast<size_t>(out - buffer.data()));
+        }
+
+        if (!written)
+        {
+            result.ok = false;
+            result.message = "could not write output";
+            return result;
+        }
+        it = stop;
+    }
+    return result;
+}
+
+} // namespace
+
+int main(int _argc, char ** _argv)
+{
+    options opts;
+    if (!parse_options(_argc, _argv, opts))
+    {
+        print_usage();
+        return 2;
+    }
+
+    size_t threads = opts.threads ? opts.threads : std::thread::hardware_concurrency();
+    threads = std::max<size_t>(1, threads);
+
+    std::FILE * out = stdout;
+    if (opts.output)
+    {
+        out = std::fopen(opts.output, "wb");
+        if (!out)
+        {
+            std::fprintf(stderr, "utf8er: could not open %s for writing\n", opts.output);
+            return 2;
+        }
+    }
+#if defined(_WIN32)
+    else
+    {
+        _setmode(_fileno(stdout), _O_BINARY);
+    }
+#endif
+
+    std::vector<file_result> results(opts.files.size());
+    bool transcodes = opts.cmd == command::utf32 || opts.cmd == command::utf16 ||
+                      opts.cmd == command::sanitize;
+
+    // validate and count process the files in parallel. The threads left over split up the
+    // individual files. The output of the other commands is written in order, so they process
+    // one file after the other with all threads.
+    size_t file_threads = transcodes ? 1 : std::min(threads, opts.files.size());
+    size_t threads_per_file = std::max<size_t>(1, threads / file_threads);
+    std::atomic<size_t> next(0);
+    auto worker = [&]() {
+        for (size_t i = next++; i < opts.files.size(); i = next++)
+        {
+            mapped_file file;
+            file_result & result = results[i];
+            if (!file.open(opts.files[i], result.message))
+            {
+                result.ok = false;
+                continue;
+            }
+
+            switch (opts.cmd)
+            {
+            case command::validate:
+                result = validate_file(file, threads_per_file);
+                break;
+            case command::count:
+                result = count_file(file);
+                break;
+            case command::utf32:
+            case command::utf16:
+                result = transcode_file(file, opts.cmd, out);
+                break;
+            case command::sanitize:
+                result = sanitize_file(file, threads_per_file, out);
+                break;
+            }
+        }
+    };
+
+    std::vector<std::thread> workers;
+    for (size_t i = 1; i < file_threads; ++i)
+        workers.emplace_back(worker);
+    worker();
+    for (std::thread & t : workers)
+        t.join();
+
+    if (out != stdout)
+        std::fclose(out);
+    else
+        std::fflush(out);
+
+    int exit_code = 0;
+    size_t total = 0;
+    for (size_t i = 0; i < results.size(); ++i)
+    {
+        const file_result & result = results[i];
+        if (!result.ok)
+        {
+            exit_code = 1;
+            std::fprintf(stderr, "%s: %s\n", opts.files[i], result.message.c_str());
+            continue;
+        }
+
+        if (opts.cmd == command::validate && !opts.quiet)
+            std::printf("%s: ok\n", opts.files[i]);
+        else if (opts.cmd == command::count)
+            std::printf("%zu %s\n", result.count, opts.files[i]);
+        else if (opts.cmd == command::sanitize && result.count)
+            std::fprintf(
+                stderr, "%s: replaced %zu invalid sequences\n", opts.files[i], result.count);
+        total += result.count;
+    }
+    if (opts.cmd == command::count && results.size() > 1)
+        std::printf("%zu total\n", total);
+
+    return exit_code;
+}
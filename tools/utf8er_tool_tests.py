@@ -0,0 +1,56 @@
+#!/usr/bin/env python3
+# runs the utf8er command line tool (passed as the first argument) on files with sequences at the
+# boundary of the 16 MB blocks it transcodes in, and checks that it reports the same errors the
+# library reports for the whole file.
+
+import os
+import subprocess
+import sys
+import tempfile
+
+BLOCK_SIZE = 1 << 24
+
+
+def run(tool, command, data, directory):
+    path = os.path.join(directory, 'input.txt')
+    with open(path, 'wb') as f:
+        f.write(data)
+    out = os.path.join(directory, 'output.bin')
+    proc = subprocess.run([tool, command, '-o', out, path], stderr=subprocess.PIPE)
+    with open(out, 'rb') as f:
+        output = f.read()
+    return proc.returncode, proc.stderr.decode(), output
+
+
+def check(name, condition):
+    if not condition:
+        print('FAILED: ' + name)
+        sys.exit(1)
+
+
+def main():
+    tool = sys.argv[1]
+    prefix = b'a' * (BLOCK_SIZE - 1)
+    with tempfile.TemporaryDirectory() as directory:
+        for command, codec in (('utf32', 'utf-32'), ('utf16', 'utf-16')):
+            codec += '-le' if sys.byteorder == 'little' else '-be'
+
+            # a valid sequence across the boundary is moved to the next block.
+            data = prefix + '€'.encode() + b'A'
+            code, err, output = run(tool, command, data, directory)
+            check(command + ' split sequence', code == 0 and output == data.decode().encode(codec))
+
+            # the block ends in \xE2\x82, but the sequence is broken by the A of the next block.
+            code, err, output = run(tool, command, prefix[1:] + b'\xe2\x82Abc', directory)
+            check(command + ' broken sequence',
+                  code == 1 and 'bad continuation byte at byte %d' % (BLOCK_SIZE - 2) in err)
+
+            # at the end of the file the sequence is incomplete.
+            code, err, output = run(tool, command, prefix + b'a\xe2', directory)
+            check(command + ' incomplete sequence',
+                  code == 1 and 'incomplete sequence at byte %d' % BLOCK_SIZE in err)
+    print('ok')
+
+
+if __name__ == '__main__':
+    main()
@@ -8,11 +8,92 @@
 #ifndef UTF8ER_UTF8ER_HPP
 #define UTF8ER_UTF8ER_HPP
 
+#include <algorithm>   //for std::min
 #include <cassert>
 #include <cstdint>
 #include <cstring>
-#include <iterator> //for std::back_insert_iterator
-#include <utility>  //for pair
+#include <iterator>    //for std::back_insert_iterator
+#include <string>      //to detect contiguous string iterators
+#include <type_traits> //for std::integral_constant
+#include <utility>     //for pair
+#include <vector>      //to detect contiguous vector iterators
+
+// SIMD code paths are picked at compile time based on the target flags (i.e. -mavx2). Define
+// UTF8ER_NO_SIMD before including this file to force the scalar implementations.
+#if !defined(UTF8ER_NO_SIMD)
+#if defined(__AVX2__)
+#define UTF8ER_AVX2
+#endif
+#if defined(__SSE4_1__) || defined(UTF8ER_AVX2)
+#define UTF8ER_SSE41
+#endif
+#if defined(__SSSE3__) || defined(UTF8ER_SSE41)
+#define UTF8ER_SSSE3
+#endif
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define UTF8ER_SSE2
+#endif
+// pdep is microcoded and slow on AMD before Zen 3, so it is only used if UTF8ER_USE_PDEP is
+// defined in addition to the BMI2 target flag (i.e. -mbmi2 or -march=native).
+#if defined(UTF8ER_USE_PDEP) && defined(__BMI2__) && defined(__x86_64__)
+#define UTF8ER_BMI2
+#endif
+#endif // !defined(UTF8ER_NO_SIMD)
+
+#if defined(UTF8ER_AVX2) || defined(UTF8ER_BMI2)
+#include <immintrin.h>
+#elif defined(UTF8ER_SSE41)
+#include <smmintrin.h>
+#elif defined(UTF8ER_SSSE3)
+#include <tmmintrin.h>
+#elif defined(UTF8ER_SSE2)
+#include <emmintrin.h>
+#endif
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+// the functions that are usable in constant expressions fall back to their scalar implementations
+// at compile time, which needs a way to detect constant evaluation in C++14.
+#if defined(__has_builtin)
+#if __has_builtin(__builtin_is_constant_evaluated)
+#define UTF8ER_HAS_CONSTANT_EVALUATED
+#endif
+#endif
+#if !defined(UTF8ER_HAS_CONSTANT_EVALUATED)
+#if (defined(__GNUC__) && !defined(__clang__) && __GNUC__ >= 9) ||                               \
+    (defined(_MSC_VER) && _MSC_VER >= 1925)
+#define UTF8ER_HAS_CONSTANT_EVALUATED
+#endif
+#endif
+
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__)
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define UTF8ER_BIG_ENDIAN
+#endif
+#endif
+
+// a few bulk functions deliberately read (aligned) past the end of null terminated strings, which
+// can't fault but is reported by the address sanitizer. MSVC (/fsanitize=address) only knows the
+// declspec spelling, clang-cl takes the gcc attribute.
+#if defined(_MSC_VER) && !defined(__clang__)
+#if defined(__SANITIZE_ADDRESS__)
+#define UTF8ER_NO_SANITIZE_ADDRESS __declspec(no_sanitize_address)
+#endif
+#else
+#if defined(__has_feature)
+#if __has_feature(address_sanitizer)
+#define UTF8ER_NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+#endif
+#endif
+#if !defined(UTF8ER_NO_SANITIZE_ADDRESS) && defined(__SANITIZE_ADDRESS__)
+#define UTF8ER_NO_SANITIZE_ADDRESS __attribute__((no_sanitize_address))
+#endif
+#endif
+#if !defined(UTF8ER_NO_SANITIZE_ADDRESS)
+#define UTF8ER_NO_SANITIZE_ADDRESS
+#endif
 
 // helper macro to make things a little more compact.
 #define UTF8ER_RETURN_ON_ERR(_exp)                                                                 \
@@ -33,12 +114,17 @@ namespace _me = utf8er;
 
 // some integer types we want to use.
 using uint8_t = std::uint8_t;
+using uint16_t = std::uint16_t;
 using uint32_t = std::uint32_t;
+using uint64_t = std::uint64_t;
 using size_t = std::size_t;
 
 // this codepoint is returned if any of the decode methods fails
 static constexpr uint32_t not_a_character = 0xFFFF;
 
+// the lossy functions replace invalid input with this codepoint (U+FFFD)
+static constexpr uint32_t replacement_character = 0xFFFD;
+
 // different error codes used by utf8er
 enum class error_code
 {
@@ -50,18 +136,73 @@ enum class error_code
     bad_codepoint
 };
 
+// the byte order of utf16 code units in memory.
+enum class byte_order
+{
+    little_endian,
+    big_endian
+};
+
+// the byte order of the target, used by default by the utf16 functions.
+#if defined(UTF8ER_BIG_ENDIAN)
+static constexpr byte_order native_byte_order = byte_order::big_endian;
+#else
+static constexpr byte_order native_byte_order = byte_order::little_endian;
+#endif
+
+// error policies for the policy based decode_range and encode_range overloads. The policy is a
+// template parameter, so each one compiles to its own loop without checks it doesn't need.
+namespace policy
+{
+// assumes valid input, invalid input is undefined behavior. Same as decode_range/encode_range.
+struct unchecked
+{
+};
+
+// stops at the first error and reports it. Same as decode_range_safe/encode_range_safe.
+struct report_first
+{
+};
+
+// replaces every invalid part with replacement_character and carries on. Same as
+// decode_range_lossy.
+struct replace
+{
+};
+
+// drops every invalid part and carries on.
+struct skip
+{
+};
+} // namespace policy
+
 // encapsulates an error_code to default construct to error_code::none, and adds some convenience.
 // all API functions operate on error_report rather than error_code.
 struct error_report;
 
+// the result of the bulk transcoding functions. On success consumed is the length of the input,
+// on error it is the offset of the invalid input sequence. produced is the number of units that
+// were written to the output (up to the error).
+struct transcode_result;
+
 // template class to pick the output iterator for a string of type T. The existing
 // implementation simply picks std::back_insert_iterator. Can be specialized for custom string
 // types to support types that might not work with std::back_insert_iterator. check the
 // implementation below for details.
+//
+// The picked output_iter can optionally act as a bulk sink by providing the member functions
+// reserve(size_t _count), write(const uint8_t * _data, size_t _count) and commit().
+// encode_range and the append functions detect those at compile time and hand whole blocks of
+// bytes to write instead of assigning every byte through the iterator. reserve is called with
+// the exact encoded size beforehand if the input can be traversed twice, commit is called once
+// at the end. Output iterators that provide write(const uint32_t *, size_t) instead are used the
+// same way by decode_range and decode_range_safe.
 template <class T>
 struct output_iterator_picker;
 
-// appends the provided unicode _codepoint to the provided _append_string.
+// appends the provided unicode _codepoint to the provided _append_string. std::string and
+// std::vector<char> (and the like) are grown once and written to directly, all other types go
+// through output_iterator_picker. The same applies to the other append functions.
 template <class T>
 typename output_iterator_picker<T>::output_iter append(uint32_t _codepoint, T & _append_string);
 
@@ -89,42 +230,56 @@ typename output_iterator_picker<STR>::output_iter append_range_safe(IT _begin,
                                                                     error_report & _out_error);
 
 // based on the starting byte of a utf8 byte sequence, returns the number of bytes that it uses.
-inline uint8_t byte_count(uint8_t _starting_byte);
+constexpr uint8_t byte_count(uint8_t _starting_byte);
 
 // returns the number of unicode codepoint hops in between the utf8 encoded byte iterator
 // range _begin to _end. Returns a positive number if _begin <= _end and a negative number otherwise.
+// For contiguous byte ranges this counts all bytes that are not continuation bytes using SIMD.
+template <class IT>
+constexpr typename std::iterator_traits<IT>::difference_type distance(IT _begin, IT _end);
+
+// returns the number of bytes needed to utf8 encode the unicode codepoints in between _begin and
+// _end.
 template <class IT>
-typename std::iterator_traits<IT>::difference_type distance(IT _begin, IT _end);
+size_t utf8_length(IT _begin, IT _end);
+
+// returns the number of codepoints (utf32 code units) the valid utf8 encoded bytes in between
+// _begin and _end decode to.
+template <class IT>
+size_t utf32_length(IT _begin, IT _end);
 
 // returns the number of unicode codepoints stored in the provided utf8 encoded, null terminated
-// c string.
-inline size_t count(const char * _cstr);
+// c string. Looks for the terminator and counts in one pass.
+constexpr size_t count(const char * _cstr);
 
 // decodes the utf8 byte sequence starting at _begin and returns the resulting unicode
 // codepoint. _out_byte_count optionally stores the number of bytes used be the returned
 // codepoint. As no end iterator is provided, the provided utf8 encoded codepoints need to be
 // complete (otherwise undefined behavior).
 template <class IT>
-uint32_t decode(IT _begin, uint8_t * _out_byte_count = nullptr);
+constexpr uint32_t decode(IT _begin, uint8_t * _out_byte_count = nullptr);
 
 // decodes the first utf8 encoded codepoint starting at _begin and returns the resulting unicode
 // codepoint. _end is the end of the byte sequence. On error it returns not_a_character and
 // saves the error reason in _out_error. _out_byte_count optionally stores the number of bytes
-// used be the returned codepoint.
+// used be the returned codepoint. Define UTF8ER_DFA_DECODER to use a table driven
+// decoder (one lookup per byte, no data dependent branches) instead of the default branch based
+// one. Both report the same errors. This also applies to all functions built on decode_safe.
 template <class IT>
-uint32_t decode_safe(IT _begin,
-                     IT _end,
-                     error_report & _out_error,
-                     uint8_t * _out_byte_count = nullptr);
+constexpr uint32_t decode_safe(IT _begin,
+                               IT _end,
+                               error_report & _out_error,
+                               uint8_t * _out_byte_count = nullptr);
 
 // decode the first utf8 encoded codepoint starting at c_str. The provided c string is expected to
 // be null terminated. See decode_safe above for more info.
-inline uint32_t decode_safe(const char * _c_str,
-                            error_report & _out_error,
-                            uint8_t * _out_byte_count = nullptr);
+constexpr uint32_t decode_safe(const char * _c_str,
+                               error_report & _out_error,
+                               uint8_t * _out_byte_count = nullptr);
 
 // decodes all the utf8 encoded codepoints between _begin and _end and appends them to the provided
-// output iterator. Returns the next output iterator.
+// output iterator. Returns the next output iterator. For contiguous byte ranges, runs of ascii
+// bytes are copied in blocks (widened with SIMD if _output_it is a uint32_t pointer).
 template <class IT, class OIT>
 OIT decode_range(IT _begin, IT _end, OIT _output_it);
 
@@ -133,6 +288,43 @@ OIT decode_range(IT _begin, IT _end, OIT _output_it);
 template <class IT, class OIT>
 OIT decode_range_safe(IT _begin, IT _end, OIT _output_it, error_report & _out_error);
 
+// decodes all the utf8 encoded codepoints between _begin and _end and appends them to the provided
+// output iterator. Instead of stopping at errors, every maximal invalid subpart (the longest
+// prefix of a valid sequence, or a single byte that can't start one) is replaced with
+// replacement_character, as recommended by the unicode standard. If _out_errors is not nullptr,
+// the byte offset of every replaced subpart is appended to it.
+template <class IT, class OIT>
+OIT decode_range_lossy(IT _begin,
+                       IT _end,
+                       OIT _output_it,
+                       std::vector<size_t> * _out_errors = nullptr);
+
+// copies the utf8 between _begin and _end to _output_it and replaces maximal invalid subparts
+// with the encoded replacement_character the same way decode_range_lossy does. For contiguous
+// byte ranges the valid stretches are found with validate and copied as a whole.
+template <class IT, class OIT>
+OIT sanitize(IT _begin, IT _end, OIT _output_it, std::vector<size_t> * _out_errors = nullptr);
+
+// decodes the utf8 between _begin and _end to _output_it and deals with invalid input as
+// POLICY (i.e. policy::skip) says. With policy::replace and policy::skip, _out_error holds the
+// first error that was encountered. The functions above forward to this one.
+template <class POLICY, class IT, class OIT>
+OIT decode_range(IT _begin, IT _end, OIT _output_it, error_report & _out_error);
+
+// decodes and validates the _length bytes of utf8 starting at _str and writes the codepoints to
+// _output. _output must have room for _length codepoints. Uses SIMD to decode whole blocks if
+// the target supports SSE4.1 or AVX2.
+inline transcode_result transcode_to_utf32(const char * _str, size_t _length, uint32_t * _output);
+
+// same as transcode_to_utf32, but writes _capacity codepoints to _output at most. Once the
+// output is full, decoding stops in front of the first sequence that does not fit without an
+// error, so that it can be resumed at _str + consumed (i.e. into a ring buffer). On error,
+// consumed is the offset of the invalid sequence.
+inline transcode_result transcode_to_utf32(const char * _str,
+                                           size_t _length,
+                                           uint32_t * _output,
+                                           size_t _capacity);
+
 // decodes all utf8 encoded codepoints in the provided, null terminated _c_str and appends them to
 // the provided _output_it.
 template <class OIT>
@@ -155,6 +347,8 @@ IT decode_and_next(IT _it, uint32_t & _out_codepoint);
 template <class IT>
 IT decode_and_next_safe(IT _it, IT _end, uint32_t & _out_codepoint, error_report & _out_error);
 
+// decodes all the utf8 encoded codepoints between _begin and _end and appends them to the provided
+// container. std::vector<uint32_t> is resized once and written to directly.
 template <class IT, class T>
 typename output_iterator_picker<T>::output_iter decode_range_and_append(IT _begin,
                                                                         IT _end,
@@ -173,52 +367,168 @@ IT decode_and_previous_safe(IT _it, uint32_t & _out_codepoint, error_report & _o
 
 // encodes the provided unicode _codepoint and appends it to _output_it (output iterator).
 template <class IT>
-IT encode(uint32_t _codepoint, IT _output_it);
+constexpr IT encode(uint32_t _codepoint, IT _output_it);
 
 // encodes the provided unicode _codepoint and appends it to _output_it (output iterator). Does
-// error checking and stores potential errors in _out_error.
+// error checking (surrogates and codepoints beyond 0x10FFFF) and stores potential errors in
+// _out_error.
 template <class IT>
-IT encode_safe(uint32_t _codepoint, IT _output_it, error_report & _out_error);
+constexpr IT encode_safe(uint32_t _codepoint, IT _output_it, error_report & _out_error);
 
+// encodes the unicode codepoints in the range from _begin to _end and appends them to
+// _output_it. If the input is a uint32_t pointer and the output a char pointer, whole blocks are
+// encoded with SIMD.
 template <class IT, class OIT>
 OIT encode_range(IT _begin, IT _end, OIT _output_it);
 
+// same as encode_range, but stops at the first codepoint that can't be stored as utf8 and stores
+// the error in _out_error.
 template <class IT, class OIT>
 OIT encode_range_safe(IT _begin, IT _end, OIT _output_it, error_report & _out_error);
 
+// encodes the codepoints between _begin and _end to _output_it and deals with surrogates and
+// codepoints beyond 0x10FFFF as POLICY says, see decode_range.
+template <class POLICY, class IT, class OIT>
+OIT encode_range(IT _begin, IT _end, OIT _output_it, error_report & _out_error);
+
+// encodes and validates the _count codepoints starting at _codepoints and writes them to _output,
+// which must have room for the encoded bytes (at most 4 per codepoint). On error, consumed in the
+// result is the index of the invalid codepoint.
+inline transcode_result transcode_to_utf8(const uint32_t * _codepoints,
+                                          size_t _count,
+                                          char * _output);
+
+// same as transcode_to_utf8, but writes _capacity bytes to _output at most. Once the output is
+// full, encoding stops in front of the first codepoint that does not fit without an error, so
+// that it can be resumed at _codepoints + consumed.
+inline transcode_result transcode_to_utf8(const uint32_t * _codepoints,
+                                          size_t _count,
+                                          char * _output,
+                                          size_t _capacity);
+
+// returns the number of utf16 code units the valid utf8 encoded _length bytes starting at _str
+// transcode to, which is exact for valid input and an upper bound for invalid input.
+inline size_t utf8_to_utf16_length(const char * _str, size_t _length);
+
+// returns the number of bytes the _count utf16 code units starting at _units transcode to, which
+// is exact for valid input and an upper bound for invalid input.
+inline size_t utf16_to_utf8_length(const uint16_t * _units,
+                                   size_t _count,
+                                   byte_order _order = native_byte_order);
+
+// decodes and validates the _length bytes of utf8 starting at _str and writes them as utf16 code
+// units in the byte order _order to _output, which must have room for
+// utf8_to_utf16_length(_str, _length) units. Uses the same SIMD decoder as transcode_to_utf32.
+inline transcode_result utf8_to_utf16(const char * _str,
+                                      size_t _length,
+                                      uint16_t * _output,
+                                      byte_order _order = native_byte_order);
+
+// transcodes the _count utf16 code units in the byte order _order starting at _units to utf8 and
+// writes the bytes to _output, which must have room for utf16_to_utf8_length(_units, _count)
+// bytes. Unpaired surrogates are reported as error_code::bad_codepoint, a high surrogate at the
+// very end as error_code::incomplete_sequence. Blocks of units without surrogates are encoded
+// with SIMD.
+inline transcode_result utf16_to_utf8(const uint16_t * _units,
+                                      size_t _count,
+                                      char * _output,
+                                      byte_order _order = native_byte_order);
+
+// returns the number of bytes the _length latin1 (ISO-8859-1) characters starting at _str encode
+// to as utf8.
+inline size_t latin1_to_utf8_length(const char * _str, size_t _length);
+
+// encodes the _length latin1 characters starting at _str as utf8 and writes them to _output,
+// which must have room for latin1_to_utf8_length(_str, _length) bytes. Returns the number of
+// bytes written. Ascii stretches are copied in blocks, everything else is expanded with SIMD.
+inline size_t latin1_to_utf8(const char * _str, size_t _length, char * _output);
+
+// decodes and validates the _length bytes of utf8 starting at _str and writes them as latin1 to
+// _output, which must have room for _length bytes. A codepoint beyond 0xFF is reported as
+// error_code::bad_codepoint with the offset of its sequence.
+inline transcode_result utf8_to_latin1(const char * _str, size_t _length, char * _output);
+
 // returns an error message for the corresponding code.
 inline const char * error_message(error_code _code);
 
 // returns true if the provided character is in the ascii range
-inline bool is_ascii(uint8_t _starting_byte);
+constexpr bool is_ascii(uint8_t _starting_byte);
 
 // validates the provided utf8 encoded byte sequence between _begin and _end and returns
-// potential errors with the position that triggered the error.
+// potential errors with the position that triggered the error. Runs in linear time. For
+// contiguous byte ranges (pointers, std::string and std::vector iterators) a SIMD lookup table
+// validator is used if the target supports it.
 template <class IT>
-std::pair<error_report, IT> validate(IT _begin, IT _end);
+constexpr std::pair<error_report, IT> validate(IT _begin, IT _end);
 
-inline std::pair<error_report, const char*> validate(const char * _str);
+constexpr std::pair<error_report, const char*> validate(const char * _str);
 
 // advances the provided byte iterator _it to the next utf8 codepoint and returns the
 // corresponding iterator. _it has to be at the start of a utf8 byte sequence.
 template <class IT>
-IT next(IT _it);
+constexpr IT next(IT _it);
 
 // Returns the iterator to the start of the previous utf8 encoded codepoint of _it.
 template <class IT>
-IT previous(IT _it);
+constexpr IT previous(IT _it);
+
+// validates utf8 that arrives in arbitrary chunks (i.e. read from a socket). Sequences that are
+// split in between two chunks are carried over (at most 3 bytes), everything else is validated
+// in place. Errors are reported with their absolute offset in the stream. Call finish once the
+// stream ended to detect a truncated last sequence.
+class stream_validator;
+
+// same as stream_validator, but also decodes the chunks and writes the codepoints to an output
+// iterator. A codepoint split in between two chunks is written with the later chunk.
+class stream_decoder;
+
+// sparse index over a utf8 string that stores the byte offset of every _stride-th codepoint.
+// Finding the n-th codepoint takes at most _stride steps from the closest stored offset, finding
+// the codepoint at a byte offset is a binary search plus counting at most _stride codepoints.
+// Larger strides need less memory (one size_t per _stride codepoints), smaller strides make
+// lookups faster. The index does not own the string. Codepoints are counted like distance does,
+// so the results are only meaningful for valid utf8.
+class codepoint_index;
+
+// non-owning view of a utf8 string that is validated once on construction. Since a view is
+// always valid, it offers the unchecked functions (decode, next, previous...) without the risk
+// of undefined behavior. The number of codepoints and a codepoint_index for random access are
+// computed on first use and cached, which makes those calls not thread safe.
+class utf8_view;
+
+// single pass range over the codepoints of a utf8 string that can be used in range based for
+// loops and with the algorithms that accept input iterators. Instead of decoding one codepoint
+// per increment, the range decodes blocks of codepoints to an internal buffer with
+// transcode_to_utf32. Iteration stops at the first invalid sequence, check error() afterwards.
+class codepoint_range;
+
 
+// owning array of the codepoints of a utf8 string that stores them with 1, 2 or 4 bytes each,
+// depending on the largest codepoint (latin1, ucs2 or utf32, like PEP 393). The width is found
+// with a single scan of the lead bytes, after which the string is decoded with the matching
+// SIMD transcoder. Offers indexed access and encodes back to utf8.
+class codepoint_array;
+
+// a utf8 string literal that is validated and counted at compile time. Created with the _u8v
+// literal operator in utf8er::literals, i.e. constexpr auto s = "grüße"_u8v. An invalid literal
+// fails to compile if it is used in a constant expression and asserts otherwise.
+class static_utf8;
+
+namespace literals
+{
+constexpr static_utf8 operator""_u8v(const char * _str, size_t _length);
+}
 
 // Implementation follows below:
 // ============================================================================================
 
 struct error_report
 {
-    error_report() : code(error_code::none)
+    constexpr error_report() : code(error_code::none)
     {
     }
 
-    error_report(error_code _code) : code(_code)
+    constexpr error_report(error_code _code) : code(_code)
     {
     }
 
@@ -237,7 +547,7 @@ struct error_report
         return code != _other.code;
     }
 
-    explicit operator bool() const
+    constexpr explicit operator bool() const
     {
         return code != error_code::none;
     }
@@ -250,10 +560,29 @@ struct error_report
     error_code code;
 };
 
+struct transcode_result
+{
+    transcode_result() : consumed(0), produced(0)
+    {
+    }
+
+    transcode_result(error_report _error, size_t _consumed, size_t _produced) :
+        error(_error),
+        consumed(_consumed),
+        produced(_produced)
+    {
+    }
+
+    error_report error;
+    size_t consumed;
+    size_t produced;
+};
+
 template <class T>
 struct output_iterator_picker
 {
-    // for a spezialization, output_iter and iter function need to be present
+    // for a spezialization, output_iter and iter function need to be present. See the comment
+    // at the declaration on how output_iter can provide bulk writes.
     using output_iter = std::back_insert_iterator<T>;
     static output_iter iter(T & _str)
     {
@@ -282,12 +611,12 @@ inline const char * error_message(error_code _code)
     }
 }
 
-inline bool is_ascii(uint8_t _starting_byte)
+constexpr bool is_ascii(uint8_t _starting_byte)
 {
     return (_starting_byte & 0x80) == 0;
 }
 
-inline uint8_t byte_count(uint8_t _starting_byte)
+constexpr uint8_t byte_count(uint8_t _starting_byte)
 {
     if (is_ascii(_starting_byte))
         return 1;
@@ -305,12 +634,33 @@ inline uint8_t byte_count(uint8_t _starting_byte)
 // this namespace holds helper functions that are not part of the API
 namespace detail
 {
-inline bool _check_surrogate(uint32_t _cp)
+// true if the calling constexpr function is evaluated at compile time. Always false if the
+// compiler can't tell.
+constexpr bool _is_constant_evaluated()
+{
+#if defined(UTF8ER_HAS_CONSTANT_EVALUATED)
+    return __builtin_is_constant_evaluated();
+#else
+    return false;
+#endif
+}
+
+constexpr size_t _strlen(const char * _str)
+{
+    if (!_is_constant_evaluated())
+        return std::strlen(_str);
+    size_t ret = 0;
+    while (_str[ret])
+        ++ret;
+    return ret;
+}
+
+constexpr bool _check_surrogate(uint32_t _cp)
 {
     return _cp >= 0xD800 && _cp <= 0xDFFF;
 }
 
-inline error_code _validate_2_byte_codepoint(uint32_t _cp)
+constexpr error_code _validate_2_byte_codepoint(uint32_t _cp)
 {
     // check if the encoded value is in the valid range (128 - 2047)
     if (_cp < 0x80 || _cp > 0x7FF || _check_surrogate(_cp))
@@ -318,7 +668,7 @@ inline error_code _validate_2_byte_codepoint(uint32_t _cp)
     return error_code::none;
 }
 
-inline error_code _validate_3_byte_codepoint(uint32_t _cp)
+constexpr error_code _validate_3_byte_codepoint(uint32_t _cp)
 {
     // check if the encoded value is in the valid range (2048 - 65535)
     if (_cp < 0x800 || _cp > 0xFFFF || _check_surrogate(_cp))
@@ -326,7 +676,7 @@ inline error_code _validate_3_byte_codepoint(uint32_t _cp)
     return error_code::none;
 }
 
-inline error_code _validate_4_byte_codepoint(uint32_t _cp)
+constexpr error_code _validate_4_byte_codepoint(uint32_t _cp)
 {
     // check if the encoded value is in the valid range (65536 - 1114111)
     if (_cp < 0x10000 || _cp > 0x10FFFF || _check_surrogate(_cp))
@@ -334,12 +684,12 @@ inline error_code _validate_4_byte_codepoint(uint32_t _cp)
     return error_code::none;
 }
 
-inline bool _is_valid_trailing_byte(uint8_t _byte)
+constexpr bool _is_valid_trailing_byte(uint8_t _byte)
 {
     return (_byte & 0xC0) == 0x80;
 }
 
-inline error_code _validate_2_byte_sequence(uint8_t _a, uint8_t _b)
+constexpr error_code _validate_2_byte_sequence(uint8_t _a, uint8_t _b)
 {
     if (!_is_valid_trailing_byte(_b))
         return error_code::bad_continuation_byte;
@@ -350,7 +700,7 @@ inline error_code _validate_2_byte_sequence(uint8_t _a, uint8_t _b)
     return error_code::none;
 }
 
-inline error_code _validate_3_byte_sequence(uint8_t _a, uint8_t _b, uint8_t _c)
+constexpr error_code _validate_3_byte_sequence(uint8_t _a, uint8_t _b, uint8_t _c)
 {
     if (!_is_valid_trailing_byte(_b) || !_is_valid_trailing_byte(_c))
         return error_code::bad_continuation_byte;
@@ -361,7 +711,7 @@ inline error_code _validate_3_byte_sequence(uint8_t _a, uint8_t _b, uint8_t _c)
     return error_code::none;
 }
 
-inline error_code _validate_4_byte_sequence(uint8_t _a, uint8_t _b, uint8_t _c, uint8_t _d)
+constexpr error_code _validate_4_byte_sequence(uint8_t _a, uint8_t _b, uint8_t _c, uint8_t _d)
 {
     if (!_is_valid_trailing_byte(_b) || !_is_valid_trailing_byte(_c) ||
         !_is_valid_trailing_byte(_d))
@@ -374,7 +724,7 @@ inline error_code _validate_4_byte_sequence(uint8_t _a, uint8_t _b, uint8_t _c,
 }
 
 template <class T>
-error_code _checked_increment(T & _it, T _end)
+constexpr error_code _checked_increment(T & _it, T _end)
 {
     if (++_it == _end)
         return error_code::incomplete_sequence;
@@ -382,9 +732,9 @@ error_code _checked_increment(T & _it, T _end)
 }
 
 template <class IT>
-IT _encode_impl(uint32_t _codepoint, IT _output_it, error_report * _out_error = nullptr)
+constexpr IT _encode_impl(uint32_t _codepoint, IT _output_it, error_report * _out_error = nullptr)
 {
-    if (_out_error && _check_surrogate(_codepoint))
+    if (_out_error && (_check_surrogate(_codepoint) || _codepoint > 0x10FFFF))
     {
         *_out_error = error_code::bad_codepoint;
         return _output_it;
@@ -421,309 +771,4119 @@ IT _encode_impl(uint32_t _codepoint, IT _output_it, error_report * _out_error =
 
 } // namespace detail
 
-template <class IT>
-uint32_t decode(IT _begin, uint8_t * _out_byte_count)
+// the helpers below implement the bulk code paths for contiguous byte sequences (raw pointers,
+// std::string and std::vector iterators). Where the target supports it, they use SIMD.
+namespace detail
 {
-    uint8_t a = *_begin;
-    uint8_t bc = byte_count(a);
-    if (_out_byte_count)
-        *_out_byte_count = bc;
-
-    assert(bc > 0);
+template <class T, class U = typename std::remove_cv<T>::type>
+struct _is_byte : std::integral_constant<bool,
+                                         std::is_same<U, char>::value ||
+                                             std::is_same<U, signed char>::value ||
+                                             std::is_same<U, unsigned char>::value>
+{
+};
 
-    if (bc == 1)
-    {
-        return static_cast<uint32_t>(a);
-    }
-    else if (bc == 2)
-    {
-        uint8_t b = *(++_begin);
-        return static_cast<uint32_t>(((a & 0x1F) << 6) | (b & 0x3F));
-    }
-    else if (bc == 3)
-    {
-        uint8_t b = *(++_begin);
-        uint8_t c = *(++_begin);
-        return static_cast<uint32_t>((a & 0xF) << 12) | ((b & 0x3F) << 6) | (c & 0x3F);
-    }
-    else if (bc == 4)
-    {
-        uint8_t b = *(++_begin);
-        uint8_t c = *(++_begin);
-        uint8_t d = *(++_begin);
-        return static_cast<uint32_t>((a & 0x7) << 18) | ((b & 0x3F) << 12) | ((c & 0x3F) << 6) |
-               (d & 0x3F);
-    }
+// true for iterators that are known to point into contiguous memory of bytes.
+template <class IT>
+struct _is_contiguous_byte_iter
+    : std::integral_constant<bool,
+                             (std::is_pointer<IT>::value &&
+                              _is_byte<typename std::iterator_traits<IT>::value_type>::value) ||
+                                 std::is_same<IT, std::string::iterator>::value ||
+                                 std::is_same<IT, std::string::const_iterator>::value ||
+                                 std::is_same<IT, std::vector<char>::iterator>::value ||
+                                 std::is_same<IT, std::vector<char>::const_iterator>::value ||
+                                 std::is_same<IT, std::vector<uint8_t>::iterator>::value ||
+                                 std::is_same<IT, std::vector<uint8_t>::const_iterator>::value>
+{
+};
 
-    return not_a_character;
+// returns the address of the byte _it points to. _it must be dereferencable.
+template <class IT>
+const uint8_t * _byte_ptr(IT _it)
+{
+    return reinterpret_cast<const uint8_t *>(&*_it);
 }
 
-template <class IT>
-uint32_t decode_safe(IT _begin, IT _end, error_report & _out_error, uint8_t * _out_byte_count)
+// index of the lowest set bit. _v must not be zero.
+inline uint32_t _ctz(uint32_t _v)
 {
-    uint8_t a = *_begin;
-    size_t bc = byte_count(a);
-    if (_out_byte_count)
-        *_out_byte_count = bc;
+#if defined(_MSC_VER)
+    unsigned long idx;
+    _BitScanForward(&idx, _v);
+    return static_cast<uint32_t>(idx);
+#else
+    return static_cast<uint32_t>(__builtin_ctz(_v));
+#endif
+}
 
-    if (bc == 0)
-    {
-        _out_error = error_code::bad_leading_byte;
-        return not_a_character;
-    }
-    else if (bc == 1)
+// returns the first non ascii byte in the range _begin to _end (or _end if there is none).
+inline const uint8_t * _skip_ascii(const uint8_t * _begin, const uint8_t * _end)
+{
+#if defined(UTF8ER_AVX2)
+    for (; _end - _begin >= 32; _begin += 32)
     {
-        return static_cast<uint32_t>(a);
+        uint32_t mask = static_cast<uint32_t>(
+            _mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(_begin))));
+        if (mask)
+            return _begin + _ctz(mask);
     }
-    else if (bc == 2)
+#endif
+#if defined(UTF8ER_SSE2)
+    for (; _end - _begin >= 16; _begin += 16)
     {
-        UTF8ER_RETURN_ON_ERR(detail::_checked_increment(_begin, std::min(_begin + 2, _end)));
-        uint8_t b = *_begin;
-        UTF8ER_RETURN_ON_ERR(detail::_validate_2_byte_sequence(a, b));
-        uint32_t cp = static_cast<uint32_t>(((a & 0x1F) << 6) | (b & 0x3F));
-        UTF8ER_RETURN_ON_ERR(detail::_validate_2_byte_codepoint(cp));
-        return cp;
+        uint32_t mask = static_cast<uint32_t>(
+            _mm_movemask_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(_begin))));
+        if (mask)
+            return _begin + _ctz(mask);
     }
-    else if (bc == 3)
+#else
+    for (; _end - _begin >= 8; _begin += 8)
     {
-        UTF8ER_RETURN_ON_ERR(detail::_checked_increment(_begin, std::min(_begin + 3, _end)));
-        uint8_t b = *_begin;
-        UTF8ER_RETURN_ON_ERR(detail::_checked_increment(_begin, std::min(_begin + 2, _end)));
-        uint8_t c = *_begin;
-        UTF8ER_RETURN_ON_ERR(detail::_validate_3_byte_sequence(a, b, c));
-        uint32_t cp = static_cast<uint32_t>((a & 0xF) << 12) | ((b & 0x3F) << 6) | (c & 0x3F);
-        UTF8ER_RETURN_ON_ERR(detail::_validate_3_byte_codepoint(cp));
-        return cp;
+        uint64_t word;
+        std::memcpy(&word, _begin, 8);
+        if (word & 0x8080808080808080ull)
+            break;
     }
-    else if (bc == 4)
+#endif
+    while (_begin != _end && is_ascii(*_begin))
+        ++_begin;
+    return _begin;
+}
+
+// _it points right behind bytes that are known to be valid apart from a potentially incomplete
+// sequence at their very end. This returns the start of that sequence (or _it if there is none).
+inline const uint8_t * _rewind_to_lead(const uint8_t * _begin, const uint8_t * _it)
+{
+    for (int i = 1; i <= 3 && i <= _it - _begin; ++i)
     {
-        UTF8ER_RETURN_ON_ERR(detail::_checked_increment(_begin, std::min(_begin + 4, _end)));
-        uint8_t b = *_begin;
-        UTF8ER_RETURN_ON_ERR(detail::_checked_increment(_begin, std::min(_begin + 3, _end)));
-        uint8_t c = *_begin;
-        UTF8ER_RETURN_ON_ERR(detail::_checked_increment(_begin, std::min(_begin + 2, _end)));
-        uint8_t d = *_begin;
-        UTF8ER_RETURN_ON_ERR(detail::_validate_4_byte_sequence(a, b, c, d));
-        uint32_t cp = static_cast<uint32_t>((a & 0x7) << 18) | ((b & 0x3F) << 12) |
-                      ((c & 0x3F) << 6) | (d & 0x3F);
-        UTF8ER_RETURN_ON_ERR(detail::_validate_4_byte_codepoint(cp));
-        return cp;
+        if (!_is_valid_trailing_byte(*(_it - i)))
+            return _it - i;
     }
-
-    // this should never be reached
-    assert(false);
-    return not_a_character;
+    return _it;
 }
 
-inline uint32_t decode_safe(const char * _begin,
-                            error_report & _out_error,
-                            uint8_t * _out_byte_count)
+#if defined(UTF8ER_SSSE3)
+
+// thin wrappers around the SSSE3/AVX2 intrinsics so that the algorithms below only need to be
+// written once.
+#if defined(UTF8ER_AVX2)
+using _simd_vec = __m256i;
+static constexpr size_t _simd_width = 32;
+
+inline _simd_vec _simd_load(const uint8_t * _ptr)
 {
-    return _me::decode_safe(_begin, _begin + std::strlen(_begin), _out_error, _out_byte_count);
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(_ptr));
 }
 
-template <class IT, class OIT>
-OIT decode_range(IT _begin, IT _end, OIT _output_it)
+inline _simd_vec _simd_load_table(const uint8_t * _table16)
 {
-    uint32_t cp;
-    while (_begin != _end)
-    {
-        _begin = _me::decode_and_next(_begin, cp);
-        *(_output_it++) = cp;
-    }
-    return _output_it;
+    return _mm256_broadcastsi128_si256(
+        _mm_loadu_si128(reinterpret_cast<const __m128i *>(_table16)));
 }
 
-template <class IT, class OIT>
-OIT decode_range_safe(IT _begin, IT _end, OIT _output_it, error_report & _out_error)
+inline _simd_vec _simd_splat(uint8_t _v)
 {
-    uint32_t cp;
-    while (_begin != _end)
-    {
-        _begin = _me::decode_and_next_safe(_begin, _end, cp, _out_error);
-        if (_out_error)
-            return _output_it;
-        *(_output_it++) = cp;
-    }
-    return _output_it;
+    return _mm256_set1_epi8(static_cast<char>(_v));
 }
 
-template <class OIT>
-OIT decode_c_str(const char * _c_str, OIT _output_it)
+inline _simd_vec _simd_zero()
 {
-    return _me::decode_range(_c_str, _c_str + std::strlen(_c_str), _output_it);
+    return _mm256_setzero_si256();
 }
 
-template <class OIT>
-OIT decode_c_str_safe(const char * _c_str, OIT _output_it, error_report & _out_error)
+inline _simd_vec _simd_or(_simd_vec _a, _simd_vec _b)
 {
-    return _me::decode_range_safe(_c_str, _c_str + std::strlen(_c_str), _output_it, _out_error);
+    return _mm256_or_si256(_a, _b);
 }
 
-template <class IT>
-std::pair<error_report, IT> validate(IT _begin, IT _end)
+inline _simd_vec _simd_and(_simd_vec _a, _simd_vec _b)
 {
-    uint8_t bc;
-    error_report err;
-    while (_begin != _end)
-    {
-        decode_safe(_begin, err, &bc);
-        if (err)
-            return std::make_pair(err, _begin);
-        _begin += bc;
-    }
-
-    return std::make_pair(error_report(), IT());
+    return _mm256_and_si256(_a, _b);
 }
 
-inline std::pair<error_report, const char*> validate(const char * _str)
+inline _simd_vec _simd_xor(_simd_vec _a, _simd_vec _b)
 {
-    return validate(_str, _str + std::strlen(_str));
+    return _mm256_xor_si256(_a, _b);
 }
 
-template <class IT>
-IT next(IT _it)
+inline _simd_vec _simd_subs(_simd_vec _a, _simd_vec _b)
 {
-    return _it + _me::byte_count(*_it);
+    return _mm256_subs_epu8(_a, _b);
 }
 
-template <class IT>
-IT decode_and_next(IT _it, uint32_t & _out_codepoint)
+inline _simd_vec _simd_shr4(_simd_vec _a)
 {
-    uint8_t bc;
-    _out_codepoint = _me::decode(_it, &bc);
-    return _it + bc;
+    return _mm256_and_si256(_mm256_srli_epi16(_a, 4), _mm256_set1_epi8(0x0F));
 }
 
-template <class IT>
-IT decode_and_next_safe(IT _it, IT _end, uint32_t & _out_codepoint, error_report & _out_error)
+// _table is expected to hold the same 16 entries in both 128 bit lanes.
+inline _simd_vec _simd_lookup(_simd_vec _table, _simd_vec _idx)
 {
-    uint8_t bc;
-    _out_codepoint = _me::decode_safe(_it, _end, _out_error, &bc);
-    return _it + bc;
+    return _mm256_shuffle_epi8(_table, _idx);
 }
 
-template <class IT>
-IT previous(IT _it)
+// returns _input shifted by N bytes with the last N bytes of _prev shifted in.
+template <int N>
+_simd_vec _simd_prev(_simd_vec _input, _simd_vec _prev)
 {
-    while (detail::_is_valid_trailing_byte(*(--_it)))
-        ;
-    return _it;
+    return _mm256_alignr_epi8(_input, _mm256_permute2x128_si256(_prev, _input, 0x21), 16 - N);
 }
 
-template <class IT>
-IT decode_and_previous(IT _it, uint32_t & _out_codepoint)
+inline uint32_t _simd_movemask(_simd_vec _a)
 {
-    _out_codepoint = decode(_it);
-    while (detail::_is_valid_trailing_byte(*(--_it)))
-        ;
-    return _it;
+    return static_cast<uint32_t>(_mm256_movemask_epi8(_a));
 }
 
-template <class IT>
-IT decode_and_previous_safe(IT _it, uint32_t & _out_codepoint, error_report & _out_error)
+inline bool _simd_any(_simd_vec _a)
 {
-    _out_codepoint = decode_safe(_it, _out_error);
-    while (detail::_is_valid_trailing_byte(*(--_it)))
-        return _it;
+    return !_mm256_testz_si256(_a, _a);
 }
+#else
+using _simd_vec = __m128i;
+static constexpr size_t _simd_width = 16;
 
-template <class IT> 
-typename std::iterator_traits<IT>::difference_type distance(IT _begin, IT _end)
+inline _simd_vec _simd_load(const uint8_t * _ptr)
 {
-    if(_begin == _end)
-        return 0;
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(_ptr));
+}
 
-    typename std::iterator_traits<IT>::difference_type ret = 0;
-    if(_begin < _end)
-    {
-        while(_begin != _end)
-        {
-            ++ret;
-            _begin = _me::next(_begin);
-        }
-    }
-    else
-    {
-        while(_begin != _end)
-        {
-            --ret;
-            _begin = _me::previous(_begin);
-        }
-    }
-    return ret;
+inline _simd_vec _simd_load_table(const uint8_t * _table16)
+{
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(_table16));
 }
 
-inline size_t count(const char * _cstr)
+inline _simd_vec _simd_splat(uint8_t _v)
 {
-    return static_cast<size_t>(_me::distance(_cstr, _cstr + std::strlen(_cstr)));
+    return _mm_set1_epi8(static_cast<char>(_v));
 }
 
-template <class IT>
-IT encode(uint32_t _codepoint, IT _output_it)
+inline _simd_vec _simd_zero()
 {
-    return detail::_encode_impl(_codepoint, _output_it);
+    return _mm_setzero_si128();
 }
 
-template <class IT>
-IT encode_safe(uint32_t _codepoint, IT _output_it, error_report & _out_error)
+inline _simd_vec _simd_or(_simd_vec _a, _simd_vec _b)
 {
-    return detail::_encode_impl(_codepoint, _output_it, &_out_error);
+    return _mm_or_si128(_a, _b);
 }
 
-template <class IT, class OIT>
-OIT encode_range(IT _begin, IT _end, OIT _output_it)
+inline _simd_vec _simd_and(_simd_vec _a, _simd_vec _b)
 {
-    while (_begin != _end)
-        _me::encode(*(_begin++), _output_it);
-    return _output_it;
+    return _mm_and_si128(_a, _b);
+}
+
+inline _simd_vec _simd_xor(_simd_vec _a, _simd_vec _b)
+{
+    return _mm_xor_si128(_a, _b);
+}
+
+inline _simd_vec _simd_subs(_simd_vec _a, _simd_vec _b)
+{
+    return _mm_subs_epu8(_a, _b);
+}
+
+inline _simd_vec _simd_shr4(_simd_vec _a)
+{
+    return _mm_and_si128(_mm_srli_epi16(_a, 4), _mm_set1_epi8(0x0F));
+}
+
+inline _simd_vec _simd_lookup(_simd_vec _table, _simd_vec _idx)
+{
+    return _mm_shuffle_epi8(_table, _idx);
+}
+
+template <int N>
+_simd_vec _simd_prev(_simd_vec _input, _simd_vec _prev)
+{
+    return _mm_alignr_epi8(_input, _prev, 16 - N);
+}
+
+inline uint32_t _simd_movemask(_simd_vec _a)
+{
+    return static_cast<uint32_t>(_mm_movemask_epi8(_a));
+}
+
+inline bool _simd_any(_simd_vec _a)
+{
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(_a, _mm_setzero_si128())) != 0xFFFF;
+}
+#endif // defined(UTF8ER_AVX2)
+
+// error classes used by the lookup table validator below. Every pair of adjacent bytes is
+// classified by three 16 entry tables (high and low nibble of the first byte, high nibble of the
+// second byte). A bit that is set in all three results marks an invalid pair. The remaining
+// errors (missing/excess continuation bytes of 3 and 4 byte sequences) are found by checking
+// which bytes are required to be the second or third continuation byte of a sequence.
+enum : uint8_t
+{
+    _too_short = 1 << 0,   // 11______ 0_______ or 11______ 11______
+    _too_long = 1 << 1,    // 0_______ 10______
+    _overlong_3 = 1 << 2,  // 11100000 100_____
+    _too_large = 1 << 3,   // 11110100 1001____, 11110100 101_____, 11110101+ 10______
+    _surrogate = 1 << 4,   // 11101101 101_____
+    _overlong_2 = 1 << 5,  // 1100000_ 10______
+    _too_large_1000 = 1 << 6, // 11110101+ 1000____
+    _overlong_4 = 1 << 6,  // 11110000 1000____
+    _two_conts = 1 << 7,   // 10______ 10______
+    _carry = _too_short | _too_long | _two_conts
+};
+
+inline _simd_vec _simd_check_special_cases(_simd_vec _input, _simd_vec _prev1)
+{
+    static const uint8_t byte_1_high[16] = {
+        // 0_______ ________
+        _too_long, _too_long, _too_long, _too_long, _too_long, _too_long, _too_long, _too_long,
+        // 10______ ________
+        _two_conts, _two_conts, _two_conts, _two_conts,
+        // 1100____ ________
+        _too_short | _overlong_2,
+        // 1101____ ________
+        _too_short,
+        // 1110____ ________
+        _too_short | _overlong_3 | _surrogate,
+        // 1111____ ________
+        _too_short | _too_large | _too_large_1000 | _overlong_4
+    };
+    static const uint8_t byte_1_low[16] = {
+        // ____0000 ________
+        _carry | _overlong_3 | _overlong_2 | _overlong_4,
+        // ____0001 ________
+        _carry | _overlong_2,
+        // ____001_ ________
+        _carry, _carry,
+        // ____0100 ________
+        _carry | _too_large,
+        // ____0101 ________
+        _carry | _too_large | _too_large_1000,
+        // ____011_ ________
+        _carry | _too_large | _too_large_1000, _carry | _too_large | _too_large_1000,
+        // ____1___ ________
+        _carry | _too_large | _too_large_1000, _carry | _too_large | _too_large_1000,
+        _carry | _too_large | _too_large_1000, _carry | _too_large | _too_large_1000,
+        _carry | _too_large | _too_large_1000,
+        // ____1101 ________
+        _carry | _too_large | _too_large_1000 | _surrogate,
+        _carry | _too_large | _too_large_1000, _carry | _too_large | _too_large_1000
+    };
+    static const uint8_t byte_2_high[16] = {
+        // ________ 0_______
+        _too_short, _too_short, _too_short, _too_short, _too_short, _too_short, _too_short,
+        _too_short,
+        // ________ 1000____
+        _too_long | _overlong_2 | _two_conts | _overlong_3 | _too_large_1000 | _overlong_4,
+        // ________ 1001____
+        _too_long | _overlong_2 | _two_conts | _overlong_3 | _too_large,
+        // ________ 101_____
+        _too_long | _overlong_2 | _two_conts | _surrogate | _too_large,
+        _too_long | _overlong_2 | _two_conts | _surrogate | _too_large,
+        // ________ 11______
+        _too_short, _too_short, _too_short, _too_short
+    };
+
+    _simd_vec a = _simd_lookup(_simd_load_table(byte_1_high), _simd_shr4(_prev1));
+    _simd_vec b = _simd_lookup(_simd_load_table(byte_1_low), _simd_and(_prev1, _simd_splat(0x0F)));
+    _simd_vec c = _simd_lookup(_simd_load_table(byte_2_high), _simd_shr4(_input));
+    return _simd_and(_simd_and(a, b), c);
+}
+
+// returns a non zero vector if the bytes in _input (with the preceding bytes in _prev) are not
+// valid utf8. Sequences that are incomplete at the end of _input are not reported.
+inline _simd_vec _simd_check_utf8(_simd_vec _input, _simd_vec _prev)
+{
+    _simd_vec sc = _simd_check_special_cases(_input, _simd_prev<1>(_input, _prev));
+    // only 111_____ bytes two positions back and 1111____ bytes three positions back require a
+    // continuation byte. Saturating subtraction leaves the high bit set for exactly those.
+    _simd_vec third = _simd_subs(_simd_prev<2>(_input, _prev), _simd_splat(0xE0 - 0x80));
+    _simd_vec fourth = _simd_subs(_simd_prev<3>(_input, _prev), _simd_splat(0xF0 - 0x80));
+    _simd_vec must23 = _simd_and(_simd_or(third, fourth), _simd_splat(0x80));
+    return _simd_xor(must23, sc);
+}
+
+// returns a non zero vector if _input ends with an incomplete sequence.
+inline _simd_vec _simd_is_incomplete(_simd_vec _input)
+{
+    static const uint8_t max_values[32] = {
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+        255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0xEF, 0xDF, 0xBF
+    };
+    return _simd_subs(_input, _simd_load(max_values + 32 - _simd_width));
+}
+
+// validates 64 byte blocks starting at _begin and returns the start of the first block that
+// contains an error, or the first byte that was not checked. All bytes before the returned
+// pointer are valid, except that the last sequence might be incomplete.
+inline const uint8_t * _simd_valid_prefix(const uint8_t * _begin, const uint8_t * _end)
+{
+    static constexpr size_t count = 64 / _simd_width;
+    _simd_vec prev_input = _simd_zero();
+    _simd_vec prev_incomplete = _simd_zero();
+    while (static_cast<size_t>(_end - _begin) >= 64)
+    {
+        _simd_vec input[count];
+        _simd_vec any = _simd_zero();
+        for (size_t i = 0; i < count; ++i)
+        {
+            input[i] = _simd_load(_begin + i * _simd_width);
+            any = _simd_or(any, input[i]);
+        }
+
+        if (_simd_movemask(any) == 0)
+        {
+            // pure ascii, only a sequence left open by the previous block can be wrong.
+            if (_simd_any(prev_incomplete))
+                return _begin;
+        }
+        else
+        {
+            _simd_vec err = _simd_check_utf8(input[0], prev_input);
+            for (size_t i = 1; i < count; ++i)
+                err = _simd_or(err, _simd_check_utf8(input[i], input[i - 1]));
+            if (_simd_any(err))
+                return _begin;
+        }
+        prev_input = input[count - 1];
+        prev_incomplete = _simd_is_incomplete(prev_input);
+        _begin += 64;
+    }
+    return _begin;
+}
+
+#endif // defined(UTF8ER_SSSE3)
+
+// validates the contiguous bytes in between _begin and _end. On success the returned pointer is
+// nullptr, otherwise it points to the start of the first invalid sequence.
+inline std::pair<error_report, const uint8_t *> _validate_bytes(const uint8_t * _begin,
+                                                               const uint8_t * _end)
+{
+    const uint8_t * it = _begin;
+#if defined(UTF8ER_SSSE3)
+    it = _rewind_to_lead(_begin, _simd_valid_prefix(_begin, _end));
+#endif
+
+    // from here on the exact position and reason of errors is determined by decode_safe.
+    error_report err;
+    uint8_t bc;
+    while (it != _end)
+    {
+        if (is_ascii(*it))
+        {
+            it = _skip_ascii(it, _end);
+            continue;
+        }
+        _me::decode_safe(it, _end, err, &bc);
+        if (err)
+            return std::make_pair(err, it);
+        it += bc;
+    }
+    return std::make_pair(error_report(), nullptr);
+}
+
+template <class IT>
+constexpr std::pair<error_report, IT> _validate_impl(IT _begin, IT _end, std::false_type);
+
+template <class IT>
+constexpr std::pair<error_report, IT> _validate_impl(IT _begin, IT _end, std::true_type)
+{
+    if (_is_constant_evaluated())
+        return _validate_impl(_begin, _end, std::false_type());
+    if (_begin == _end)
+        return std::make_pair(error_report(), IT());
+
+    const uint8_t * begin = _byte_ptr(_begin);
+    auto result = _validate_bytes(begin, begin + (_end - _begin));
+    if (!result.first)
+        return std::make_pair(error_report(), IT());
+    return std::make_pair(result.first, _begin + (result.second - begin));
+}
+
+template <class IT>
+constexpr std::pair<error_report, IT> _validate_impl(IT _begin, IT _end, std::false_type)
+{
+    uint8_t bc = 0;
+    error_report err;
+    while (_begin != _end)
+    {
+        _me::decode_safe(_begin, _end, err, &bc);
+        if (err)
+            return std::make_pair(err, _begin);
+        _begin += bc;
+    }
+    return std::make_pair(error_report(), IT());
+}
+
+// copies the run of ascii bytes starting at _begin to _output_it and returns the first byte that
+// is not ascii (or _end).
+template <class OIT>
+const uint8_t * _decode_ascii(const uint8_t * _begin, const uint8_t * _end, OIT & _output_it)
+{
+    const uint8_t * run_end = _skip_ascii(_begin, _end);
+    for (; _begin != run_end; ++_begin)
+        *(_output_it++) = static_cast<uint32_t>(*_begin);
+    return run_end;
+}
+
+// raw uint32_t output allows to widen whole blocks of ascii bytes at once.
+inline const uint8_t * _decode_ascii(const uint8_t * _begin,
+                                     const uint8_t * _end,
+                                     uint32_t *& _output_it)
+{
+#if defined(UTF8ER_AVX2)
+    for (; _end - _begin >= 32; _begin += 32, _output_it += 32)
+    {
+        if (_mm256_movemask_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(_begin))))
+            break;
+        for (int i = 0; i < 4; ++i)
+        {
+            __m128i bytes = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(_begin + i * 8));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(_output_it + i * 8),
+                                _mm256_cvtepu8_epi32(bytes));
+        }
+    }
+#endif
+#if defined(UTF8ER_SSE2)
+    for (; _end - _begin >= 16; _begin += 16, _output_it += 16)
+    {
+        __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_begin));
+        if (_mm_movemask_epi8(bytes))
+            break;
+        __m128i zero = _mm_setzero_si128();
+        __m128i lo = _mm_unpacklo_epi8(bytes, zero);
+        __m128i hi = _mm_unpackhi_epi8(bytes, zero);
+        __m128i * out = reinterpret_cast<__m128i *>(_output_it);
+        _mm_storeu_si128(out, _mm_unpacklo_epi16(lo, zero));
+        _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(lo, zero));
+        _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(hi, zero));
+        _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(hi, zero));
+    }
+#else
+    for (; _end - _begin >= 8; _begin += 8, _output_it += 8)
+    {
+        uint64_t word;
+        std::memcpy(&word, _begin, 8);
+        if (word & 0x8080808080808080ull)
+            break;
+        for (int i = 0; i < 8; ++i)
+            _output_it[i] = _begin[i];
+    }
+#endif
+    while (_begin != _end && is_ascii(*_begin))
+        *(_output_it++) = *(_begin++);
+    return _begin;
 }
 
 template <class IT, class OIT>
-OIT encode_range_safe(IT _begin, IT _end, OIT _output_it, error_report & _out_error)
+OIT _decode_range_impl(IT _begin, IT _end, OIT _output_it, std::true_type)
+{
+    if (_begin == _end)
+        return _output_it;
+
+    const uint8_t * it = _byte_ptr(_begin);
+    const uint8_t * end = it + (_end - _begin);
+    uint32_t cp;
+    while (it != end)
+    {
+        if (is_ascii(*it))
+        {
+            it = _decode_ascii(it, end, _output_it);
+            continue;
+        }
+        it = _me::decode_and_next(it, cp);
+        *(_output_it++) = cp;
+    }
+    return _output_it;
+}
+
+template <class IT, class OIT>
+OIT _decode_range_impl(IT _begin, IT _end, OIT _output_it, std::false_type)
+{
+    uint32_t cp;
+    while (_begin != _end)
+    {
+        _begin = _me::decode_and_next(_begin, cp);
+        *(_output_it++) = cp;
+    }
+    return _output_it;
+}
+
+// decodes the contiguous bytes in between _begin and _end and returns the start of the first
+// invalid sequence, or _end on success.
+template <class OIT>
+const uint8_t * _decode_bytes_safe(const uint8_t * _begin,
+                                   const uint8_t * _end,
+                                   OIT & _output_it,
+                                   error_report & _out_error)
+{
+    uint32_t cp;
+    uint8_t bc;
+    while (_begin != _end)
+    {
+        if (is_ascii(*_begin))
+        {
+            _begin = _decode_ascii(_begin, _end, _output_it);
+            continue;
+        }
+        cp = _me::decode_safe(_begin, _end, _out_error, &bc);
+        if (_out_error)
+            return _begin;
+        *(_output_it++) = cp;
+        _begin += bc;
+    }
+    return _begin;
+}
+
+template <class IT, class OIT>
+OIT _decode_range_safe_impl(
+    IT _begin, IT _end, OIT _output_it, error_report & _out_error, std::true_type)
+{
+    if (_begin == _end)
+        return _output_it;
+
+    const uint8_t * it = _byte_ptr(_begin);
+    _decode_bytes_safe(it, it + (_end - _begin), _output_it, _out_error);
+    return _output_it;
+}
+
+template <class IT, class OIT>
+OIT _decode_range_safe_impl(
+    IT _begin, IT _end, OIT _output_it, error_report & _out_error, std::false_type)
 {
+    uint32_t cp;
     while (_begin != _end)
     {
-        *_output_it = _me::encode_safe(*(_begin++), _output_it, _out_error);
+        _begin = _me::decode_and_next_safe(_begin, _end, cp, _out_error);
         if (_out_error)
             return _output_it;
-        ++_output_it;
+        *(_output_it++) = cp;
     }
     return _output_it;
 }
 
-template <class T>
-typename output_iterator_picker<T>::output_iter append(uint32_t _codepoint, T & _append_string)
+// returns the number of bytes of the maximal invalid subpart starting at _begin, which is 1 if
+// the byte can't start a sequence and the number of bytes that match a valid sequence otherwise.
+template <class IT>
+size_t _maximal_subpart(IT _begin, IT _end)
 {
-    return _me::encode(_codepoint, output_iterator_picker<T>::iter(_append_string));
+    uint8_t a = *_begin;
+    size_t len;
+    uint8_t lo = 0x80, hi = 0xBF;
+    if (a >= 0xC2 && a <= 0xDF)
+        len = 2;
+    else if (a >= 0xE0 && a <= 0xEF)
+        len = 3, lo = a == 0xE0 ? 0xA0 : 0x80, hi = a == 0xED ? 0x9F : 0xBF;
+    else if (a >= 0xF0 && a <= 0xF4)
+        len = 4, lo = a == 0xF0 ? 0x90 : 0x80, hi = a == 0xF4 ? 0x8F : 0xBF;
+    else
+        return 1;
+
+    size_t i = 1;
+    for (++_begin; i < len && _begin != _end; ++i, ++_begin)
+    {
+        uint8_t b = *_begin;
+        if (b < lo || b > hi)
+            break;
+        lo = 0x80;
+        hi = 0xBF;
+    }
+    return i;
 }
 
-template <class T>
-typename output_iterator_picker<T>::output_iter append_safe(uint32_t _codepoint,
-                                                            T & _append_string,
-                                                            error_report & _out_error)
+// decodes the range and replaces (or drops if REPLACE is std::false_type) every maximal invalid
+// subpart. The first error is stored in _out_error.
+template <class REPLACE, class IT, class OIT>
+OIT _decode_range_lossy_impl(IT _begin,
+                             IT _end,
+                             OIT _output_it,
+                             std::vector<size_t> * _out_errors,
+                             error_report & _out_error,
+                             std::true_type)
+{
+    if (_begin == _end)
+        return _output_it;
+
+    // valid stretches are decoded by the bulk transcoder in blocks of _block_size bytes, which
+    // end at lead bytes to not cut valid sequences (see codepoint_range).
+    static constexpr size_t _block_size = 2048;
+    uint32_t buffer[_block_size];
+    const uint8_t * begin = _byte_ptr(_begin);
+    const uint8_t * end = begin + (_end - _begin);
+    const uint8_t * it = begin;
+    while (it != end)
+    {
+        const uint8_t * block_end = end;
+        if (static_cast<size_t>(end - it) > _block_size)
+        {
+            block_end = it + _block_size;
+            for (int i = 0; i < 3 && _is_valid_trailing_byte(*block_end); ++i)
+                --block_end;
+        }
+
+        transcode_result result = _me::transcode_to_utf32(
+            reinterpret_cast<const char *>(it), static_cast<size_t>(block_end - it), buffer);
+        _output_it = std::copy(buffer, buffer + result.produced, _output_it);
+        it += result.consumed;
+        if (!result.error)
+            continue;
+
+        // an incomplete sequence at the end of a block may just continue in the next one.
+        error_report err = result.error;
+        if (err.code == error_code::incomplete_sequence && block_end != end)
+        {
+            err = error_report();
+            _me::decode_safe(it, end, err);
+            if (!err)
+                continue;
+        }
+        if (!_out_error)
+            _out_error = err;
+        if (_out_errors)
+            _out_errors->push_back(static_cast<size_t>(it - begin));
+        if (REPLACE::value)
+            *(_output_it++) = replacement_character;
+        it += _maximal_subpart(it, end);
+    }
+    return _output_it;
+}
+
+template <class REPLACE, class IT, class OIT>
+OIT _decode_range_lossy_impl(IT _begin,
+                             IT _end,
+                             OIT _output_it,
+                             std::vector<size_t> * _out_errors,
+                             error_report & _out_error,
+                             std::false_type)
+{
+    error_report err;
+    uint8_t bc;
+    size_t offset = 0;
+    while (_begin != _end)
+    {
+        uint32_t cp = _me::decode_safe(_begin, _end, err, &bc);
+        if (!err)
+            *(_output_it++) = cp;
+        else
+        {
+            if (!_out_error)
+                _out_error = err;
+            err = error_report();
+            if (_out_errors)
+                _out_errors->push_back(offset);
+            if (REPLACE::value)
+                *(_output_it++) = replacement_character;
+            bc = static_cast<uint8_t>(_maximal_subpart(_begin, _end));
+        }
+        std::advance(_begin, bc);
+        offset += bc;
+    }
+    return _output_it;
+}
+
+template <class OIT>
+OIT _copy_bytes(const uint8_t * _begin, const uint8_t * _end, OIT _output_it)
 {
-    return _me::encode_safe(
-        _codepoint, output_iterator_picker<T>::iter(_append_string), _out_error);
+    return std::copy(_begin, _end, _output_it);
 }
 
-template <class IT, class STR>
-typename output_iterator_picker<STR>::output_iter append_range(IT _begin,
-                                                               IT _end,
-                                                               STR & _append_string)
+inline char * _copy_bytes(const uint8_t * _begin, const uint8_t * _end, char * _output_it)
 {
-    return _me::encode_range(_begin, _end, output_iterator_picker<STR>::iter(_append_string));
+    std::memcpy(_output_it, _begin, static_cast<size_t>(_end - _begin));
+    return _output_it + (_end - _begin);
 }
 
-template <class IT, class STR>
-typename output_iterator_picker<STR>::output_iter append_range_safe(IT _begin,
-                                                                    IT _end,
-                                                                    STR & _append_string,
-                                                                    error_report & _out_error)
+template <class IT, class OIT>
+OIT _sanitize_impl(
+    IT _begin, IT _end, OIT _output_it, std::vector<size_t> * _out_errors, std::true_type)
 {
-    return _me::encode_range_safe(
-        _begin, _end, output_iterator_picker<STR>::iter(_append_string), _out_error);
+    static const uint8_t replacement[] = { 0xEF, 0xBF, 0xBD };
+    if (_begin == _end)
+        return _output_it;
+
+    const uint8_t * begin = _byte_ptr(_begin);
+    const uint8_t * end = begin + (_end - _begin);
+    const uint8_t * it = begin;
+    while (true)
+    {
+        auto result = _validate_bytes(it, end);
+        const uint8_t * valid_end = result.first ? result.second : end;
+        _output_it = _copy_bytes(it, valid_end, _output_it);
+        if (!result.first)
+            return _output_it;
+        if (_out_errors)
+            _out_errors->push_back(static_cast<size_t>(valid_end - begin));
+        _output_it = std::copy(replacement, replacement + 3, _output_it);
+        it = valid_end + _maximal_subpart(valid_end, end);
+    }
+}
+
+template <class IT, class OIT>
+OIT _sanitize_impl(
+    IT _begin, IT _end, OIT _output_it, std::vector<size_t> * _out_errors, std::false_type)
+{
+    static const uint8_t replacement[] = { 0xEF, 0xBF, 0xBD };
+    error_report err;
+    uint8_t bc;
+    size_t offset = 0;
+    while (_begin != _end)
+    {
+        _me::decode_safe(_begin, _end, err, &bc);
+        if (err)
+        {
+            err = error_report();
+            if (_out_errors)
+                _out_errors->push_back(offset);
+            _output_it = std::copy(replacement, replacement + 3, _output_it);
+            bc = static_cast<uint8_t>(_maximal_subpart(_begin, _end));
+            std::advance(_begin, bc);
+        }
+        else
+        {
+            for (uint8_t i = 0; i < bc; ++i, ++_begin)
+                *(_output_it++) = *_begin;
+        }
+        offset += bc;
+    }
+    return _output_it;
+}
+
+// for every mask of N lanes to keep, holds the byte indices that move the kept lanes (of S bytes
+// each) to the front and the number of lanes kept. Used to compact the decoded codepoints.
+template <size_t N, size_t S>
+struct _compress_table
+{
+    constexpr _compress_table() : indices(), counts()
+    {
+        for (size_t mask = 0; mask < (1 << N); ++mask)
+        {
+            uint8_t c = 0;
+            for (uint8_t lane = 0; lane < N; ++lane)
+            {
+                if (!(mask & (1 << lane)))
+                    continue;
+                for (uint8_t b = 0; b < S; ++b)
+                    indices[mask][c * S + b] = static_cast<uint8_t>(lane * S + b);
+                ++c;
+            }
+            counts[mask] = c;
+        }
+    }
+
+    uint8_t indices[1 << N][N * S];
+    uint8_t counts[1 << N];
+};
+
+#if defined(UTF8ER_SSE41)
+
+#if defined(UTF8ER_AVX2)
+static constexpr size_t _decode_lanes = 8;
+
+// decodes the codepoints starting at all lead bytes in the 8 bytes at _ptr and writes them to
+// _output_it. Reads up to 3 bytes past the 8 bytes, and always stores 8 codepoints.
+inline void _simd_decode_lanes(const uint8_t * _ptr, uint32_t *& _output_it)
+{
+    static constexpr _compress_table<8, 1> table{};
+
+    __m256i b0 = _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(_ptr)));
+    __m256i b1 =
+        _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(_ptr + 1)));
+    __m256i b2 =
+        _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(_ptr + 2)));
+    __m256i b3 =
+        _mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(_ptr + 3)));
+
+    __m256i low6 = _mm256_set1_epi32(0x3F);
+    __m256i c1 = _mm256_and_si256(b1, low6);
+    __m256i c2 = _mm256_and_si256(b2, low6);
+    __m256i c3 = _mm256_and_si256(b3, low6);
+    __m256i cp2 = _mm256_or_si256(
+        _mm256_slli_epi32(_mm256_and_si256(b0, _mm256_set1_epi32(0x1F)), 6), c1);
+    __m256i cp3 = _mm256_or_si256(
+        _mm256_slli_epi32(_mm256_and_si256(b0, _mm256_set1_epi32(0x0F)), 12),
+        _mm256_or_si256(_mm256_slli_epi32(c1, 6), c2));
+    __m256i cp4 = _mm256_or_si256(
+        _mm256_or_si256(_mm256_slli_epi32(_mm256_and_si256(b0, _mm256_set1_epi32(0x07)), 18),
+                        _mm256_slli_epi32(c1, 12)),
+        _mm256_or_si256(_mm256_slli_epi32(c2, 6), c3));
+
+    __m256i cp = b0;
+    cp = _mm256_blendv_epi8(cp, cp2, _mm256_cmpgt_epi32(b0, _mm256_set1_epi32(0xBF)));
+    cp = _mm256_blendv_epi8(cp, cp3, _mm256_cmpgt_epi32(b0, _mm256_set1_epi32(0xDF)));
+    cp = _mm256_blendv_epi8(cp, cp4, _mm256_cmpgt_epi32(b0, _mm256_set1_epi32(0xEF)));
+
+    __m256i trailing = _mm256_cmpeq_epi32(_mm256_and_si256(b0, _mm256_set1_epi32(0xC0)),
+                                          _mm256_set1_epi32(0x80));
+    uint32_t mask =
+        ~static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(trailing))) & 0xFF;
+    __m256i perm = _mm256_cvtepu8_epi32(
+        _mm_loadl_epi64(reinterpret_cast<const __m128i *>(table.indices[mask])));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(_output_it),
+                        _mm256_permutevar8x32_epi32(cp, perm));
+    _output_it += table.counts[mask];
+}
+#else
+static constexpr size_t _decode_lanes = 4;
+
+inline __m128i _load_widened_4(const uint8_t * _ptr)
+{
+    std::int32_t bytes;
+    std::memcpy(&bytes, _ptr, 4);
+    return _mm_cvtepu8_epi32(_mm_cvtsi32_si128(bytes));
+}
+
+// SSE4.1 version of the function above, handles 4 bytes at a time.
+inline void _simd_decode_lanes(const uint8_t * _ptr, uint32_t *& _output_it)
+{
+    static constexpr _compress_table<4, 4> table{};
+
+    __m128i b0 = _load_widened_4(_ptr);
+    __m128i b1 = _load_widened_4(_ptr + 1);
+    __m128i b2 = _load_widened_4(_ptr + 2);
+    __m128i b3 = _load_widened_4(_ptr + 3);
+
+    __m128i low6 = _mm_set1_epi32(0x3F);
+    __m128i c1 = _mm_and_si128(b1, low6);
+    __m128i c2 = _mm_and_si128(b2, low6);
+    __m128i c3 = _mm_and_si128(b3, low6);
+    __m128i cp2 = _mm_or_si128(_mm_slli_epi32(_mm_and_si128(b0, _mm_set1_epi32(0x1F)), 6), c1);
+    __m128i cp3 = _mm_or_si128(_mm_slli_epi32(_mm_and_si128(b0, _mm_set1_epi32(0x0F)), 12),
+                               _mm_or_si128(_mm_slli_epi32(c1, 6), c2));
+    __m128i cp4 =
+        _mm_or_si128(_mm_or_si128(_mm_slli_epi32(_mm_and_si128(b0, _mm_set1_epi32(0x07)), 18),
+                                  _mm_slli_epi32(c1, 12)),
+                     _mm_or_si128(_mm_slli_epi32(c2, 6), c3));
+
+    __m128i cp = b0;
+    cp = _mm_blendv_epi8(cp, cp2, _mm_cmpgt_epi32(b0, _mm_set1_epi32(0xBF)));
+    cp = _mm_blendv_epi8(cp, cp3, _mm_cmpgt_epi32(b0, _mm_set1_epi32(0xDF)));
+    cp = _mm_blendv_epi8(cp, cp4, _mm_cmpgt_epi32(b0, _mm_set1_epi32(0xEF)));
+
+    __m128i trailing =
+        _mm_cmpeq_epi32(_mm_and_si128(b0, _mm_set1_epi32(0xC0)), _mm_set1_epi32(0x80));
+    uint32_t mask = ~static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(trailing))) & 0xF;
+
+    __m128i shuffle = _mm_loadu_si128(reinterpret_cast<const __m128i *>(table.indices[mask]));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(_output_it), _mm_shuffle_epi8(cp, shuffle));
+    _output_it += table.counts[mask];
 }
+#endif // defined(UTF8ER_AVX2)
+
+#endif // defined(UTF8ER_SSE41)
+
+inline transcode_result _transcode_to_utf32(const uint8_t * _begin,
+                                            const uint8_t * _end,
+                                            uint32_t * _output)
+{
+    const uint8_t * it = _begin;
+    uint32_t * out = _output;
+
+#if defined(UTF8ER_SSE41)
+    // validates and decodes 64 byte blocks. The decoding kernel reads a few bytes past the block.
+    static constexpr size_t count = 64 / _simd_width;
+    _simd_vec prev_input = _simd_zero();
+    _simd_vec prev_incomplete = _simd_zero();
+    while (static_cast<size_t>(_end - it) >= 64 + 8)
+    {
+        _simd_vec input[count];
+        _simd_vec any = _simd_zero();
+        for (size_t i = 0; i < count; ++i)
+        {
+            input[i] = _simd_load(it + i * _simd_width);
+            any = _simd_or(any, input[i]);
+        }
+
+        if (_simd_movemask(any) == 0)
+        {
+            if (_simd_any(prev_incomplete))
+                break;
+            _decode_ascii(it, it + 64, out);
+        }
+        else
+        {
+            _simd_vec err = _simd_check_utf8(input[0], prev_input);
+            for (size_t i = 1; i < count; ++i)
+                err = _simd_or(err, _simd_check_utf8(input[i], input[i - 1]));
+            if (_simd_any(err))
+                break;
+            for (size_t i = 0; i < 64; i += _decode_lanes)
+                _simd_decode_lanes(it + i, out);
+        }
+        prev_input = input[count - 1];
+        prev_incomplete = _simd_is_incomplete(prev_input);
+        it += 64;
+    }
+
+    // the sequence overlapping the end of the last block was decoded without knowing whether it
+    // is complete. Take it back and let the code below deal with it.
+    const uint8_t * lead = _rewind_to_lead(_begin, it);
+    if (lead != it)
+    {
+        it = lead;
+        --out;
+    }
+#endif
+
+    error_report err;
+    uint8_t bc;
+    while (it != _end)
+    {
+        if (is_ascii(*it))
+        {
+            it = _decode_ascii(it, _end, out);
+            continue;
+        }
+        uint32_t cp = _me::decode_safe(it, _end, err, &bc);
+        if (err)
+            return transcode_result(err, static_cast<size_t>(it - _begin),
+                                    static_cast<size_t>(out - _output));
+        *(out++) = cp;
+        it += bc;
+    }
+    return transcode_result(
+        err, static_cast<size_t>(_end - _begin), static_cast<size_t>(out - _output));
+}
+
+// true for iterators that are known to point into contiguous memory of codepoints.
+template <class IT>
+struct _is_contiguous_codepoint_iter
+    : std::integral_constant<bool,
+                             std::is_same<IT, uint32_t *>::value ||
+                                 std::is_same<IT, const uint32_t *>::value ||
+                                 std::is_same<IT, std::vector<uint32_t>::iterator>::value ||
+                                 std::is_same<IT, std::vector<uint32_t>::const_iterator>::value>
+{
+};
+
+// returns the address of the codepoint _it points to. _it must be dereferencable.
+template <class IT>
+const uint32_t * _codepoint_ptr(IT _it)
+{
+    return &*_it;
+}
+
+template <class OIT>
+struct _is_byte_output_ptr
+    : std::integral_constant<bool,
+                             std::is_same<OIT, char *>::value ||
+                                 std::is_same<OIT, unsigned char *>::value>
+{
+};
+
+#if defined(UTF8ER_SSSE3)
+
+// for all combinations of 4 utf8 sequence lengths (two bits each, length - 1), holds the byte
+// shuffle that packs the 4 byte lanes of the sequences and the total number of bytes.
+struct _encode_table
+{
+    constexpr _encode_table() : shuffles(), lengths()
+    {
+        for (size_t idx = 0; idx < 256; ++idx)
+        {
+            uint8_t c = 0;
+            for (uint8_t lane = 0; lane < 4; ++lane)
+            {
+                size_t len = ((idx >> (lane * 2)) & 3) + 1;
+                for (uint8_t b = 0; b < len; ++b)
+                    shuffles[idx][c++] = static_cast<uint8_t>(lane * 4 + b);
+            }
+            lengths[idx] = c;
+            for (; c < 16; ++c)
+                shuffles[idx][c] = 0x80;
+        }
+    }
+
+    uint8_t shuffles[256][16];
+    uint8_t lengths[256];
+};
+
+// spreads the 4 bits of a movemask so that every lane gets two bits.
+inline uint32_t _spread_lane_bits(uint32_t _mask)
+{
+    return (_mask & 1) | ((_mask & 2) << 1) | ((_mask & 4) << 2) | ((_mask & 8) << 3);
+}
+
+inline __m128i _select(__m128i _mask, __m128i _a, __m128i _b)
+{
+    return _mm_or_si128(_mm_and_si128(_mask, _a), _mm_andnot_si128(_mask, _b));
+}
+
+#endif // defined(UTF8ER_SSSE3)
+
+#if defined(UTF8ER_SSSE3)
+
+// returns true if none of the 4 codepoints in _cp is a surrogate or beyond the unicode range.
+inline bool _valid_4(__m128i _cp)
+{
+    __m128i surrogate = _mm_cmpeq_epi32(
+        _mm_and_si128(_cp, _mm_set1_epi32(static_cast<int>(0xFFFFF800))), _mm_set1_epi32(0xD800));
+    __m128i too_large =
+        _mm_cmpgt_epi32(_mm_xor_si128(_cp, _mm_set1_epi32(static_cast<int>(0x80000000))),
+                        _mm_set1_epi32(static_cast<int>(0x10FFFF ^ 0x80000000)));
+    return _mm_movemask_epi8(_mm_or_si128(surrogate, too_large)) == 0;
+}
+
+// encodes the 4 valid codepoints in _cp and stores them at _output_it. Always stores 16 bytes.
+inline void _encode_4(__m128i _cp, uint8_t *& _output_it)
+{
+    static constexpr _encode_table table{};
+    const __m128i low6 = _mm_set1_epi32(0x3F);
+    const __m128i cont = _mm_set1_epi32(0x80);
+
+    __m128i ge2 = _mm_cmpgt_epi32(_cp, _mm_set1_epi32(0x7F));
+    __m128i ge3 = _mm_cmpgt_epi32(_cp, _mm_set1_epi32(0x7FF));
+    __m128i ge4 = _mm_cmpgt_epi32(_cp, _mm_set1_epi32(0xFFFF));
+
+    // the bytes of every sequence in memory order, starting at the least significant byte.
+    __m128i t0 = _mm_or_si128(_mm_and_si128(_cp, low6), cont);
+    __m128i t1 = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(_cp, 6), low6), cont);
+    __m128i t2 = _mm_or_si128(_mm_and_si128(_mm_srli_epi32(_cp, 12), low6), cont);
+    __m128i two = _mm_or_si128(_mm_or_si128(_mm_set1_epi32(0xC0), _mm_srli_epi32(_cp, 6)),
+                               _mm_slli_epi32(t0, 8));
+    __m128i three = _mm_or_si128(_mm_or_si128(_mm_set1_epi32(0xE0), _mm_srli_epi32(_cp, 12)),
+                                 _mm_or_si128(_mm_slli_epi32(t1, 8), _mm_slli_epi32(t0, 16)));
+    __m128i four = _mm_or_si128(
+        _mm_or_si128(_mm_or_si128(_mm_set1_epi32(0xF0), _mm_srli_epi32(_cp, 18)),
+                     _mm_slli_epi32(t2, 8)),
+        _mm_or_si128(_mm_slli_epi32(t1, 16), _mm_slli_epi32(t0, 24)));
+    __m128i bytes = _select(ge4, four, _select(ge3, three, _select(ge2, two, _cp)));
+
+    uint32_t idx = _spread_lane_bits(_mm_movemask_ps(_mm_castsi128_ps(ge2))) +
+                   _spread_lane_bits(_mm_movemask_ps(_mm_castsi128_ps(ge3))) +
+                   _spread_lane_bits(_mm_movemask_ps(_mm_castsi128_ps(ge4)));
+    __m128i shuffle = _mm_loadu_si128(reinterpret_cast<const __m128i *>(table.shuffles[idx]));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(_output_it), _mm_shuffle_epi8(bytes, shuffle));
+    _output_it += table.lengths[idx];
+}
+
+#endif // defined(UTF8ER_SSSE3)
+
+// encodes blocks of codepoints starting at _begin until fewer than 16 valid codepoints are left.
+// Whole vectors of 16 bytes are stored, but only while at least 16 valid codepoints follow, so an
+// output sized for exactly the encoded length (up to the first invalid codepoint) is sufficient.
+inline const uint32_t * _encode_bulk(const uint32_t * _begin,
+                                     const uint32_t * _end,
+                                     uint8_t *& _output_it)
+{
+#if defined(UTF8ER_SSE2)
+    const __m128i not_ascii = _mm_set1_epi32(static_cast<int>(0xFFFFFF80));
+#if defined(UTF8ER_SSSE3)
+    // everything in between _begin and checked is known to be valid.
+    const uint32_t * checked = _begin;
+#endif
+    while (_end - _begin >= 16)
+    {
+        const __m128i * in = reinterpret_cast<const __m128i *>(_begin);
+        __m128i a = _mm_loadu_si128(in);
+        __m128i b = _mm_loadu_si128(in + 1);
+        __m128i c = _mm_loadu_si128(in + 2);
+        __m128i d = _mm_loadu_si128(in + 3);
+        __m128i any = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(any, not_ascii),
+                                              _mm_setzero_si128())) == 0xFFFF)
+        {
+            // 16 ascii codepoints, narrow them to bytes.
+            __m128i bytes = _mm_packs_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(_output_it), bytes);
+            _output_it += 16;
+            _begin += 16;
+            continue;
+        }
+#if defined(UTF8ER_SSSE3)
+        if (checked < _begin)
+            checked = _begin;
+        __m128i v[4] = { a, b, c, d };
+        for (int i = 0; i < 4; ++i)
+        {
+            if (checked - _begin < 16)
+            {
+                // check up to 64 codepoints ahead.
+                while (_end - checked >= 4 && checked - _begin < 64 &&
+                       _valid_4(_mm_loadu_si128(reinterpret_cast<const __m128i *>(checked))))
+                    checked += 4;
+                if (checked - _begin < 16)
+                    return _begin;
+            }
+            _encode_4(v[i], _output_it);
+            _begin += 4;
+        }
+#else
+        return _begin;
+#endif // defined(UTF8ER_SSSE3)
+    }
+#else
+    (void)_end;
+    (void)_output_it;
+#endif // defined(UTF8ER_SSE2)
+    return _begin;
+}
+
+// encodes the codepoints between _begin and _end to _output_it. If _out_error is provided, stops
+// at the first invalid codepoint.
+inline const uint32_t * _encode_to_bytes(const uint32_t * _begin,
+                                         const uint32_t * _end,
+                                         uint8_t *& _output_it,
+                                         error_report * _out_error)
+{
+    while (true)
+    {
+        _begin = _encode_bulk(_begin, _end, _output_it);
+        if (_begin == _end)
+            return _begin;
+
+        // deal with the rest or the block that contains the invalid codepoint one by one.
+        for (int i = 0; i < 4 && _begin != _end; ++i, ++_begin)
+        {
+            _output_it = _encode_impl(*_begin, _output_it, _out_error);
+            if (_out_error && *_out_error)
+                return _begin;
+        }
+    }
+}
+
+template <class IT, class OIT>
+OIT _encode_range_impl(IT _begin, IT _end, OIT _output_it, std::true_type)
+{
+    if (_begin == _end)
+        return _output_it;
+    const uint32_t * begin = _codepoint_ptr(_begin);
+    uint8_t * out = reinterpret_cast<uint8_t *>(_output_it);
+    _encode_to_bytes(begin, begin + (_end - _begin), out, nullptr);
+    return reinterpret_cast<OIT>(out);
+}
+
+template <class IT, class OIT>
+OIT _encode_range_impl(IT _begin, IT _end, OIT _output_it, std::false_type)
+{
+    while (_begin != _end)
+        _output_it = _me::encode(*(_begin++), _output_it);
+    return _output_it;
+}
+
+template <class IT, class OIT>
+OIT _encode_range_safe_impl(
+    IT _begin, IT _end, OIT _output_it, error_report & _out_error, std::true_type)
+{
+    if (_begin == _end)
+        return _output_it;
+    const uint32_t * begin = _codepoint_ptr(_begin);
+    uint8_t * out = reinterpret_cast<uint8_t *>(_output_it);
+    _encode_to_bytes(begin, begin + (_end - _begin), out, &_out_error);
+    return reinterpret_cast<OIT>(out);
+}
+
+template <class IT, class OIT>
+OIT _encode_range_safe_impl(
+    IT _begin, IT _end, OIT _output_it, error_report & _out_error, std::false_type)
+{
+    while (_begin != _end)
+    {
+        _output_it = _me::encode_safe(*(_begin++), _output_it, _out_error);
+        if (_out_error)
+            return _output_it;
+    }
+    return _output_it;
+}
+
+inline uint16_t _swap_unit(uint16_t _unit)
+{
+    return static_cast<uint16_t>((_unit << 8) | (_unit >> 8));
+}
+
+// loads the utf16 code unit at _ptr and swaps its bytes if it is not in the target byte order.
+inline uint32_t _load_unit(const uint16_t * _ptr, bool _swap)
+{
+    return _swap ? _swap_unit(*_ptr) : *_ptr;
+}
+
+#if defined(UTF8ER_SSE2)
+inline __m128i _swap_units(__m128i _v)
+{
+    return _mm_or_si128(_mm_slli_epi16(_v, 8), _mm_srli_epi16(_v, 8));
+}
+
+inline __m128i _load_units(const uint16_t * _ptr, bool _swap)
+{
+    __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_ptr));
+    return _swap ? _swap_units(v) : v;
+}
+
+inline void _store_units(uint16_t * _ptr, __m128i _v, bool _swap)
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(_ptr), _swap ? _swap_units(_v) : _v);
+}
+#endif // defined(UTF8ER_SSE2)
+
+// returns the number of utf16 units the utf8 between _begin and _end decodes to, which is the
+// number of lead bytes plus one for every 4 byte sequence.
+inline size_t _utf16_length(const uint8_t * _begin, const uint8_t * _end)
+{
+    size_t ret = 0;
+#if defined(UTF8ER_SSE2)
+    const __m128i threshold = _mm_set1_epi8(-65);
+    const __m128i four_lead = _mm_set1_epi8(static_cast<char>(0xF0));
+    while (_end - _begin >= 16)
+    {
+        // every lane counts up to two per iteration.
+        __m128i acc = _mm_setzero_si128();
+        for (int i = 0; i < 127 && _end - _begin >= 16; ++i, _begin += 16)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_begin));
+            acc = _mm_sub_epi8(acc, _mm_cmpgt_epi8(v, threshold));
+            acc = _mm_sub_epi8(acc, _mm_cmpeq_epi8(_mm_max_epu8(v, four_lead), v));
+        }
+        __m128i sum = _mm_sad_epu8(acc, _mm_setzero_si128());
+        ret += static_cast<size_t>(_mm_cvtsi128_si32(sum)) +
+               static_cast<size_t>(_mm_cvtsi128_si32(_mm_unpackhi_epi64(sum, sum)));
+    }
+#endif
+    for (; _begin != _end; ++_begin)
+        ret += !_is_valid_trailing_byte(*_begin) + (*_begin >= 0xF0);
+    return ret;
+}
+
+// returns the number of utf8 bytes the utf16 units between _begin and _end encode to. Every
+// surrogate counts two bytes, so that a pair counts four.
+inline size_t _utf8_length_from_utf16(const uint16_t * _begin, const uint16_t * _end, bool _swap)
+{
+    size_t ret = 0;
+#if defined(UTF8ER_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    while (_end - _begin >= 8)
+    {
+        // 3 bytes per unit, minus one for units below 0x800 (or surrogates) and minus one more
+        // for ascii. Every lane adds at most 3 per iteration.
+        __m128i acc = _mm_setzero_si128();
+        for (int i = 0; i < 8192 && _end - _begin >= 8; ++i, _begin += 8)
+        {
+            __m128i v = _load_units(_begin, _swap);
+            __m128i high = _mm_and_si128(v, _mm_set1_epi16(static_cast<short>(0xF800)));
+            __m128i ascii =
+                _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16(static_cast<short>(0xFF80))), zero);
+            __m128i two = _mm_or_si128(_mm_cmpeq_epi16(high, zero),
+                                       _mm_cmpeq_epi16(high, _mm_set1_epi16(-0x2800)));
+            acc = _mm_add_epi16(acc, _mm_add_epi16(_mm_set1_epi16(3), _mm_add_epi16(ascii, two)));
+        }
+        __m128i sum = _mm_madd_epi16(acc, _mm_set1_epi16(1));
+        sum = _mm_add_epi32(sum, _mm_unpackhi_epi64(sum, sum));
+        sum = _mm_add_epi32(sum, _mm_srli_epi64(sum, 32));
+        ret += static_cast<uint32_t>(_mm_cvtsi128_si32(sum));
+    }
+#endif
+    for (; _begin != _end; ++_begin)
+    {
+        uint32_t unit = _load_unit(_begin, _swap);
+        ret += unit < 0x80 ? 1 : unit < 0x800 || _check_surrogate(unit) ? 2 : 3;
+    }
+    return ret;
+}
+
+// writes the codepoints between _begin and _end as utf16 units to _output_it.
+inline void _utf32_to_utf16(const uint32_t * _begin,
+                            const uint32_t * _end,
+                            uint16_t *& _output_it,
+                            bool _swap)
+{
+#if defined(UTF8ER_SSE2)
+    const __m128i bias = _mm_set1_epi32(0x8000);
+    const __m128i not_bmp = _mm_set1_epi32(static_cast<int>(0xFFFF0000));
+    while (_end - _begin >= 8)
+    {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_begin));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_begin + 4));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi32(_mm_and_si128(_mm_or_si128(a, b), not_bmp),
+                                              _mm_setzero_si128())) != 0xFFFF)
+            break;
+        // packs saturates signed values, so move the units into the signed range and back.
+        __m128i units = _mm_xor_si128(
+            _mm_packs_epi32(_mm_sub_epi32(a, bias), _mm_sub_epi32(b, bias)),
+            _mm_set1_epi16(-0x8000));
+        _store_units(_output_it, units, _swap);
+        _output_it += 8;
+        _begin += 8;
+    }
+#endif
+    for (; _begin != _end; ++_begin)
+    {
+        uint32_t cp = *_begin;
+        if (cp < 0x10000)
+        {
+            uint16_t unit = static_cast<uint16_t>(cp);
+            *(_output_it++) = _swap ? _swap_unit(unit) : unit;
+            continue;
+        }
+        cp -= 0x10000;
+        uint16_t high = static_cast<uint16_t>(0xD800 | (cp >> 10));
+        uint16_t low = static_cast<uint16_t>(0xDC00 | (cp & 0x3FF));
+        *(_output_it++) = _swap ? _swap_unit(high) : high;
+        *(_output_it++) = _swap ? _swap_unit(low) : low;
+    }
+}
+
+inline transcode_result _transcode_to_utf16(const uint8_t * _begin,
+                                            const uint8_t * _end,
+                                            uint16_t * _output,
+                                            bool _swap)
+{
+    // non ascii input is decoded to utf32 in blocks of _block_size bytes and narrowed after.
+    static constexpr size_t _block_size = 2048;
+    uint32_t buffer[_block_size + 8];
+    const uint8_t * it = _begin;
+    uint16_t * out = _output;
+    while (it != _end)
+    {
+#if defined(UTF8ER_SSE2)
+        while (_end - it >= 16)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(it));
+            if (_mm_movemask_epi8(v))
+                break;
+            _store_units(out, _mm_unpacklo_epi8(v, _mm_setzero_si128()), _swap);
+            _store_units(out + 8, _mm_unpackhi_epi8(v, _mm_setzero_si128()), _swap);
+            out += 16;
+            it += 16;
+        }
+        if (it == _end)
+            break;
+#endif
+
+        // blocks end at lead bytes to not cut valid sequences, see codepoint_range.
+        const uint8_t * block_end = _end;
+        if (static_cast<size_t>(_end - it) > _block_size)
+        {
+            block_end = it + _block_size;
+            for (int i = 0; i < 3 && _is_valid_trailing_byte(*block_end); ++i)
+                --block_end;
+        }
+
+        transcode_result result = _transcode_to_utf32(it, block_end, buffer);
+        _utf32_to_utf16(buffer, buffer + result.produced, out, _swap);
+        it += result.consumed;
+        if (result.error)
+        {
+            // an incomplete sequence at the end of a block may just continue in the next one.
+            error_report err = result.error;
+            if (err.code == error_code::incomplete_sequence && block_end != _end)
+            {
+                err = error_report();
+                _me::decode_safe(it, _end, err);
+            }
+            if (err)
+                return transcode_result(
+                    err, static_cast<size_t>(it - _begin), static_cast<size_t>(out - _output));
+        }
+    }
+    return transcode_result(
+        error_report(), static_cast<size_t>(_end - _begin), static_cast<size_t>(out - _output));
+}
+
+// encodes blocks of 16 utf16 units without surrogates starting at _begin. Like _encode_bulk, it
+// stores 16 bytes for every 4 units, so it stops while enough units follow to fill those.
+inline const uint16_t * _encode_utf16_bulk(const uint16_t * _begin,
+                                           const uint16_t * _end,
+                                           uint8_t *& _output_it,
+                                           bool _swap)
+{
+#if defined(UTF8ER_SSE2)
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i not_ascii = _mm_set1_epi16(static_cast<short>(0xFF80));
+    while (_end - _begin >= 16)
+    {
+        __m128i a = _load_units(_begin, _swap);
+        __m128i b = _load_units(_begin + 8, _swap);
+        if (_mm_movemask_epi8(
+                _mm_cmpeq_epi16(_mm_and_si128(_mm_or_si128(a, b), not_ascii), zero)) == 0xFFFF)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(_output_it), _mm_packus_epi16(a, b));
+            _output_it += 16;
+            _begin += 16;
+            continue;
+        }
+#if defined(UTF8ER_SSSE3)
+        const __m128i surrogate_mask = _mm_set1_epi16(static_cast<short>(0xF800));
+        const __m128i surrogate = _mm_set1_epi16(-0x2800);
+        if (_end - _begin < 32 ||
+            _mm_movemask_epi8(
+                _mm_or_si128(_mm_cmpeq_epi16(_mm_and_si128(a, surrogate_mask), surrogate),
+                             _mm_cmpeq_epi16(_mm_and_si128(b, surrogate_mask), surrogate))))
+            return _begin;
+        _encode_4(_mm_unpacklo_epi16(a, zero), _output_it);
+        _encode_4(_mm_unpackhi_epi16(a, zero), _output_it);
+        _encode_4(_mm_unpacklo_epi16(b, zero), _output_it);
+        _encode_4(_mm_unpackhi_epi16(b, zero), _output_it);
+        _begin += 16;
+#else
+        return _begin;
+#endif // defined(UTF8ER_SSSE3)
+    }
+#else
+    (void)_end;
+    (void)_output_it;
+    (void)_swap;
+#endif // defined(UTF8ER_SSE2)
+    return _begin;
+}
+
+// combines the surrogate pairs of up to _max_count codepoints starting at _it and writes the
+// codepoints to _output. Stops at the first unpaired surrogate and returns the codepoint count.
+inline size_t _utf16_to_utf32(const uint16_t *& _it,
+                              const uint16_t * _end,
+                              uint32_t * _output,
+                              size_t _max_count,
+                              bool _swap,
+                              error_report & _out_error)
+{
+    size_t count = 0;
+    while (count < _max_count && _it != _end)
+    {
+#if defined(UTF8ER_SSE2)
+        if (_end - _it >= 8 && _max_count - count >= 8)
+        {
+            __m128i v = _load_units(_it, _swap);
+            __m128i high = _mm_and_si128(v, _mm_set1_epi16(static_cast<short>(0xF800)));
+            if (!_mm_movemask_epi8(_mm_cmpeq_epi16(high, _mm_set1_epi16(-0x2800))))
+            {
+                __m128i * out = reinterpret_cast<__m128i *>(_output + count);
+                _mm_storeu_si128(out, _mm_unpacklo_epi16(v, _mm_setzero_si128()));
+                _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(v, _mm_setzero_si128()));
+                count += 8;
+                _it += 8;
+                continue;
+            }
+        }
+#endif
+        uint32_t unit = _load_unit(_it, _swap);
+        if (!_check_surrogate(unit))
+        {
+            _output[count++] = unit;
+            ++_it;
+            continue;
+        }
+
+        if (unit >= 0xDC00)
+            _out_error = error_report(error_code::bad_codepoint);
+        else if (_end - _it < 2)
+            _out_error = error_report(error_code::incomplete_sequence);
+        else
+        {
+            uint32_t low = _load_unit(_it + 1, _swap);
+            if (low < 0xDC00 || low > 0xDFFF)
+                _out_error = error_report(error_code::bad_codepoint);
+            else
+            {
+                _output[count++] = 0x10000 + ((unit - 0xD800) << 10) + (low - 0xDC00);
+                _it += 2;
+                continue;
+            }
+        }
+        break;
+    }
+    return count;
+}
+
+inline transcode_result _transcode_utf16_to_utf8(const uint16_t * _begin,
+                                                 const uint16_t * _end,
+                                                 uint8_t * _output,
+                                                 bool _swap)
+{
+    const uint16_t * it = _begin;
+    uint8_t * out = _output;
+    error_report err;
+    uint32_t codepoints[256];
+    while (true)
+    {
+        it = _encode_utf16_bulk(it, _end, out, _swap);
+        if (it == _end)
+            break;
+
+        // text with surrogates is combined to codepoints first and encoded like utf32.
+        size_t count = _utf16_to_utf32(it, _end, codepoints, 256, _swap, err);
+        _encode_to_bytes(codepoints, codepoints + count, out, nullptr);
+        if (err)
+            return transcode_result(
+                err, static_cast<size_t>(it - _begin), static_cast<size_t>(out - _output));
+    }
+    return transcode_result(
+        err, static_cast<size_t>(_end - _begin), static_cast<size_t>(out - _output));
+}
+
+// returns the number of bytes the latin1 text between _begin and _end encodes to as utf8, which
+// is one byte per character plus one for every character >= 0x80.
+inline size_t _latin1_to_utf8_length(const uint8_t * _begin, const uint8_t * _end)
+{
+    size_t ret = static_cast<size_t>(_end - _begin);
+#if defined(UTF8ER_SSE2)
+    while (_end - _begin >= 16)
+    {
+        __m128i acc = _mm_setzero_si128();
+        for (int i = 0; i < 255 && _end - _begin >= 16; ++i, _begin += 16)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_begin));
+            acc = _mm_sub_epi8(acc, _mm_cmplt_epi8(v, _mm_setzero_si128()));
+        }
+        __m128i sum = _mm_sad_epu8(acc, _mm_setzero_si128());
+        ret += static_cast<size_t>(_mm_cvtsi128_si32(sum)) +
+               static_cast<size_t>(_mm_cvtsi128_si32(_mm_unpackhi_epi64(sum, sum)));
+    }
+#endif
+    for (; _begin != _end; ++_begin)
+        ret += *_begin >= 0x80;
+    return ret;
+}
+
+#if defined(UTF8ER_SSSE3)
+
+// for every mask of the latin1 characters >= 0x80 in 8 characters that were widened to two
+// bytes each, holds the byte shuffle that drops the unused second byte of the others and the
+// total number of bytes.
+struct _latin1_table
+{
+    constexpr _latin1_table() : shuffles(), lengths()
+    {
+        for (size_t mask = 0; mask < 256; ++mask)
+        {
+            uint8_t c = 0;
+            for (uint8_t lane = 0; lane < 8; ++lane)
+            {
+                shuffles[mask][c++] = static_cast<uint8_t>(lane * 2);
+                if (mask & (1 << lane))
+                    shuffles[mask][c++] = static_cast<uint8_t>(lane * 2 + 1);
+            }
+            lengths[mask] = c;
+            for (; c < 16; ++c)
+                shuffles[mask][c] = 0x80;
+        }
+    }
+
+    uint8_t shuffles[256][16];
+    uint8_t lengths[256];
+};
+
+// encodes the 8 latin1 characters in the lower half of _v and stores them at _output_it. Always
+// stores 16 bytes.
+inline void _encode_latin1_8(__m128i _v, uint8_t *& _output_it)
+{
+    static constexpr _latin1_table table{};
+    __m128i chars = _mm_unpacklo_epi8(_v, _mm_setzero_si128());
+    __m128i wide = _mm_cmpgt_epi16(chars, _mm_set1_epi16(0x7F));
+    __m128i lead = _mm_or_si128(_mm_srli_epi16(chars, 6), _mm_set1_epi16(0xC0));
+    __m128i cont = _mm_or_si128(_mm_and_si128(chars, _mm_set1_epi16(0x3F)), _mm_set1_epi16(0x80));
+    __m128i bytes = _select(wide, _mm_or_si128(lead, _mm_slli_epi16(cont, 8)), chars);
+
+    uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_packs_epi16(wide, wide))) & 0xFF;
+    __m128i shuffle = _mm_loadu_si128(reinterpret_cast<const __m128i *>(table.shuffles[mask]));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(_output_it), _mm_shuffle_epi8(bytes, shuffle));
+    _output_it += table.lengths[mask];
+}
+
+#endif // defined(UTF8ER_SSSE3)
+
+inline uint8_t * _latin1_to_utf8(const uint8_t * _begin, const uint8_t * _end, uint8_t * _output)
+{
+#if defined(UTF8ER_SSE2)
+    while (_end - _begin >= 16)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_begin));
+        if (!_mm_movemask_epi8(v))
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(_output), v);
+            _output += 16;
+            _begin += 16;
+            continue;
+        }
+#if defined(UTF8ER_SSSE3)
+        // every character takes at least one byte, so the 16 byte stores never exceed the output
+        // while 16 more characters follow.
+        if (_end - _begin < 32)
+            break;
+        _encode_latin1_8(v, _output);
+        _encode_latin1_8(_mm_srli_si128(v, 8), _output);
+        _begin += 16;
+#else
+        break;
+#endif // defined(UTF8ER_SSSE3)
+    }
+#endif // defined(UTF8ER_SSE2)
+    for (; _begin != _end; ++_begin)
+    {
+        if (*_begin < 0x80)
+        {
+            *(_output++) = *_begin;
+            continue;
+        }
+        *(_output++) = static_cast<uint8_t>(0xC0 | (*_begin >> 6));
+        *(_output++) = static_cast<uint8_t>(0x80 | (*_begin & 0x3F));
+    }
+    return _output;
+}
+
+// converts the valid utf8 between _begin and _end to latin1 until the first sequence of a
+// codepoint beyond 0xFF, which is returned (or _end). The vectors are only stored while there is
+// room for them before _output_end, _output_end has to leave room for all codepoints though.
+inline const uint8_t * _valid_utf8_to_latin1(const uint8_t * _begin,
+                                             const uint8_t * _end,
+                                             uint8_t *& _output_it,
+                                             const uint8_t * _output_end)
+{
+#if defined(UTF8ER_SSE41)
+    static constexpr _compress_table<8, 1> table{};
+    // all lead bytes of codepoints < 0x100 are below 0xC4, continuation bytes are below 0xC0.
+    const __m128i too_large = _mm_set1_epi8(static_cast<char>(0xC4));
+    while (_end - _begin >= 32 && _output_end - _output_it >= 24)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_begin));
+        uint32_t non_ascii = static_cast<uint32_t>(_mm_movemask_epi8(v));
+        if (!non_ascii)
+        {
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(_output_it), v);
+            _output_it += 16;
+            _begin += 16;
+            continue;
+        }
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(v, too_large), v)))
+            break;
+
+        // the lead bytes combine with the next byte, the continuation bytes are dropped. As the
+        // input is valid, every lead byte is followed by a continuation byte.
+        __m128i next = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_begin + 1));
+        __m128i lead = _mm_cmpeq_epi8(_mm_max_epu8(v, _mm_set1_epi8(static_cast<char>(0xC0))), v);
+        __m128i combined =
+            _mm_or_si128(_mm_slli_epi16(_mm_and_si128(v, _mm_set1_epi8(0x03)), 6),
+                         _mm_and_si128(next, _mm_set1_epi8(0x3F)));
+        __m128i chars = _mm_blendv_epi8(v, combined, lead);
+        uint32_t keep = ~(non_ascii & ~static_cast<uint32_t>(_mm_movemask_epi8(lead))) & 0xFFFF;
+
+        // the first store writes 8 bytes at most and the second one starts behind them, so both
+        // stay within the 24 bytes of room.
+        __m128i shuffle =
+            _mm_loadl_epi64(reinterpret_cast<const __m128i *>(table.indices[keep & 0xFF]));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(_output_it), _mm_shuffle_epi8(chars, shuffle));
+        _output_it += table.counts[keep & 0xFF];
+        shuffle = _mm_loadl_epi64(reinterpret_cast<const __m128i *>(table.indices[keep >> 8]));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(_output_it),
+                         _mm_shuffle_epi8(_mm_srli_si128(chars, 8), shuffle));
+        _output_it += table.counts[keep >> 8];
+        _begin += 16;
+    }
+#else
+    (void)_output_end;
+#endif // defined(UTF8ER_SSE41)
+    while (_begin != _end)
+    {
+        if (*_begin >= 0xC4)
+            return _begin;
+        if (*_begin < 0x80)
+        {
+            *(_output_it++) = *(_begin++);
+            continue;
+        }
+        if (_is_valid_trailing_byte(*_begin))
+        {
+            // the tail of a sequence that was combined in a vector.
+            ++_begin;
+            continue;
+        }
+        *(_output_it++) = static_cast<uint8_t>(((*_begin & 0x03) << 6) | (_begin[1] & 0x3F));
+        _begin += 2;
+    }
+    return _begin;
+}
+
+// _output needs room for _capacity bytes, which have to fit all codepoints of the valid part.
+inline transcode_result _utf8_to_latin1(const uint8_t * _begin,
+                                        const uint8_t * _end,
+                                        uint8_t * _output,
+                                        size_t _capacity)
+{
+    // validate first, then convert the valid part.
+    std::pair<error_report, const uint8_t *> valid = _validate_bytes(_begin, _end);
+    const uint8_t * valid_end = valid.first ? valid.second : _end;
+    uint8_t * out = _output;
+    const uint8_t * it = _valid_utf8_to_latin1(_begin, valid_end, out, _output + _capacity);
+    error_report err = it != valid_end ? error_report(error_code::bad_codepoint) : valid.first;
+    return transcode_result(
+        err, static_cast<size_t>(it - _begin), static_cast<size_t>(out - _output));
+}
+
+// returns the number of bytes per codepoint codepoint_array needs for the utf8 in between _begin
+// and _end. All codepoints are below 0x100 if the largest byte is below 0xC4 and below 0x10000
+// if it is below 0xF0.
+inline size_t _codepoint_width(const uint8_t * _begin, const uint8_t * _end)
+{
+    size_t ret = 1;
+#if defined(UTF8ER_SSE2)
+    const __m128i two = _mm_set1_epi8(static_cast<char>(0xC4));
+    const __m128i four = _mm_set1_epi8(static_cast<char>(0xF0));
+    while (_end - _begin >= 16)
+    {
+        // checks the largest byte of every 1024 bytes, to stop early once 4 bytes are needed.
+        __m128i acc = _mm_setzero_si128();
+        for (int i = 0; i < 64 && _end - _begin >= 16; ++i, _begin += 16)
+            acc = _mm_max_epu8(acc, _mm_loadu_si128(reinterpret_cast<const __m128i *>(_begin)));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(acc, four), acc)))
+            return 4;
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(acc, two), acc)))
+            ret = 2;
+    }
+#endif
+    for (; _begin != _end; ++_begin)
+    {
+        if (*_begin >= 0xF0)
+            return 4;
+        if (*_begin >= 0xC4)
+            ret = 2;
+    }
+    return ret;
+}
+
+// returns the number of bytes in between _begin and _end that are not continuation bytes, which is
+// the number of codepoints for valid utf8.
+inline size_t _count_leads(const uint8_t * _begin, const uint8_t * _end)
+{
+    size_t ret = 0;
+#if defined(UTF8ER_AVX2)
+    while (_end - _begin >= 32)
+    {
+        __m256i acc = _mm256_setzero_si256();
+        for (int i = 0; i < 255 && _end - _begin >= 32; ++i, _begin += 32)
+        {
+            __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(_begin));
+            acc = _mm256_sub_epi8(acc, _mm256_cmpgt_epi8(v, _mm256_set1_epi8(-65)));
+        }
+        __m256i sum = _mm256_sad_epu8(acc, _mm256_setzero_si256());
+        ret += static_cast<size_t>(_mm256_extract_epi64(sum, 0) + _mm256_extract_epi64(sum, 1) +
+                                   _mm256_extract_epi64(sum, 2) + _mm256_extract_epi64(sum, 3));
+    }
+#endif
+#if defined(UTF8ER_SSE2)
+    // continuation bytes are the only bytes <= -65 as signed chars. Every lane of acc counts
+    // the lead bytes seen at its position for up to 255 iterations.
+    const __m128i threshold = _mm_set1_epi8(-65);
+    while (_end - _begin >= 16)
+    {
+        __m128i acc = _mm_setzero_si128();
+        for (int i = 0; i < 255 && _end - _begin >= 16; ++i, _begin += 16)
+        {
+            __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_begin));
+            acc = _mm_sub_epi8(acc, _mm_cmpgt_epi8(v, threshold));
+        }
+        __m128i sum = _mm_sad_epu8(acc, _mm_setzero_si128());
+        ret += static_cast<size_t>(_mm_cvtsi128_si32(sum)) +
+               static_cast<size_t>(_mm_cvtsi128_si32(_mm_unpackhi_epi64(sum, sum)));
+    }
+#else
+    for (; _end - _begin >= 8; _begin += 8)
+    {
+        uint64_t word;
+        std::memcpy(&word, _begin, 8);
+        // one bit per continuation byte (10______), summed up by the multiplication.
+        uint64_t cont = (word >> 7) & ~(word >> 6) & 0x0101010101010101ull;
+        ret += 8 - static_cast<size_t>((cont * 0x0101010101010101ull) >> 56);
+    }
+#endif
+    for (; _begin != _end; ++_begin)
+        ret += !_is_valid_trailing_byte(*_begin);
+    return ret;
+}
+
+inline uint32_t _popcount(uint32_t _v)
+{
+#if defined(_MSC_VER)
+    return static_cast<uint32_t>(__popcnt(_v));
+#else
+    return static_cast<uint32_t>(__builtin_popcount(_v));
+#endif
+}
+
+// counts the lead bytes of the null terminated _str in the same pass that looks for the
+// terminator. Uses aligned loads that can read past the terminator, but never across a page
+// boundary.
+UTF8ER_NO_SANITIZE_ADDRESS
+inline size_t _count_leads_c_str(const uint8_t * _str)
+{
+#if defined(UTF8ER_SSE2)
+    const __m128i threshold = _mm_set1_epi8(-65);
+    const __m128i zero = _mm_setzero_si128();
+    std::uintptr_t addr = reinterpret_cast<std::uintptr_t>(_str);
+    const uint8_t * block = reinterpret_cast<const uint8_t *>(addr & ~std::uintptr_t(15));
+    uint32_t skip = ~0u << static_cast<uint32_t>(_str - block);
+    size_t ret = 0;
+    while (true)
+    {
+        __m128i v = _mm_load_si128(reinterpret_cast<const __m128i *>(block));
+        uint32_t terminators = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, zero)));
+        uint32_t leads = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(v, threshold)));
+        terminators &= skip;
+        leads &= skip;
+        if (terminators)
+            return ret + _popcount(leads & ((terminators & (0u - terminators)) - 1));
+        ret += _popcount(leads);
+        skip = ~0u;
+        block += 16;
+    }
+#else
+    size_t ret = 0;
+    for (; *_str; ++_str)
+        ret += !_is_valid_trailing_byte(*_str);
+    return ret;
+#endif
+}
+
+template <class IT>
+constexpr typename std::iterator_traits<IT>::difference_type _distance_impl(IT _begin,
+                                                                            IT _end,
+                                                                            std::false_type);
+
+template <class IT>
+constexpr typename std::iterator_traits<IT>::difference_type _distance_impl(IT _begin,
+                                                                            IT _end,
+                                                                            std::true_type)
+{
+    using diff_t = typename std::iterator_traits<IT>::difference_type;
+    if (_is_constant_evaluated())
+        return _distance_impl(_begin, _end, std::false_type());
+    if (_begin == _end)
+        return 0;
+    if (_begin < _end)
+    {
+        const uint8_t * begin = _byte_ptr(_begin);
+        return static_cast<diff_t>(_count_leads(begin, begin + (_end - _begin)));
+    }
+    const uint8_t * end = _byte_ptr(_end);
+    return -static_cast<diff_t>(_count_leads(end, end + (_begin - _end)));
+}
+
+template <class IT>
+constexpr typename std::iterator_traits<IT>::difference_type _distance_impl(IT _begin,
+                                                                            IT _end,
+                                                                            std::false_type)
+{
+    if (_begin == _end)
+        return 0;
+
+    typename std::iterator_traits<IT>::difference_type ret = 0;
+    if (_begin < _end)
+    {
+        while (_begin != _end)
+        {
+            ++ret;
+            _begin = _me::next(_begin);
+        }
+    }
+    else
+    {
+        while (_begin != _end)
+        {
+            --ret;
+            _begin = _me::previous(_begin);
+        }
+    }
+    return ret;
+}
+
+// number of bytes _encode_impl writes for _codepoint.
+inline size_t _utf8_length(uint32_t _codepoint)
+{
+    return 1 + (_codepoint >= 0x80) + (_codepoint >= 0x800) + (_codepoint >= 0x10000);
+}
+
+inline size_t _utf8_length(const uint32_t * _begin, const uint32_t * _end)
+{
+    size_t ret = static_cast<size_t>(_end - _begin);
+#if defined(UTF8ER_SSE2)
+    // unsigned comparisons by flipping the sign bits. Every lane of acc counts the extra bytes
+    // needed by the codepoints at its position.
+    const __m128i sign = _mm_set1_epi32(static_cast<int>(0x80000000));
+    const __m128i t2 = _mm_set1_epi32(static_cast<int>(0x7F ^ 0x80000000));
+    const __m128i t3 = _mm_set1_epi32(static_cast<int>(0x7FF ^ 0x80000000));
+    const __m128i t4 = _mm_set1_epi32(static_cast<int>(0xFFFF ^ 0x80000000));
+    while (_end - _begin >= 4)
+    {
+        __m128i acc = _mm_setzero_si128();
+        for (int i = 0; i < 65536 && _end - _begin >= 4; ++i, _begin += 4)
+        {
+            __m128i v = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i *>(_begin)),
+                                      sign);
+            acc = _mm_sub_epi32(acc, _mm_cmpgt_epi32(v, t2));
+            acc = _mm_sub_epi32(acc, _mm_cmpgt_epi32(v, t3));
+            acc = _mm_sub_epi32(acc, _mm_cmpgt_epi32(v, t4));
+        }
+        std::int32_t lanes[4];
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(lanes), acc);
+        ret += static_cast<size_t>(lanes[0]) + static_cast<size_t>(lanes[1]) +
+               static_cast<size_t>(lanes[2]) + static_cast<size_t>(lanes[3]);
+    }
+#endif
+    for (; _begin != _end; ++_begin)
+        ret += _utf8_length(*_begin) - 1;
+    return ret;
+}
+
+// decodes blocks of as many bytes as there is room for codepoints, which is what
+// _transcode_to_utf32 needs to not write past the output. Blocks end at lead bytes like in
+// _transcode_to_utf16, the last few codepoints are decoded one by one.
+inline transcode_result _transcode_to_utf32_bounded(const uint8_t * _begin,
+                                                    const uint8_t * _end,
+                                                    uint32_t * _output,
+                                                    size_t _capacity)
+{
+    const uint8_t * it = _begin;
+    uint32_t * out = _output;
+    uint32_t * out_end = _output + _capacity;
+    while (it != _end && out != out_end)
+    {
+        size_t room = static_cast<size_t>(out_end - out);
+        if (room < 16)
+        {
+            error_report err;
+            uint8_t bc;
+            uint32_t cp = _me::decode_safe(it, _end, err, &bc);
+            if (err)
+                return transcode_result(
+                    err, static_cast<size_t>(it - _begin), static_cast<size_t>(out - _output));
+            *(out++) = cp;
+            it += bc;
+            continue;
+        }
+
+        const uint8_t * block_end = _end;
+        if (static_cast<size_t>(_end - it) > room)
+        {
+            block_end = it + room;
+            for (int i = 0; i < 3 && _is_valid_trailing_byte(*block_end); ++i)
+                --block_end;
+        }
+
+        transcode_result result = _transcode_to_utf32(it, block_end, out);
+        it += result.consumed;
+        out += result.produced;
+        if (result.error)
+        {
+            error_report err = result.error;
+            if (err.code == error_code::incomplete_sequence && block_end != _end)
+            {
+                err = error_report();
+                _me::decode_safe(it, _end, err);
+            }
+            if (err)
+                return transcode_result(
+                    err, static_cast<size_t>(it - _begin), static_cast<size_t>(out - _output));
+        }
+    }
+    return transcode_result(
+        error_report(), static_cast<size_t>(it - _begin), static_cast<size_t>(out - _output));
+}
+
+// encodes blocks of as many codepoints as fit in the output with 4 bytes each. Computing the
+// exact length of larger blocks upfront costs about as much as encoding them. The last few
+// codepoints are encoded one by one to see whether they fit.
+inline transcode_result _transcode_to_utf8_bounded(const uint32_t * _begin,
+                                                   const uint32_t * _end,
+                                                   uint8_t * _output,
+                                                   size_t _capacity)
+{
+    const uint32_t * it = _begin;
+    uint8_t * out = _output;
+    uint8_t * out_end = _output + _capacity;
+    error_report err;
+    while (it != _end)
+    {
+        size_t room = static_cast<size_t>(out_end - out);
+        if (room < 64)
+        {
+            uint8_t bytes[4];
+            uint8_t * bytes_end = _encode_impl(*it, bytes, &err);
+            size_t bc = static_cast<size_t>(bytes_end - bytes);
+            if (err || bc > room)
+                break;
+            std::memcpy(out, bytes, bc);
+            out += bc;
+            ++it;
+            continue;
+        }
+
+        size_t count = std::min(static_cast<size_t>(_end - it), room / 4);
+
+        it = _encode_to_bytes(it, it + count, out, &err);
+        if (err)
+            break;
+    }
+    return transcode_result(
+        err, static_cast<size_t>(it - _begin), static_cast<size_t>(out - _output));
+}
+
+template <class IT>
+size_t _utf8_length_impl(IT _begin, IT _end, std::true_type)
+{
+    if (_begin == _end)
+        return 0;
+    const uint32_t * begin = _codepoint_ptr(_begin);
+    return _utf8_length(begin, begin + (_end - _begin));
+}
+
+template <class IT>
+size_t _utf8_length_impl(IT _begin, IT _end, std::false_type)
+{
+    size_t ret = 0;
+    for (; _begin != _end; ++_begin)
+        ret += _utf8_length(static_cast<uint32_t>(*_begin));
+    return ret;
+}
+
+// containers that can be resized once and then written to through a raw pointer by the append
+// functions.
+template <class T>
+struct _is_resizable_byte_container : std::false_type
+{
+};
+
+template <class C, class TR, class A>
+struct _is_resizable_byte_container<std::basic_string<C, TR, A>> : _is_byte<C>
+{
+};
+
+template <class C, class A>
+struct _is_resizable_byte_container<std::vector<C, A>> : _is_byte<C>
+{
+};
+
+template <class T>
+struct _is_resizable_codepoint_container : std::false_type
+{
+};
+
+template <class A>
+struct _is_resizable_codepoint_container<std::vector<uint32_t, A>> : std::true_type
+{
+};
+
+// the sizing pass requires the input to be traversed twice.
+template <class IT>
+struct _is_multi_pass
+    : std::is_base_of<std::forward_iterator_tag,
+                      typename std::iterator_traits<IT>::iterator_category>
+{
+};
+
+// grows _container by _count elements and returns a pointer to the first new element.
+template <class T>
+typename T::value_type * _grow(T & _container, size_t _count)
+{
+    size_t old = _container.size();
+    _container.resize(old + _count);
+    return _count ? &_container[old] : nullptr;
+}
+
+template <class IT, class STR>
+void _append_range_impl(IT _begin, IT _end, STR & _append_string, std::true_type)
+{
+    size_t size = _me::utf8_length(_begin, _end);
+    _me::encode_range(_begin, _end, _grow(_append_string, size));
+}
+
+template <class IT, class STR>
+void _append_range_impl(IT _begin, IT _end, STR & _append_string, std::false_type)
+{
+    _me::encode_range(_begin, _end, output_iterator_picker<STR>::iter(_append_string));
+}
+
+template <class IT, class STR>
+void _append_range_safe_impl(
+    IT _begin, IT _end, STR & _append_string, error_report & _out_error, std::true_type)
+{
+    size_t old = _append_string.size();
+    size_t size = _me::utf8_length(_begin, _end);
+    auto * begin = _grow(_append_string, size);
+    auto * end = _me::encode_range_safe(_begin, _end, begin, _out_error);
+    // nothing is written past an invalid codepoint.
+    _append_string.resize(old + static_cast<size_t>(end - begin));
+}
+
+template <class IT, class STR>
+void _append_range_safe_impl(
+    IT _begin, IT _end, STR & _append_string, error_report & _out_error, std::false_type)
+{
+    _me::encode_range_safe(
+        _begin, _end, output_iterator_picker<STR>::iter(_append_string), _out_error);
+}
+
+template <class IT, class T>
+void _decode_range_and_append_impl(IT _begin, IT _end, T & _append_container, std::true_type)
+{
+    size_t size = _me::utf32_length(_begin, _end);
+    _me::decode_range(_begin, _end, _grow(_append_container, size));
+}
+
+template <class IT, class T>
+void _decode_range_and_append_impl(IT _begin, IT _end, T & _append_container, std::false_type)
+{
+    _me::decode_range(_begin, _end, output_iterator_picker<T>::iter(_append_container));
+}
+
+template <class...>
+struct _void
+{
+    using type = void;
+};
+
+// true if OIT provides the optional bulk sink interface for units of type T, see
+// output_iterator_picker.
+template <class OIT, class T, class = void>
+struct _is_bulk_sink : std::false_type
+{
+};
+
+template <class OIT, class T>
+struct _is_bulk_sink<
+    OIT,
+    T,
+    typename _void<decltype(std::declval<OIT &>().reserve(size_t())),
+                   decltype(std::declval<OIT &>().write(std::declval<const T *>(), size_t())),
+                   decltype(std::declval<OIT &>().commit())>::type> : std::true_type
+{
+};
+
+// the number of units buffered before they are handed to a sink.
+static constexpr size_t _sink_block_size = 256;
+
+template <class IT, class F>
+void _reserve_if_multi_pass(IT _begin, IT _end, F _reserve, std::true_type)
+{
+    _reserve(_begin, _end);
+}
+
+template <class IT, class F>
+void _reserve_if_multi_pass(IT, IT, F, std::false_type)
+{
+}
+
+// encodes to a stack buffer and writes it to the sink in blocks.
+template <class IT, class OIT>
+void _encode_to_sink(IT _begin, IT _end, OIT & _sink, error_report * _out_error, std::true_type)
+{
+    if (_begin == _end)
+        return;
+    const uint32_t * it = _codepoint_ptr(_begin);
+    const uint32_t * end = it + (_end - _begin);
+    uint8_t buffer[_sink_block_size * 4];
+    while (it != end)
+    {
+        uint8_t * out = buffer;
+        const uint32_t * block_end = it + std::min(_sink_block_size, static_cast<size_t>(end - it));
+        it = _encode_to_bytes(it, block_end, out, _out_error);
+        _sink.write(buffer, static_cast<size_t>(out - buffer));
+        if (_out_error && *_out_error)
+            return;
+    }
+}
+
+template <class IT, class OIT>
+void _encode_to_sink(IT _begin, IT _end, OIT & _sink, error_report * _out_error, std::false_type)
+{
+    uint8_t buffer[_sink_block_size * 4];
+    while (_begin != _end)
+    {
+        uint8_t * out = buffer;
+        for (size_t i = 0; i < _sink_block_size && _begin != _end; ++i, ++_begin)
+        {
+            out = _encode_impl(static_cast<uint32_t>(*_begin), out, _out_error);
+            if (_out_error && *_out_error)
+                break;
+        }
+        _sink.write(buffer, static_cast<size_t>(out - buffer));
+        if (_out_error && *_out_error)
+            return;
+    }
+}
+
+template <class IT, class OIT>
+OIT _encode_range_sink(IT _begin, IT _end, OIT _sink, error_report * _out_error)
+{
+    _reserve_if_multi_pass(
+        _begin,
+        _end,
+        [&_sink](IT _b, IT _e) { _sink.reserve(_me::utf8_length(_b, _e)); },
+        _is_multi_pass<IT>());
+    _encode_to_sink(_begin, _end, _sink, _out_error, _is_contiguous_codepoint_iter<IT>());
+    _sink.commit();
+    return _sink;
+}
+
+// decodes to a stack buffer and writes it to the sink in blocks.
+template <class IT, class OIT>
+void _decode_to_sink(IT _begin, IT _end, OIT & _sink, error_report * _out_error, std::true_type)
+{
+    if (_begin == _end)
+        return;
+    const uint8_t * it = _byte_ptr(_begin);
+    const uint8_t * end = it + (_end - _begin);
+    uint32_t buffer[_sink_block_size];
+    while (it != end)
+    {
+        // don't split a sequence in between two blocks.
+        const uint8_t * block_end = end;
+        if (static_cast<size_t>(end - it) > _sink_block_size)
+            block_end = _rewind_to_lead(it, it + _sink_block_size);
+
+        uint32_t * out;
+        if (_out_error)
+        {
+            out = _decode_range_safe_impl(it, block_end, buffer, *_out_error, std::true_type());
+            if (*_out_error)
+            {
+                _sink.write(buffer, static_cast<size_t>(out - buffer));
+                return;
+            }
+        }
+        else
+        {
+            out = _decode_range_impl(it, block_end, buffer, std::true_type());
+        }
+        _sink.write(buffer, static_cast<size_t>(out - buffer));
+        it = block_end;
+    }
+}
+
+template <class IT, class OIT>
+void _decode_to_sink(IT _begin, IT _end, OIT & _sink, error_report * _out_error, std::false_type)
+{
+    uint32_t buffer[_sink_block_size];
+    while (_begin != _end)
+    {
+        uint32_t * out = buffer;
+        for (size_t i = 0; i < _sink_block_size && _begin != _end; ++i)
+        {
+            if (_out_error)
+            {
+                _begin = _me::decode_and_next_safe(_begin, _end, *out, *_out_error);
+                if (*_out_error)
+                    break;
+            }
+            else
+            {
+                _begin = _me::decode_and_next(_begin, *out);
+            }
+            ++out;
+        }
+        _sink.write(buffer, static_cast<size_t>(out - buffer));
+        if (_out_error && *_out_error)
+            return;
+    }
+}
+
+template <class IT, class OIT>
+OIT _decode_range_sink(IT _begin, IT _end, OIT _sink, error_report * _out_error)
+{
+    _reserve_if_multi_pass(
+        _begin,
+        _end,
+        [&_sink](IT _b, IT _e) { _sink.reserve(_me::utf32_length(_b, _e)); },
+        _is_multi_pass<IT>());
+    _decode_to_sink(_begin, _end, _sink, _out_error, _is_contiguous_byte_iter<IT>());
+    _sink.commit();
+    return _sink;
+}
+
+template <class IT, class OIT>
+OIT _decode_range_dispatch(IT _begin, IT _end, OIT _output_it, std::true_type)
+{
+    return _decode_range_sink(_begin, _end, _output_it, nullptr);
+}
+
+template <class IT, class OIT>
+OIT _decode_range_dispatch(IT _begin, IT _end, OIT _output_it, std::false_type)
+{
+    return _decode_range_impl(_begin, _end, _output_it, _is_contiguous_byte_iter<IT>());
+}
+
+template <class IT, class OIT>
+OIT _decode_range_safe_dispatch(
+    IT _begin, IT _end, OIT _output_it, error_report & _out_error, std::true_type)
+{
+    return _decode_range_sink(_begin, _end, _output_it, &_out_error);
+}
+
+template <class IT, class OIT>
+OIT _decode_range_safe_dispatch(
+    IT _begin, IT _end, OIT _output_it, error_report & _out_error, std::false_type)
+{
+    return _decode_range_safe_impl(
+        _begin, _end, _output_it, _out_error, _is_contiguous_byte_iter<IT>());
+}
+
+template <class IT, class OIT>
+using _encode_bulk_tag = std::integral_constant<bool,
+                                                _is_contiguous_codepoint_iter<IT>::value &&
+                                                    _is_byte_output_ptr<OIT>::value>;
+
+template <class IT, class OIT>
+OIT _encode_range_dispatch(IT _begin, IT _end, OIT _output_it, std::true_type)
+{
+    return _encode_range_sink(_begin, _end, _output_it, nullptr);
+}
+
+template <class IT, class OIT>
+OIT _encode_range_dispatch(IT _begin, IT _end, OIT _output_it, std::false_type)
+{
+    return _encode_range_impl(_begin, _end, _output_it, _encode_bulk_tag<IT, OIT>());
+}
+
+template <class IT, class OIT>
+OIT _encode_range_safe_dispatch(
+    IT _begin, IT _end, OIT _output_it, error_report & _out_error, std::true_type)
+{
+    return _encode_range_sink(_begin, _end, _output_it, &_out_error);
+}
+
+template <class IT, class OIT>
+OIT _encode_range_safe_dispatch(
+    IT _begin, IT _end, OIT _output_it, error_report & _out_error, std::false_type)
+{
+    return _encode_range_safe_impl(
+        _begin, _end, _output_it, _out_error, _encode_bulk_tag<IT, OIT>());
+}
+
+// encodes the range and replaces (or drops if REPLACE is std::false_type) every codepoint that
+// can't be encoded. The first error is stored in _out_error.
+template <class REPLACE, class IT, class OIT>
+OIT _encode_range_lossy_impl(
+    IT _begin, IT _end, OIT _output_it, error_report & _out_error, std::true_type)
+{
+    if (_begin == _end)
+        return _output_it;
+    const uint32_t * begin = _codepoint_ptr(_begin);
+    const uint32_t * end = begin + (_end - _begin);
+    uint8_t * out = reinterpret_cast<uint8_t *>(_output_it);
+    while (true)
+    {
+        error_report err;
+        begin = _encode_to_bytes(begin, end, out, &err);
+        if (!err)
+            return reinterpret_cast<OIT>(out);
+        if (!_out_error)
+            _out_error = err;
+        if (REPLACE::value)
+            out = _encode_impl(replacement_character, out);
+        ++begin;
+    }
+}
+
+template <class REPLACE, class IT, class OIT>
+OIT _encode_range_lossy_impl(
+    IT _begin, IT _end, OIT _output_it, error_report & _out_error, std::false_type)
+{
+    for (; _begin != _end; ++_begin)
+    {
+        uint32_t cp = *_begin;
+        if (_check_surrogate(cp) || cp > 0x10FFFF)
+        {
+            if (!_out_error)
+                _out_error = error_code::bad_codepoint;
+            if (!REPLACE::value)
+                continue;
+            cp = replacement_character;
+        }
+        _output_it = _encode_impl(cp, _output_it);
+    }
+    return _output_it;
+}
+
+// the policy based range functions pick their implementation here.
+template <class IT, class OIT>
+OIT _decode_range_policy(IT _begin, IT _end, OIT _output_it, error_report &, policy::unchecked)
+{
+    return _decode_range_dispatch(_begin, _end, _output_it, _is_bulk_sink<OIT, uint32_t>());
+}
+
+template <class IT, class OIT>
+OIT _decode_range_policy(
+    IT _begin, IT _end, OIT _output_it, error_report & _out_error, policy::report_first)
+{
+    return _decode_range_safe_dispatch(
+        _begin, _end, _output_it, _out_error, _is_bulk_sink<OIT, uint32_t>());
+}
+
+template <class IT, class OIT>
+OIT _decode_range_policy(
+    IT _begin, IT _end, OIT _output_it, error_report & _out_error, policy::replace)
+{
+    return _decode_range_lossy_impl<std::true_type>(
+        _begin, _end, _output_it, nullptr, _out_error, _is_contiguous_byte_iter<IT>());
+}
+
+template <class IT, class OIT>
+OIT _decode_range_policy(
+    IT _begin, IT _end, OIT _output_it, error_report & _out_error, policy::skip)
+{
+    return _decode_range_lossy_impl<std::false_type>(
+        _begin, _end, _output_it, nullptr, _out_error, _is_contiguous_byte_iter<IT>());
+}
+
+template <class IT, class OIT>
+OIT _encode_range_policy(IT _begin, IT _end, OIT _output_it, error_report &, policy::unchecked)
+{
+    return _encode_range_dispatch(_begin, _end, _output_it, _is_bulk_sink<OIT, uint8_t>());
+}
+
+template <class IT, class OIT>
+OIT _encode_range_policy(
+    IT _begin, IT _end, OIT _output_it, error_report & _out_error, policy::report_first)
+{
+    return _encode_range_safe_dispatch(
+        _begin, _end, _output_it, _out_error, _is_bulk_sink<OIT, uint8_t>());
+}
+
+template <class IT, class OIT>
+OIT _encode_range_policy(
+    IT _begin, IT _end, OIT _output_it, error_report & _out_error, policy::replace)
+{
+    return _encode_range_lossy_impl<std::true_type>(
+        _begin, _end, _output_it, _out_error, _encode_bulk_tag<IT, OIT>());
+}
+
+template <class IT, class OIT>
+OIT _encode_range_policy(
+    IT _begin, IT _end, OIT _output_it, error_report & _out_error, policy::skip)
+{
+    return _encode_range_lossy_impl<std::false_type>(
+        _begin, _end, _output_it, _out_error, _encode_bulk_tag<IT, OIT>());
+}
+
+} // namespace detail
+
+template <class IT>
+constexpr uint32_t decode(IT _begin, uint8_t * _out_byte_count)
+{
+    uint8_t a = *_begin;
+    uint8_t bc = byte_count(a);
+    if (_out_byte_count)
+        *_out_byte_count = bc;
+
+    assert(bc > 0);
+
+    if (bc == 1)
+    {
+        return static_cast<uint32_t>(a);
+    }
+    else if (bc == 2)
+    {
+        uint8_t b = *(++_begin);
+        return static_cast<uint32_t>(((a & 0x1F) << 6) | (b & 0x3F));
+    }
+    else if (bc == 3)
+    {
+        uint8_t b = *(++_begin);
+        uint8_t c = *(++_begin);
+        return static_cast<uint32_t>((a & 0xF) << 12) | ((b & 0x3F) << 6) | (c & 0x3F);
+    }
+    else if (bc == 4)
+    {
+        uint8_t b = *(++_begin);
+        uint8_t c = *(++_begin);
+        uint8_t d = *(++_begin);
+        return static_cast<uint32_t>((a & 0x7) << 18) | ((b & 0x3F) << 12) | ((c & 0x3F) << 6) |
+               (d & 0x3F);
+    }
+
+    return not_a_character;
+}
+
+namespace detail
+{
+// the branch based implementation of decode_safe.
+template <class IT>
+constexpr uint32_t _decode_safe_branches(IT _begin,
+                                         IT _end,
+                                         error_report & _out_error,
+                                         uint8_t * _out_byte_count)
+{
+    uint8_t a = *_begin;
+    uint8_t bc = byte_count(a);
+    if (_out_byte_count)
+        *_out_byte_count = bc;
+
+    if (bc == 0)
+    {
+        _out_error = error_code::bad_leading_byte;
+        return not_a_character;
+    }
+    else if (bc == 1)
+    {
+        return static_cast<uint32_t>(a);
+    }
+    else if (bc == 2)
+    {
+        UTF8ER_RETURN_ON_ERR(detail::_checked_increment(_begin, std::min(_begin + 2, _end)));
+        uint8_t b = *_begin;
+        UTF8ER_RETURN_ON_ERR(detail::_validate_2_byte_sequence(a, b));
+        uint32_t cp = static_cast<uint32_t>(((a & 0x1F) << 6) | (b & 0x3F));
+        UTF8ER_RETURN_ON_ERR(detail::_validate_2_byte_codepoint(cp));
+        return cp;
+    }
+    else if (bc == 3)
+    {
+        UTF8ER_RETURN_ON_ERR(detail::_checked_increment(_begin, std::min(_begin + 3, _end)));
+        uint8_t b = *_begin;
+        UTF8ER_RETURN_ON_ERR(detail::_checked_increment(_begin, std::min(_begin + 2, _end)));
+        uint8_t c = *_begin;
+        UTF8ER_RETURN_ON_ERR(detail::_validate_3_byte_sequence(a, b, c));
+        uint32_t cp = static_cast<uint32_t>((a & 0xF) << 12) | ((b & 0x3F) << 6) | (c & 0x3F);
+        UTF8ER_RETURN_ON_ERR(detail::_validate_3_byte_codepoint(cp));
+        return cp;
+    }
+    else if (bc == 4)
+    {
+        UTF8ER_RETURN_ON_ERR(detail::_checked_increment(_begin, std::min(_begin + 4, _end)));
+        uint8_t b = *_begin;
+        UTF8ER_RETURN_ON_ERR(detail::_checked_increment(_begin, std::min(_begin + 3, _end)));
+        uint8_t c = *_begin;
+        UTF8ER_RETURN_ON_ERR(detail::_checked_increment(_begin, std::min(_begin + 2, _end)));
+        uint8_t d = *_begin;
+        UTF8ER_RETURN_ON_ERR(detail::_validate_4_byte_sequence(a, b, c, d));
+        uint32_t cp = static_cast<uint32_t>((a & 0x7) << 18) | ((b & 0x3F) << 12) |
+                      ((c & 0x3F) << 6) | (d & 0x3F);
+        UTF8ER_RETURN_ON_ERR(detail::_validate_4_byte_codepoint(cp));
+        return cp;
+    }
+
+    // this should never be reached
+    assert(false);
+    return not_a_character;
+}
+
+// states of the table driven decoder below. Every state that expects more continuation bytes
+// knows whether the sequence is already known to be overlong or to encode a bad codepoint, so
+// that those errors can be reported once all continuation bytes were checked (which is the order
+// in which _decode_safe_branches reports them).
+enum : uint8_t
+{
+    _dfa_accept = 0,
+    _dfa_bad_continuation,
+    _dfa_overlong,
+    _dfa_bad_codepoint,
+    _dfa_need1,
+    _dfa_need1_overlong,
+    _dfa_need1_bad_codepoint,
+    _dfa_need2,
+    _dfa_need2_overlong,
+    _dfa_need2_bad_codepoint,
+    _dfa_need3,
+    _dfa_need3_bad_codepoint,
+    _dfa_e0_first,  // 11100000, the next byte decides if the sequence is overlong
+    _dfa_ed_first,  // 11101101, the next byte decides if the sequence encodes a surrogate
+    _dfa_f0_first,  // 11110000, the next byte decides if the sequence is overlong
+    _dfa_f4_first,  // 11110100, the next byte decides if the codepoint is beyond 0x10FFFF
+    _dfa_state_count
+};
+
+struct _dfa_tables
+{
+    constexpr _dfa_tables() : lengths(), masks(), starts(), transitions()
+    {
+        for (size_t b = 0; b < 256; ++b)
+        {
+            uint8_t len = 0, start = _dfa_accept;
+            if (b < 0x80)
+                len = 1;
+            else if (b >= 0xC0 && b <= 0xC1)
+                len = 2, start = _dfa_need1_overlong;
+            else if (b >= 0xC2 && b <= 0xDF)
+                len = 2, start = _dfa_need1;
+            else if (b == 0xE0)
+                len = 3, start = _dfa_e0_first;
+            else if (b == 0xED)
+                len = 3, start = _dfa_ed_first;
+            else if (b >= 0xE1 && b <= 0xEF)
+                len = 3, start = _dfa_need2;
+            else if (b == 0xF0)
+                len = 4, start = _dfa_f0_first;
+            else if (b >= 0xF1 && b <= 0xF3)
+                len = 4, start = _dfa_need3;
+            else if (b == 0xF4)
+                len = 4, start = _dfa_f4_first;
+            else if (b >= 0xF5 && b <= 0xF7)
+                len = 4, start = _dfa_need3_bad_codepoint;
+            lengths[b] = len;
+            starts[b] = start;
+            masks[b] = static_cast<uint8_t>(len == 1 ? 0x7F : 0x7F >> len);
+        }
+
+        for (size_t s = 0; s < _dfa_state_count; ++s)
+        {
+            for (size_t b = 0; b < 256; ++b)
+            {
+                uint8_t next = _dfa_bad_continuation;
+                bool cont = (b & 0xC0) == 0x80;
+                switch (s)
+                {
+                case _dfa_need1:
+                    next = _dfa_accept;
+                    break;
+                case _dfa_need1_overlong:
+                    next = _dfa_overlong;
+                    break;
+                case _dfa_need1_bad_codepoint:
+                    next = _dfa_bad_codepoint;
+                    break;
+                case _dfa_need2:
+                    next = _dfa_need1;
+                    break;
+                case _dfa_need2_overlong:
+                    next = _dfa_need1_overlong;
+                    break;
+                case _dfa_need2_bad_codepoint:
+                    next = _dfa_need1_bad_codepoint;
+                    break;
+                case _dfa_need3:
+                    next = _dfa_need2;
+                    break;
+                case _dfa_need3_bad_codepoint:
+                    next = _dfa_need2_bad_codepoint;
+                    break;
+                case _dfa_e0_first:
+                    next = b < 0xA0 ? _dfa_need1_overlong : _dfa_need1;
+                    break;
+                case _dfa_ed_first:
+                    next = b < 0xA0 ? _dfa_need1 : _dfa_need1_bad_codepoint;
+                    break;
+                case _dfa_f0_first:
+                    next = b < 0x90 ? _dfa_need2_overlong : _dfa_need2;
+                    break;
+                case _dfa_f4_first:
+                    next = b < 0x90 ? _dfa_need2 : _dfa_need2_bad_codepoint;
+                    break;
+                default:
+                    // the accept and error states are never left.
+                    next = static_cast<uint8_t>(s);
+                    cont = true;
+                    break;
+                }
+                transitions[s][b] = cont ? next : static_cast<uint8_t>(_dfa_bad_continuation);
+            }
+        }
+    }
+
+    // per leading byte: sequence length (0 for bad leading bytes), the payload bits and the
+    // state to continue with.
+    uint8_t lengths[256];
+    uint8_t masks[256];
+    uint8_t starts[256];
+    uint8_t transitions[_dfa_state_count][256];
+};
+
+// holds the tables as a static member, as constexpr functions can't have static variables. Being a
+// template keeps a single instance across translation units.
+template <class T = void>
+struct _dfa_holder
+{
+    static constexpr _dfa_tables tables{};
+    static constexpr error_code errors[] = { error_code::none,
+                                             error_code::bad_continuation_byte,
+                                             error_code::overlong_sequence,
+                                             error_code::bad_codepoint };
+};
+
+template <class T>
+constexpr _dfa_tables _dfa_holder<T>::tables;
+
+template <class T>
+constexpr error_code _dfa_holder<T>::errors[];
+
+// table driven counterpart of _decode_safe_branches that produces exactly the same results. Apart
+// from the length check, there is a single table lookup per continuation byte and no data
+// dependent branch.
+template <class IT>
+constexpr uint32_t _decode_safe_dfa(IT _begin,
+                                    IT _end,
+                                    error_report & _out_error,
+                                    uint8_t * _out_byte_count)
+{
+    constexpr const _dfa_tables & tables = _dfa_holder<>::tables;
+    constexpr const error_code(&errors)[4] = _dfa_holder<>::errors;
+
+    uint8_t a = *_begin;
+    uint8_t len = tables.lengths[a];
+    if (_out_byte_count)
+        *_out_byte_count = len;
+
+    if (len == 1)
+        return a;
+    if (len == 0)
+    {
+        _out_error = error_code::bad_leading_byte;
+        return not_a_character;
+    }
+    if (_end - _begin < len)
+    {
+        _out_error = error_code::incomplete_sequence;
+        return not_a_character;
+    }
+
+    uint8_t state = tables.starts[a];
+    uint32_t cp = a & tables.masks[a];
+    for (uint8_t i = 1; i < len; ++i)
+    {
+        uint8_t b = *(++_begin);
+        state = tables.transitions[state][b];
+        cp = (cp << 6) | (b & 0x3F);
+    }
+
+    if (state != _dfa_accept)
+    {
+        _out_error = errors[state];
+        return not_a_character;
+    }
+    return cp;
+}
+} // namespace detail
+
+template <class IT>
+constexpr uint32_t decode_safe(IT _begin,
+                               IT _end,
+                               error_report & _out_error,
+                               uint8_t * _out_byte_count)
+{
+#if defined(UTF8ER_DFA_DECODER)
+    return detail::_decode_safe_dfa(_begin, _end, _out_error, _out_byte_count);
+#else
+    return detail::_decode_safe_branches(_begin, _end, _out_error, _out_byte_count);
+#endif
+}
+
+constexpr uint32_t decode_safe(const char * _begin,
+                               error_report & _out_error,
+                               uint8_t * _out_byte_count)
+{
+    return _me::decode_safe(_begin, _begin + detail::_strlen(_begin), _out_error, _out_byte_count);
+}
+
+template <class IT, class OIT>
+OIT decode_range(IT _begin, IT _end, OIT _output_it)
+{
+    error_report err;
+    return _me::decode_range<policy::unchecked>(_begin, _end, _output_it, err);
+}
+
+template <class IT, class OIT>
+OIT decode_range_safe(IT _begin, IT _end, OIT _output_it, error_report & _out_error)
+{
+    return _me::decode_range<policy::report_first>(_begin, _end, _output_it, _out_error);
+}
+
+template <class POLICY, class IT, class OIT>
+OIT decode_range(IT _begin, IT _end, OIT _output_it, error_report & _out_error)
+{
+    return detail::_decode_range_policy(_begin, _end, _output_it, _out_error, POLICY());
+}
+
+template <class IT, class OIT>
+OIT decode_range_lossy(IT _begin, IT _end, OIT _output_it, std::vector<size_t> * _out_errors)
+{
+    error_report err;
+    return detail::_decode_range_lossy_impl<std::true_type>(
+        _begin, _end, _output_it, _out_errors, err, detail::_is_contiguous_byte_iter<IT>());
+}
+
+template <class IT, class OIT>
+OIT sanitize(IT _begin, IT _end, OIT _output_it, std::vector<size_t> * _out_errors)
+{
+    return detail::_sanitize_impl(
+        _begin, _end, _output_it, _out_errors, detail::_is_contiguous_byte_iter<IT>());
+}
+
+inline transcode_result transcode_to_utf32(const char * _str, size_t _length, uint32_t * _output)
+{
+    const uint8_t * begin = reinterpret_cast<const uint8_t *>(_str);
+    return detail::_transcode_to_utf32(begin, begin + _length, _output);
+}
+
+inline transcode_result transcode_to_utf32(const char * _str,
+                                           size_t _length,
+                                           uint32_t * _output,
+                                           size_t _capacity)
+{
+    const uint8_t * begin = reinterpret_cast<const uint8_t *>(_str);
+    return detail::_transcode_to_utf32_bounded(begin, begin + _length, _output, _capacity);
+}
+
+template <class OIT>
+OIT decode_c_str(const char * _c_str, OIT _output_it)
+{
+    return _me::decode_range(_c_str, _c_str + std::strlen(_c_str), _output_it);
+}
+
+template <class OIT>
+OIT decode_c_str_safe(const char * _c_str, OIT _output_it, error_report & _out_error)
+{
+    return _me::decode_range_safe(_c_str, _c_str + std::strlen(_c_str), _output_it, _out_error);
+}
+
+template <class IT>
+constexpr std::pair<error_report, IT> validate(IT _begin, IT _end)
+{
+    return detail::_validate_impl(_begin, _end, detail::_is_contiguous_byte_iter<IT>());
+}
+
+constexpr std::pair<error_report, const char*> validate(const char * _str)
+{
+    return validate(_str, _str + detail::_strlen(_str));
+}
+
+template <class IT>
+constexpr IT next(IT _it)
+{
+    return _it + _me::byte_count(*_it);
+}
+
+template <class IT>
+IT decode_and_next(IT _it, uint32_t & _out_codepoint)
+{
+    uint8_t bc;
+    _out_codepoint = _me::decode(_it, &bc);
+    return _it + bc;
+}
+
+template <class IT>
+IT decode_and_next_safe(IT _it, IT _end, uint32_t & _out_codepoint, error_report & _out_error)
+{
+    uint8_t bc;
+    _out_codepoint = _me::decode_safe(_it, _end, _out_error, &bc);
+    return _it + bc;
+}
+
+template <class IT>
+constexpr IT previous(IT _it)
+{
+    while (detail::_is_valid_trailing_byte(*(--_it)))
+        ;
+    return _it;
+}
+
+template <class IT>
+IT decode_and_previous(IT _it, uint32_t & _out_codepoint)
+{
+    _out_codepoint = decode(_it);
+    while (detail::_is_valid_trailing_byte(*(--_it)))
+        ;
+    return _it;
+}
+
+template <class IT>
+IT decode_and_previous_safe(IT _it, uint32_t & _out_codepoint, error_report & _out_error)
+{
+    _out_codepoint = decode_safe(_it, _out_error);
+    while (detail::_is_valid_trailing_byte(*(--_it)))
+        return _it;
+}
+
+template <class IT>
+constexpr typename std::iterator_traits<IT>::difference_type distance(IT _begin, IT _end)
+{
+    return detail::_distance_impl(_begin, _end, detail::_is_contiguous_byte_iter<IT>());
+}
+
+constexpr size_t count(const char * _cstr)
+{
+    if (detail::_is_constant_evaluated())
+        return static_cast<size_t>(
+            detail::_distance_impl(_cstr, _cstr + detail::_strlen(_cstr), std::false_type()));
+    return detail::_count_leads_c_str(reinterpret_cast<const uint8_t *>(_cstr));
+}
+
+template <class IT>
+constexpr IT encode(uint32_t _codepoint, IT _output_it)
+{
+    return detail::_encode_impl(_codepoint, _output_it);
+}
+
+template <class IT>
+constexpr IT encode_safe(uint32_t _codepoint, IT _output_it, error_report & _out_error)
+{
+    return detail::_encode_impl(_codepoint, _output_it, &_out_error);
+}
+
+template <class IT, class OIT>
+OIT encode_range(IT _begin, IT _end, OIT _output_it)
+{
+    error_report err;
+    return _me::encode_range<policy::unchecked>(_begin, _end, _output_it, err);
+}
+
+template <class IT, class OIT>
+OIT encode_range_safe(IT _begin, IT _end, OIT _output_it, error_report & _out_error)
+{
+    return _me::encode_range<policy::report_first>(_begin, _end, _output_it, _out_error);
+}
+
+template <class POLICY, class IT, class OIT>
+OIT encode_range(IT _begin, IT _end, OIT _output_it, error_report & _out_error)
+{
+    return detail::_encode_range_policy(_begin, _end, _output_it, _out_error, POLICY());
+}
+
+inline transcode_result transcode_to_utf8(const uint32_t * _codepoints,
+                                          size_t _count,
+                                          char * _output)
+{
+    error_report err;
+    uint8_t * out = reinterpret_cast<uint8_t *>(_output);
+    const uint32_t * it = detail::_encode_to_bytes(_codepoints, _codepoints + _count, out, &err);
+    return transcode_result(err,
+                            static_cast<size_t>(it - _codepoints),
+                            static_cast<size_t>(out - reinterpret_cast<uint8_t *>(_output)));
+}
+
+inline transcode_result transcode_to_utf8(const uint32_t * _codepoints,
+                                          size_t _count,
+                                          char * _output,
+                                          size_t _capacity)
+{
+    return detail::_transcode_to_utf8_bounded(
+        _codepoints, _codepoints + _count, reinterpret_cast<uint8_t *>(_output), _capacity);
+}
+
+inline size_t utf8_to_utf16_length(const char * _str, size_t _length)
+{
+    const uint8_t * begin = reinterpret_cast<const uint8_t *>(_str);
+    return detail::_utf16_length(begin, begin + _length);
+}
+
+inline size_t utf16_to_utf8_length(const uint16_t * _units, size_t _count, byte_order _order)
+{
+    return detail::_utf8_length_from_utf16(_units, _units + _count, _order != native_byte_order);
+}
+
+inline transcode_result utf8_to_utf16(const char * _str,
+                                      size_t _length,
+                                      uint16_t * _output,
+                                      byte_order _order)
+{
+    const uint8_t * begin = reinterpret_cast<const uint8_t *>(_str);
+    return detail::_transcode_to_utf16(
+        begin, begin + _length, _output, _order != native_byte_order);
+}
+
+inline transcode_result utf16_to_utf8(const uint16_t * _units,
+                                      size_t _count,
+                                      char * _output,
+                                      byte_order _order)
+{
+    return detail::_transcode_utf16_to_utf8(_units,
+                                            _units + _count,
+                                            reinterpret_cast<uint8_t *>(_output),
+                                            _order != native_byte_order);
+}
+
+inline size_t latin1_to_utf8_length(const char * _str, size_t _length)
+{
+    const uint8_t * begin = reinterpret_cast<const uint8_t *>(_str);
+    return detail::_latin1_to_utf8_length(begin, begin + _length);
+}
+
+inline size_t latin1_to_utf8(const char * _str, size_t _length, char * _output)
+{
+    const uint8_t * begin = reinterpret_cast<const uint8_t *>(_str);
+    uint8_t * out = reinterpret_cast<uint8_t *>(_output);
+    return static_cast<size_t>(detail::_latin1_to_utf8(begin, begin + _length, out) - out);
+}
+
+inline transcode_result utf8_to_latin1(const char * _str, size_t _length, char * _output)
+{
+    const uint8_t * begin = reinterpret_cast<const uint8_t *>(_str);
+    return detail::_utf8_to_latin1(
+        begin, begin + _length, reinterpret_cast<uint8_t *>(_output), _length);
+}
+
+template <class T>
+typename output_iterator_picker<T>::output_iter append(uint32_t _codepoint, T & _append_string)
+{
+    return _me::append_range(&_codepoint, &_codepoint + 1, _append_string);
+}
+
+template <class T>
+typename output_iterator_picker<T>::output_iter append_safe(uint32_t _codepoint,
+                                                            T & _append_string,
+                                                            error_report & _out_error)
+{
+    return _me::append_range_safe(&_codepoint, &_codepoint + 1, _append_string, _out_error);
+}
+
+template <class IT, class STR>
+typename output_iterator_picker<STR>::output_iter append_range(IT _begin,
+                                                               IT _end,
+                                                               STR & _append_string)
+{
+    detail::_append_range_impl(
+        _begin,
+        _end,
+        _append_string,
+        std::integral_constant<bool,
+                               detail::_is_resizable_byte_container<STR>::value &&
+                                   detail::_is_multi_pass<IT>::value>());
+    return output_iterator_picker<STR>::iter(_append_string);
+}
+
+template <class IT, class STR>
+typename output_iterator_picker<STR>::output_iter append_range_safe(IT _begin,
+                                                                    IT _end,
+                                                                    STR & _append_string,
+                                                                    error_report & _out_error)
+{
+    detail::_append_range_safe_impl(
+        _begin,
+        _end,
+        _append_string,
+        _out_error,
+        std::integral_constant<bool,
+                               detail::_is_resizable_byte_container<STR>::value &&
+                                   detail::_is_multi_pass<IT>::value>());
+    return output_iterator_picker<STR>::iter(_append_string);
+}
+
+template <class IT, class T>
+typename output_iterator_picker<T>::output_iter decode_range_and_append(IT _begin,
+                                                                        IT _end,
+                                                                        T & _append_container)
+{
+    detail::_decode_range_and_append_impl(
+        _begin,
+        _end,
+        _append_container,
+        std::integral_constant<bool,
+                               detail::_is_resizable_codepoint_container<T>::value &&
+                                   detail::_is_multi_pass<IT>::value>());
+    return output_iterator_picker<T>::iter(_append_container);
+}
+
+template <class IT>
+size_t utf8_length(IT _begin, IT _end)
+{
+    return detail::_utf8_length_impl(_begin, _end, detail::_is_contiguous_codepoint_iter<IT>());
+}
+
+template <class IT>
+size_t utf32_length(IT _begin, IT _end)
+{
+    return static_cast<size_t>(_me::distance(_begin, _end));
+}
+
+
+namespace detail
+{
+// decodes as much of the range from _begin to _end as possible and returns the start of the
+// first invalid sequence, or _end on success.
+template <class IT, class OIT>
+IT _decode_until_error(
+    IT _begin, IT _end, OIT & _output_it, error_report & _out_error, std::true_type)
+{
+    if (_begin == _end)
+        return _begin;
+    const uint8_t * it = _byte_ptr(_begin);
+    return _begin + (_decode_bytes_safe(it, it + (_end - _begin), _output_it, _out_error) - it);
+}
+
+template <class IT, class OIT>
+IT _decode_until_error(
+    IT _begin, IT _end, OIT & _output_it, error_report & _out_error, std::false_type)
+{
+    uint32_t cp;
+    uint8_t bc;
+    while (_begin != _end)
+    {
+        cp = _me::decode_safe(_begin, _end, _out_error, &bc);
+        if (_out_error)
+            return _begin;
+        *(_output_it++) = cp;
+        std::advance(_begin, bc);
+    }
+    return _begin;
+}
+
+// the state shared by stream_validator and stream_decoder.
+class _stream_state
+{
+  public:
+    _stream_state()
+    {
+        reset();
+    }
+
+    // forgets about everything that was fed so far to start a new stream.
+    void reset()
+    {
+        m_error = error_report();
+        m_error_offset = 0;
+        m_offset = 0;
+        m_pending_count = 0;
+    }
+
+    // call once the stream ended. Returns false if there was an error, which is
+    // error_code::incomplete_sequence if the stream ended in the middle of a sequence.
+    bool finish()
+    {
+        if (!m_error && m_pending_count)
+        {
+            m_error = error_code::incomplete_sequence;
+            m_error_offset = m_offset - m_pending_count;
+            m_pending_count = 0;
+        }
+        return !m_error;
+    }
+
+    // the first error in the stream. Once there is an error, all following chunks are ignored.
+    const error_report & error() const
+    {
+        return m_error;
+    }
+
+    // the offset of the start of the invalid sequence in the stream.
+    uint64_t error_offset() const
+    {
+        return m_error_offset;
+    }
+
+    // the number of bytes that were fed so far.
+    uint64_t offset() const
+    {
+        return m_offset;
+    }
+
+    // the number of bytes of the sequence that is waiting for the next chunk.
+    size_t pending() const
+    {
+        return m_pending_count;
+    }
+
+  protected:
+    // _process(begin, end, error) handles the complete sequences of a chunk and returns where it
+    // stopped, _emit(codepoint) is called for the sequence that straddled two chunks.
+    template <class IT, class P, class E>
+    bool _feed(IT _begin, IT _end, P _process, E _emit)
+    {
+        uint64_t chunk_offset = m_offset;
+        m_offset += static_cast<uint64_t>(_end - _begin);
+        if (m_error)
+            return false;
+
+        if (m_pending_count)
+        {
+            // only the few bytes needed to complete the pending sequence are copied.
+            uint8_t buf[4];
+            std::memcpy(buf, m_pending, m_pending_count);
+            size_t need = _me::byte_count(buf[0]);
+            size_t n = m_pending_count;
+            while (n < need && _begin != _end)
+                buf[n++] = static_cast<uint8_t>(*(_begin++));
+            if (n < need)
+            {
+                std::memcpy(m_pending, buf, n);
+                m_pending_count = static_cast<uint8_t>(n);
+                return true;
+            }
+
+            uint8_t bc;
+            uint32_t cp = _me::decode_safe(buf, buf + n, m_error, &bc);
+            if (m_error)
+            {
+                m_error_offset = chunk_offset - m_pending_count;
+                return false;
+            }
+            _emit(cp);
+            chunk_offset += n - m_pending_count;
+            m_pending_count = 0;
+        }
+
+        IT stop = _process(_begin, _end, m_error);
+        if (!m_error)
+            return true;
+
+        // a sequence is only incomplete if the chunk ends before it does.
+        if (m_error.code == error_code::incomplete_sequence)
+        {
+            m_error = error_report();
+            for (; stop != _end; ++stop)
+                m_pending[m_pending_count++] = static_cast<uint8_t>(*stop);
+            return true;
+        }
+        m_error_offset = chunk_offset + static_cast<uint64_t>(stop - _begin);
+        return false;
+    }
+
+  private:
+    error_report m_error;
+    uint64_t m_error_offset;
+    uint64_t m_offset;
+    uint8_t m_pending[3];
+    uint8_t m_pending_count;
+};
+} // namespace detail
+
+class stream_validator : public detail::_stream_state
+{
+  public:
+    // validates the next chunk of the stream. Returns false if the stream is invalid.
+    template <class IT>
+    bool feed(IT _begin, IT _end)
+    {
+        return _feed(
+            _begin,
+            _end,
+            [](IT _b, IT _e, error_report & _out_error) {
+                auto result =
+                    detail::_validate_impl(_b, _e, detail::_is_contiguous_byte_iter<IT>());
+                _out_error = result.first;
+                return result.first ? result.second : _e;
+            },
+            [](uint32_t) {});
+    }
+};
+
+class stream_decoder : public detail::_stream_state
+{
+  public:
+    // decodes the next chunk of the stream to _output_it and returns the advanced output
+    // iterator. Stops at the first error, check error() afterwards.
+    template <class IT, class OIT>
+    OIT feed(IT _begin, IT _end, OIT _output_it)
+    {
+        _feed(
+            _begin,
+            _end,
+            [&_output_it](IT _b, IT _e, error_report & _out_error) {
+                return detail::_decode_until_error(
+                    _b, _e, _output_it, _out_error, detail::_is_contiguous_byte_iter<IT>());
+            },
+            [&_output_it](uint32_t _cp) { *(_output_it++) = _cp; });
+        return _output_it;
+    }
+};
+
+
+namespace detail
+{
+// returns a mask with one bit per lead (i.e. not continuation) byte of the 64 bytes at _ptr.
+inline uint64_t _lead_mask_64(const uint8_t * _ptr)
+{
+    uint64_t ret = 0;
+#if defined(UTF8ER_AVX2)
+    const __m256i threshold = _mm256_set1_epi8(-65);
+    for (int i = 0; i < 2; ++i)
+    {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(_ptr + i * 32));
+        uint32_t leads =
+            static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(v, threshold)));
+        ret |= static_cast<uint64_t>(leads) << (i * 32);
+    }
+#elif defined(UTF8ER_SSE2)
+    const __m128i threshold = _mm_set1_epi8(-65);
+    for (int i = 0; i < 4; ++i)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_ptr + i * 16));
+        uint32_t leads = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpgt_epi8(v, threshold)));
+        ret |= static_cast<uint64_t>(leads) << (i * 16);
+    }
+#else
+    for (int i = 0; i < 64; ++i)
+        ret |= static_cast<uint64_t>(!_is_valid_trailing_byte(_ptr[i])) << i;
+#endif
+    return ret;
+}
+
+inline uint32_t _popcount64(uint64_t _v)
+{
+    return _popcount(static_cast<uint32_t>(_v)) + _popcount(static_cast<uint32_t>(_v >> 32));
+}
+
+inline uint32_t _ctz64(uint64_t _v)
+{
+    uint32_t lo = static_cast<uint32_t>(_v);
+    return lo ? _ctz(lo) : 32 + _ctz(static_cast<uint32_t>(_v >> 32));
+}
+
+// index of the set bit of _v that has _n set bits below it. _v must have more than _n set bits.
+inline uint32_t _select64(uint64_t _v, size_t _n)
+{
+#if defined(UTF8ER_BMI2)
+    return _ctz64(_pdep_u64(uint64_t(1) << _n, _v));
+#else
+    static constexpr _compress_table<8, 1> table{};
+
+    // byte i of prefix holds the number of set bits in bytes 0 to i of _v. the first byte of
+    // prefix that exceeds _n holds the wanted bit, which is found without branching on the data.
+    uint64_t prefix = _v - ((_v >> 1) & 0x5555555555555555ull);
+    prefix = (prefix & 0x3333333333333333ull) + ((prefix >> 2) & 0x3333333333333333ull);
+    prefix = ((prefix + (prefix >> 4)) & 0x0F0F0F0F0F0F0F0Full) * 0x0101010101010101ull;
+    uint64_t above = ((prefix | 0x8080808080808080ull) - (_n + 1) * 0x0101010101010101ull) &
+                     0x8080808080808080ull;
+    uint32_t shift = _ctz64(above) - 7;
+    size_t below = static_cast<size_t>((prefix << 8) >> shift) & 0xFF;
+    return shift + table.indices[(_v >> shift) & 0xFF][_n - below];
+#endif
+}
+} // namespace detail
+
+class codepoint_index
+{
+  public:
+    codepoint_index() : m_begin(nullptr), m_end(nullptr), m_stride(64), m_count(0)
+    {
+    }
+
+    codepoint_index(const char * _begin, const char * _end, size_t _stride = 64)
+    {
+        build(_begin, _end, _stride);
+    }
+
+    // (re)builds the index for the string in between _begin and _end in a single pass.
+    void build(const char * _begin, const char * _end, size_t _stride = 64)
+    {
+        assert(_stride > 0);
+        m_begin = reinterpret_cast<const uint8_t *>(_begin);
+        m_end = reinterpret_cast<const uint8_t *>(_end);
+        m_stride = _stride;
+        m_count = 0;
+        m_offsets.clear();
+        m_offsets.reserve(static_cast<size_t>(m_end - m_begin) / _stride + 1);
+
+        // the index of the next codepoint whose offset is stored.
+        size_t next = 0;
+        const uint8_t * it = m_begin;
+        for (; m_end - it >= 64; it += 64)
+        {
+            uint64_t leads = detail::_lead_mask_64(it);
+            size_t lead_count = detail::_popcount64(leads);
+            while (m_count + lead_count > next)
+            {
+                m_offsets.push_back(static_cast<size_t>(it - m_begin) +
+                                    detail::_select64(leads, next - m_count));
+                next += m_stride;
+            }
+            m_count += lead_count;
+        }
+        for (; it != m_end; ++it)
+        {
+            if (detail::_is_valid_trailing_byte(*it))
+                continue;
+            if (m_count == next)
+            {
+                m_offsets.push_back(static_cast<size_t>(it - m_begin));
+                next += m_stride;
+            }
+            ++m_count;
+        }
+    }
+
+    // the number of codepoints in the string.
+    size_t size() const
+    {
+        return m_count;
+    }
+
+    size_t stride() const
+    {
+        return m_stride;
+    }
+
+    // returns a pointer to the start of the _n-th codepoint, or the end of the string if _n is
+    // the number of codepoints.
+    const char * nth(size_t _n) const
+    {
+        assert(_n <= m_count);
+        if (_n == m_count)
+            return reinterpret_cast<const char *>(m_end);
+
+        const uint8_t * it = m_begin + m_offsets[_n / m_stride];
+        for (size_t i = _n % m_stride; i > 0; --i)
+        {
+            while (detail::_is_valid_trailing_byte(*(++it)))
+                ;
+        }
+        return reinterpret_cast<const char *>(it);
+    }
+
+    // returns the index of the codepoint that the byte at _byte_offset belongs to, or the number
+    // of codepoints if _byte_offset is the length of the string.
+    size_t index_at(size_t _byte_offset) const
+    {
+        if (_byte_offset >= static_cast<size_t>(m_end - m_begin))
+            return m_count;
+
+        auto block = std::upper_bound(m_offsets.begin(), m_offsets.end(), _byte_offset);
+        if (block == m_offsets.begin())
+            return 0;
+        --block;
+        size_t base = static_cast<size_t>(block - m_offsets.begin()) * m_stride;
+        return base + detail::_count_leads(m_begin + *block, m_begin + _byte_offset + 1) - 1;
+    }
+
+  private:
+    const uint8_t * m_begin;
+    const uint8_t * m_end;
+    size_t m_stride;
+    size_t m_count;
+    std::vector<size_t> m_offsets;
+};
+
+
+class utf8_view
+{
+  public:
+    utf8_view() : m_begin(nullptr), m_end(nullptr), m_count(_unknown), m_has_index(false)
+    {
+    }
+
+    // validates the string in between _begin and _end. If it is invalid, the reason is stored in
+    // _out_error and the view is empty.
+    utf8_view(const char * _begin, const char * _end, error_report & _out_error) : utf8_view()
+    {
+        auto result = _me::validate(_begin, _end);
+        _out_error = result.first;
+        if (!_out_error)
+        {
+            m_begin = _begin;
+            m_end = _end;
+        }
+    }
+
+    utf8_view(const char * _c_str, error_report & _out_error) :
+        utf8_view(_c_str, _c_str + std::strlen(_c_str), _out_error)
+    {
+    }
+
+    const char * begin() const
+    {
+        return m_begin;
+    }
+
+    const char * end() const
+    {
+        return m_end;
+    }
+
+    bool empty() const
+    {
+        return m_begin == m_end;
+    }
+
+    // the number of bytes.
+    size_t size() const
+    {
+        return static_cast<size_t>(m_end - m_begin);
+    }
+
+    // the number of codepoints, counted on first use.
+    size_t count() const
+    {
+        if (m_count == _unknown)
+            m_count = static_cast<size_t>(_me::distance(m_begin, m_end));
+        return m_count;
+    }
+
+    uint32_t decode(const char * _it, uint8_t * _out_byte_count = nullptr) const
+    {
+        assert(_it >= m_begin && _it < m_end);
+        return _me::decode(_it, _out_byte_count);
+    }
+
+    const char * decode_and_next(const char * _it, uint32_t & _out_codepoint) const
+    {
+        assert(_it >= m_begin && _it < m_end);
+        return _me::decode_and_next(_it, _out_codepoint);
+    }
+
+    const char * next(const char * _it) const
+    {
+        assert(_it >= m_begin && _it < m_end);
+        return _me::next(_it);
+    }
+
+    const char * previous(const char * _it) const
+    {
+        assert(_it > m_begin && _it <= m_end);
+        return _me::previous(_it);
+    }
+
+    // decodes all codepoints to _output_it.
+    template <class OIT>
+    OIT decode_range(OIT _output_it) const
+    {
+        return _me::decode_range(m_begin, m_end, _output_it);
+    }
+
+    // returns the start of the _n-th codepoint (or end() if _n is count()). Builds a
+    // codepoint_index on first use.
+    const char * nth(size_t _n) const
+    {
+        return index().nth(_n);
+    }
+
+    // returns the index of the codepoint the byte at _byte_offset belongs to.
+    size_t index_at(size_t _byte_offset) const
+    {
+        return index().index_at(_byte_offset);
+    }
+
+    // returns the view of _count codepoints starting at the _first codepoint. Both are clamped
+    // to the end of the view.
+    utf8_view subview(size_t _first, size_t _count = size_t(-1)) const
+    {
+        size_t n = count();
+        _first = std::min(_first, n);
+        _count = std::min(_count, n - _first);
+        return utf8_view(nth(_first), nth(_first + _count), _count);
+    }
+
+  private:
+    friend class static_utf8;
+
+    static constexpr size_t _unknown = size_t(-1);
+
+    // used for views that are known to be valid.
+    utf8_view(const char * _begin, const char * _end, size_t _count) :
+        m_begin(_begin),
+        m_end(_end),
+        m_count(_count),
+        m_has_index(false)
+    {
+    }
+
+    const codepoint_index & index() const
+    {
+        if (!m_has_index)
+        {
+            m_index.build(m_begin, m_end);
+            m_count = m_index.size();
+            m_has_index = true;
+        }
+        return m_index;
+    }
+
+    const char * m_begin;
+    const char * m_end;
+    mutable size_t m_count;
+    mutable bool m_has_index;
+    mutable codepoint_index m_index;
+};
+
+class static_utf8
+{
+  public:
+    // validates and counts the _size bytes at _str, see _u8v.
+    constexpr static_utf8(const char * _str, size_t _size) :
+        m_str(_str),
+        m_size(_size),
+        m_count(_checked_count(_str, _size))
+    {
+    }
+
+    constexpr const char * begin() const
+    {
+        return m_str;
+    }
+
+    constexpr const char * end() const
+    {
+        return m_str + m_size;
+    }
+
+    constexpr const char * c_str() const
+    {
+        return m_str;
+    }
+
+    // returns the number of bytes.
+    constexpr size_t size() const
+    {
+        return m_size;
+    }
+
+    // returns the number of codepoints.
+    constexpr size_t count() const
+    {
+        return m_count;
+    }
+
+    // returns a utf8_view of the literal that does not validate or count again.
+    utf8_view view() const
+    {
+        return utf8_view(m_str, m_str + m_size, m_count);
+    }
+
+  private:
+    // uses the scalar implementations directly, so literals work with any C++14 compiler.
+    static constexpr size_t _checked_count(const char * _str, size_t _size)
+    {
+        return detail::_validate_impl(_str, _str + _size, std::false_type()).first
+                   ? _invalid_literal()
+                   : static_cast<size_t>(
+                         detail::_distance_impl(_str, _str + _size, std::false_type()));
+    }
+
+    // deliberately not constexpr, so that an invalid literal in a constant expression does not
+    // compile.
+    static size_t _invalid_literal()
+    {
+        assert(false && "invalid utf8 literal");
+        return 0;
+    }
+
+    const char * m_str;
+    size_t m_size;
+    size_t m_count;
+};
+
+namespace literals
+{
+constexpr static_utf8 operator""_u8v(const char * _str, size_t _length)
+{
+    return static_utf8(_str, _length);
+}
+} // namespace literals
+
+
+class codepoint_range
+{
+  public:
+    class iterator
+    {
+      public:
+        using iterator_category = std::input_iterator_tag;
+        using value_type = uint32_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const uint32_t *;
+        using reference = const uint32_t &;
+
+        iterator() : m_range(nullptr)
+        {
+        }
+
+        reference operator*() const
+        {
+            return m_range->m_buffer[m_range->m_pos];
+        }
+
+        pointer operator->() const
+        {
+            return &**this;
+        }
+
+        iterator & operator++()
+        {
+            if (++m_range->m_pos == m_range->m_count && !m_range->_refill())
+                m_range = nullptr;
+            return *this;
+        }
+
+        // as with all input iterators, the copy returned here can't be used after increments of
+        // the original.
+        iterator operator++(int)
+        {
+            iterator ret = *this;
+            ++(*this);
+            return ret;
+        }
+
+        bool operator==(const iterator & _other) const
+        {
+            return m_range == _other.m_range;
+        }
+
+        bool operator!=(const iterator & _other) const
+        {
+            return m_range != _other.m_range;
+        }
+
+      private:
+        friend class codepoint_range;
+
+        explicit iterator(codepoint_range * _range) : m_range(_range)
+        {
+        }
+
+        codepoint_range * m_range;
+    };
+
+    codepoint_range(const char * _begin, const char * _end) :
+        m_it(reinterpret_cast<const uint8_t *>(_begin)),
+        m_end(reinterpret_cast<const uint8_t *>(_end)),
+        m_error_position(nullptr),
+        m_pos(0),
+        m_count(0)
+    {
+    }
+
+    explicit codepoint_range(const char * _c_str) :
+        codepoint_range(_c_str, _c_str + std::strlen(_c_str))
+    {
+    }
+
+    // only call this once, as the range is single pass.
+    iterator begin()
+    {
+        return iterator(m_pos < m_count || _refill() ? this : nullptr);
+    }
+
+    iterator end()
+    {
+        return iterator();
+    }
+
+    // the reason iteration stopped early.
+    const error_report & error() const
+    {
+        return m_error;
+    }
+
+    // the start of the invalid sequence if there was an error, nullptr otherwise.
+    const char * error_position() const
+    {
+        return reinterpret_cast<const char *>(m_error_position);
+    }
+
+  private:
+    // the maximum number of codepoints decoded at once.
+    static constexpr size_t _block_size = 256;
+
+    // decodes the next block, returns false if there are no more codepoints.
+    bool _refill()
+    {
+        m_pos = m_count = 0;
+        if (m_it == m_end || m_error)
+            return false;
+
+        // a block of _block_size bytes never holds more than _block_size codepoints, which is
+        // what transcode_to_utf32 needs. Blocks end at lead bytes to not cut valid sequences.
+        const uint8_t * block_end = m_end;
+        if (static_cast<size_t>(m_end - m_it) > _block_size)
+        {
+            block_end = m_it + _block_size;
+            for (int i = 0; i < 3 && detail::_is_valid_trailing_byte(*block_end); ++i)
+                --block_end;
+        }
+
+        transcode_result result = detail::_transcode_to_utf32(m_it, block_end, m_buffer);
+        m_count = result.produced;
+        m_it += result.consumed;
+        if (result.error)
+        {
+            // an incomplete sequence at the end of a block may just continue in the next one,
+            // so check again with the real end.
+            m_error = result.error;
+            if (m_error.code == error_code::incomplete_sequence && block_end != m_end)
+            {
+                m_error = error_report();
+                _me::decode_safe(m_it, m_end, m_error);
+            }
+            if (m_error)
+                m_error_position = m_it;
+        }
+        return m_count > 0;
+    }
+
+    const uint8_t * m_it;
+    const uint8_t * m_end;
+    const uint8_t * m_error_position;
+    error_report m_error;
+    size_t m_pos;
+    size_t m_count;
+    uint32_t m_buffer[_block_size];
+};
+
+class codepoint_array
+{
+  public:
+    // random access iterator over the codepoints. Dereferencing returns the codepoint by value.
+    class iterator
+    {
+      public:
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type = uint32_t;
+        using difference_type = std::ptrdiff_t;
+        using pointer = const uint32_t *;
+        using reference = uint32_t;
+
+        iterator() : m_array(nullptr), m_index(0)
+        {
+        }
+
+        reference operator*() const
+        {
+            return (*m_array)[m_index];
+        }
+
+        reference operator[](difference_type _n) const
+        {
+            return (*m_array)[m_index + _n];
+        }
+
+        iterator & operator++()
+        {
+            ++m_index;
+            return *this;
+        }
+
+        iterator operator++(int)
+        {
+            iterator ret = *this;
+            ++m_index;
+            return ret;
+        }
+
+        iterator & operator--()
+        {
+            --m_index;
+            return *this;
+        }
+
+        iterator operator--(int)
+        {
+            iterator ret = *this;
+            --m_index;
+            return ret;
+        }
+
+        iterator & operator+=(difference_type _n)
+        {
+            m_index += _n;
+            return *this;
+        }
+
+        iterator & operator-=(difference_type _n)
+        {
+            m_index -= _n;
+            return *this;
+        }
+
+        iterator operator+(difference_type _n) const
+        {
+            return iterator(m_array, m_index + _n);
+        }
+
+        iterator operator-(difference_type _n) const
+        {
+            return iterator(m_array, m_index - _n);
+        }
+
+        difference_type operator-(const iterator & _other) const
+        {
+            return static_cast<difference_type>(m_index) -
+                   static_cast<difference_type>(_other.m_index);
+        }
+
+        bool operator==(const iterator & _other) const
+        {
+            return m_index == _other.m_index;
+        }
+
+        bool operator!=(const iterator & _other) const
+        {
+            return m_index != _other.m_index;
+        }
+
+        bool operator<(const iterator & _other) const
+        {
+            return m_index < _other.m_index;
+        }
+
+        bool operator>(const iterator & _other) const
+        {
+            return m_index > _other.m_index;
+        }
+
+        bool operator<=(const iterator & _other) const
+        {
+            return m_index <= _other.m_index;
+        }
+
+        bool operator>=(const iterator & _other) const
+        {
+            return m_index >= _other.m_index;
+        }
+
+      private:
+        friend class codepoint_array;
+
+        iterator(const codepoint_array * _array, size_t _index) : m_array(_array), m_index(_index)
+        {
+        }
+
+        const codepoint_array * m_array;
+        size_t m_index;
+    };
+
+    codepoint_array() : m_width(1), m_size(0)
+    {
+    }
+
+    // decodes the utf8 in between _begin and _end. If it is invalid, the reason is stored in
+    // _out_error and the array is empty.
+    codepoint_array(const char * _begin, const char * _end, error_report & _out_error) :
+        codepoint_array()
+    {
+        _out_error = _assign(reinterpret_cast<const uint8_t *>(_begin),
+                             reinterpret_cast<const uint8_t *>(_end));
+        if (_out_error)
+            *this = codepoint_array();
+    }
+
+    codepoint_array(const char * _c_str, error_report & _out_error) :
+        codepoint_array(_c_str, _c_str + std::strlen(_c_str), _out_error)
+    {
+    }
+
+    // the number of codepoints.
+    size_t size() const
+    {
+        return m_size;
+    }
+
+    bool empty() const
+    {
+        return m_size == 0;
+    }
+
+    // the number of bytes per codepoint, 1, 2 or 4.
+    size_t width() const
+    {
+        return m_width;
+    }
+
+    // the stored codepoints as uint8_t, uint16_t or uint32_t depending on width().
+    const void * data() const
+    {
+        switch (m_width)
+        {
+        case 1:
+            return m_latin1.data();
+        case 2:
+            return m_ucs2.data();
+        default:
+            return m_utf32.data();
+        }
+    }
+
+    uint32_t operator[](size_t _index) const
+    {
+        assert(_index < m_size);
+        switch (m_width)
+        {
+        case 1:
+            return m_latin1[_index];
+        case 2:
+            return m_ucs2[_index];
+        default:
+            return m_utf32[_index];
+        }
+    }
+
+    iterator begin() const
+    {
+        return iterator(this, 0);
+    }
+
+    iterator end() const
+    {
+        return iterator(this, m_size);
+    }
+
+    // encodes all codepoints to _output_it. Encoding to a char pointer uses the SIMD encoder of
+    // the stored width.
+    template <class OIT>
+    OIT encode(OIT _output_it) const
+    {
+        return _encode(_output_it, std::is_same<OIT, char *>());
+    }
+
+    // the number of bytes the codepoints encode to as utf8.
+    size_t utf8_length() const
+    {
+        switch (m_width)
+        {
+        case 1:
+            return detail::_latin1_to_utf8_length(m_latin1.data(), m_latin1.data() + m_size);
+        case 2:
+            return detail::_utf8_length_from_utf16(m_ucs2.data(), m_ucs2.data() + m_size, false);
+        default:
+            return detail::_utf8_length(m_utf32.data(), m_utf32.data() + m_size);
+        }
+    }
+
+    // returns the codepoints encoded as utf8.
+    std::string to_utf8() const
+    {
+        std::string ret(utf8_length(), '\0');
+        if (!ret.empty())
+            encode(&ret[0]);
+        return ret;
+    }
+
+  private:
+    // sizes the storage to the exact number of codepoints.
+    error_report _assign(const uint8_t * _begin, const uint8_t * _end)
+    {
+        size_t length = static_cast<size_t>(_end - _begin);
+        m_width = detail::_codepoint_width(_begin, _end);
+        m_size = detail::_count_leads(_begin, _end);
+        transcode_result result;
+        switch (m_width)
+        {
+        case 1:
+            m_latin1.resize(m_size);
+            result = detail::_utf8_to_latin1(_begin, _end, m_latin1.data(), m_size);
+            break;
+        case 2:
+            m_ucs2.resize(m_size);
+            result = detail::_transcode_to_utf16(_begin, _end, m_ucs2.data(), false);
+            break;
+        default:
+            m_utf32.resize(m_size);
+            result = detail::_transcode_to_utf32_bounded(_begin, _end, m_utf32.data(), m_size);
+            // stray continuation bytes don't count, so the output can be full before them.
+            if (!result.error && result.consumed != length)
+                _me::decode_safe(_begin + result.consumed, _end, result.error);
+            break;
+        }
+        return result.error;
+    }
+
+    template <class OIT>
+    OIT _encode(OIT _output_it, std::true_type) const
+    {
+        uint8_t * out = reinterpret_cast<uint8_t *>(_output_it);
+        switch (m_width)
+        {
+        case 1:
+            out = detail::_latin1_to_utf8(m_latin1.data(), m_latin1.data() + m_size, out);
+            break;
+        case 2:
+            out += detail::_transcode_utf16_to_utf8(
+                       m_ucs2.data(), m_ucs2.data() + m_size, out, false)
+                       .produced;
+            break;
+        default:
+            detail::_encode_to_bytes(m_utf32.data(), m_utf32.data() + m_size, out, nullptr);
+            break;
+        }
+        return reinterpret_cast<OIT>(out);
+    }
+
+    template <class OIT>
+    OIT _encode(OIT _output_it, std::false_type) const
+    {
+        switch (m_width)
+        {
+        case 1:
+            return _me::encode_range(m_latin1.begin(), m_latin1.end(), _output_it);
+        case 2:
+            return _me::encode_range(m_ucs2.begin(), m_ucs2.end(), _output_it);
+        default:
+            return _me::encode_range(m_utf32.begin(), m_utf32.end(), _output_it);
+        }
+    }
+
+    size_t m_width;
+    size_t m_size;
+    std::vector<uint8_t> m_latin1;
+    std::vector<uint16_t> m_ucs2;
+    std::vector<uint32_t> m_utf32;
+};
 
 } // namespace utf8er
 
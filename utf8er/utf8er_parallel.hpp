@@ -0,0 +1,219 @@
+// license: public domain
+// full license at the end of utf8er.hpp.
+//
+// the newest version can be found at:
+// https://github.com/mokafolio/utf8er
+// ============================================================================================
+
+// parallel versions of validate and transcode_to_utf32 on top of utf8er.hpp. They live in their
+// own header, so that only code that uses them includes <thread> and links against the threads
+// library.
+
+#ifndef UTF8ER_UTF8ER_PARALLEL_HPP
+#define UTF8ER_UTF8ER_PARALLEL_HPP
+
+#include <utf8er/utf8er.hpp>
+
+#if !defined(UTF8ER_NO_THREADS)
+#include <thread>
+#endif
+
+namespace utf8er
+{
+
+// same as transcode_to_utf32, but splits large buffers into chunks that are decoded by up to
+// _thread_count threads (0 uses one per hardware thread). Each chunk is validated and counted
+// first so that all chunks can be decoded to their final position in _output at once.
+inline transcode_result transcode_to_utf32_parallel(const char * _str,
+                                                    size_t _length,
+                                                    uint32_t * _output,
+                                                    size_t _thread_count = 0);
+
+// same as validate for the _length bytes starting at _str, but splits large buffers into chunks
+// that are validated by up to _thread_count threads (0 uses one per hardware thread). Reports
+// the first error in the buffer. Runs single threaded if UTF8ER_NO_THREADS is defined.
+inline std::pair<error_report, const char *> validate_parallel(const char * _str,
+                                                               size_t _length,
+                                                               size_t _thread_count = 0);
+
+namespace detail
+{
+
+// buffers are only split in chunks of at least this many bytes, smaller ones are not worth the
+// thread overhead.
+static constexpr size_t _parallel_min_chunk_size = 1 << 16;
+
+inline size_t _parallel_chunk_count(size_t _length, size_t _thread_count)
+{
+#if defined(UTF8ER_NO_THREADS)
+    (void)_length;
+    (void)_thread_count;
+    return 1;
+#else
+    if (_thread_count == 0)
+        _thread_count = std::thread::hardware_concurrency();
+    return std::max<size_t>(1, std::min(_thread_count, _length / _parallel_min_chunk_size));
+#endif
+}
+
+// splits the bytes in between _begin and _end into _count chunks of roughly the same size. Chunk i
+// spans from _out_bounds[i] to _out_bounds[i + 1]. The splits are moved past continuation bytes
+// (at most three, like previous) so that no valid sequence is cut in two.
+inline void _split_chunks(const uint8_t * _begin,
+                          const uint8_t * _end,
+                          size_t _count,
+                          const uint8_t ** _out_bounds)
+{
+    size_t length = static_cast<size_t>(_end - _begin);
+    _out_bounds[0] = _begin;
+    _out_bounds[_count] = _end;
+    for (size_t i = 1; i < _count; ++i)
+    {
+        const uint8_t * it = _begin + length / _count * i;
+        for (int j = 0; j < 3 && it != _end && _is_valid_trailing_byte(*it); ++j)
+            ++it;
+        _out_bounds[i] = std::max(it, _out_bounds[i - 1]);
+    }
+}
+
+// decodes the valid bytes in between _begin and _end to _output without writing past the last
+// codepoint. The bulk transcoder stores whole vectors past its last codepoint (at most 8), which
+// is why the last 64 bytes (at least 16 codepoints) are decoded separately afterwards.
+inline void _decode_valid_chunk(const uint8_t * _begin, const uint8_t * _end, uint32_t * _output)
+{
+    const uint8_t * tail = _begin;
+    if (_end - _begin > 64)
+    {
+        tail = _rewind_to_lead(_begin, _end - 64);
+        _output += _transcode_to_utf32(_begin, tail, _output).produced;
+    }
+    _decode_range_impl(tail, _end, _output, std::true_type());
+}
+
+// calls _fn(i) for all i smaller than _count, each on its own thread. The last one runs on the
+// calling thread.
+template <class F>
+void _parallel_for(size_t _count, F _fn)
+{
+#if defined(UTF8ER_NO_THREADS)
+    for (size_t i = 0; i < _count; ++i)
+        _fn(i);
+#else
+    std::vector<std::thread> threads;
+    threads.reserve(_count - 1);
+    for (size_t i = 0; i + 1 < _count; ++i)
+        threads.emplace_back(_fn, i);
+    _fn(_count - 1);
+    for (std::thread & t : threads)
+        t.join();
+#endif
+}
+
+// chunks end in front of the start of a sequence, so an incomplete sequence at the end of a chunk
+// is followed by more input. Returns the error _error at _it as the serial functions report it,
+// which check it against the end of the whole buffer.
+inline error_report _chunk_error(error_report _error,
+                                 const uint8_t * _it,
+                                 const uint8_t * _chunk_end,
+                                 const uint8_t * _end)
+{
+    if (_error.code != error_code::incomplete_sequence || _chunk_end == _end)
+        return _error;
+    error_report err;
+    _me::decode_safe(_it, _end, err);
+    return err ? err : _error;
+}
+
+inline std::pair<error_report, const uint8_t *> _validate_parallel(const uint8_t * _begin,
+                                                                   const uint8_t * _end,
+                                                                   size_t _thread_count)
+{
+    size_t count = _parallel_chunk_count(static_cast<size_t>(_end - _begin), _thread_count);
+    if (count == 1)
+        return _validate_bytes(_begin, _end);
+
+    std::vector<const uint8_t *> bounds(count + 1);
+    _split_chunks(_begin, _end, count, bounds.data());
+    std::vector<std::pair<error_report, const uint8_t *>> results(count);
+    _parallel_for(count,
+                  [&](size_t _i) { results[_i] = _validate_bytes(bounds[_i], bounds[_i + 1]); });
+
+    // every chunk starts at the start of a sequence, so the first error of the first invalid
+    // chunk is the first error of the whole buffer.
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (results[i].first)
+            return std::make_pair(
+                _chunk_error(results[i].first, results[i].second, bounds[i + 1], _end),
+                results[i].second);
+    }
+    return std::make_pair(error_report(), nullptr);
+}
+
+inline transcode_result _transcode_to_utf32_parallel(const uint8_t * _begin,
+                                                     const uint8_t * _end,
+                                                     uint32_t * _output,
+                                                     size_t _thread_count)
+{
+    size_t count = _parallel_chunk_count(static_cast<size_t>(_end - _begin), _thread_count);
+    if (count == 1)
+        return _transcode_to_utf32(_begin, _end, _output);
+
+    std::vector<const uint8_t *> bounds(count + 1);
+    _split_chunks(_begin, _end, count, bounds.data());
+
+    // first pass: validate and count the codepoints of each chunk.
+    std::vector<std::pair<error_report, const uint8_t *>> results(count);
+    std::vector<size_t> offsets(count + 1);
+    _parallel_for(count, [&](size_t _i) {
+        results[_i] = _validate_bytes(bounds[_i], bounds[_i + 1]);
+        if (!results[_i].first)
+            offsets[_i + 1] = _count_leads(bounds[_i], bounds[_i + 1]);
+    });
+
+    size_t last = 0;
+    while (last + 1 < count && !results[last].first)
+        ++last;
+    for (size_t i = 0; i < last; ++i)
+        offsets[i + 1] += offsets[i];
+
+    // second pass: decode all chunks up to the first error straight to their final position.
+    // Only the last one may write past its end, as there is no chunk after it.
+    transcode_result last_result;
+    _parallel_for(last + 1, [&](size_t _i) {
+        if (_i < last)
+            _decode_valid_chunk(bounds[_i], bounds[_i + 1], _output + offsets[_i]);
+        else
+            last_result = _transcode_to_utf32(bounds[_i], bounds[_i + 1], _output + offsets[_i]);
+    });
+    const uint8_t * error_it = bounds[last] + last_result.consumed;
+    return transcode_result(_chunk_error(last_result.error, error_it, bounds[last + 1], _end),
+                            static_cast<size_t>(error_it - _begin),
+                            offsets[last] + last_result.produced);
+}
+
+} // namespace detail
+
+inline transcode_result transcode_to_utf32_parallel(const char * _str,
+                                                    size_t _length,
+                                                    uint32_t * _output,
+                                                    size_t _thread_count)
+{
+    const uint8_t * begin = reinterpret_cast<const uint8_t *>(_str);
+    return detail::_transcode_to_utf32_parallel(begin, begin + _length, _output, _thread_count);
+}
+
+inline std::pair<error_report, const char *> validate_parallel(const char * _str,
+                                                               size_t _length,
+                                                               size_t _thread_count)
+{
+    const uint8_t * begin = reinterpret_cast<const uint8_t *>(_str);
+    auto result = detail::_validate_parallel(begin, begin + _length, _thread_count);
+    if (!result.first)
+        return std::make_pair(error_report(), nullptr);
+    return std::make_pair(result.first, _str + (result.second - begin));
+}
+
+} // namespace utf8er
+
+#endif // UTF8ER_UTF8ER_PARALLEL_HPP
@@ -0,0 +1,1130 @@
+// license: public domain
+// full license at the end of utf8er.hpp.
+//
+// the newest version can be found at:
+// https://github.com/mokafolio/utf8er
+// ============================================================================================
+
+// unicode algorithms on top of utf8er.hpp that need the tables of the unicode database. They
+// live in their own header, so that only code that uses them pays for the tables. The tables are
+// generated by tools/generate_unicode_data.py.
+
+#ifndef UTF8ER_UTF8ER_UNICODE_HPP
+#define UTF8ER_UTF8ER_UNICODE_HPP
+
+#include <utf8er/utf8er.hpp>
+#include <utf8er/utf8er_unicode_data.hpp>
+
+namespace utf8er
+{
+
+// the unicode normalization forms, see https://unicode.org/reports/tr15/
+enum class normalization_form
+{
+    nfc,
+    nfd,
+    nfkc,
+    nfkd
+};
+
+// the result of the normalization quick check.
+enum class quick_check_result
+{
+    yes,
+    no,
+    maybe
+};
+
+// runs the quick check of the normalization form _form on the utf8 between _begin and _end.
+// yes means the string is normalized, no that it isn't and maybe that only normalizing tells. For
+// invalid utf8, _out_error is set and the result is no.
+inline quick_check_result quick_check(const char * _begin,
+                                      const char * _end,
+                                      normalization_form _form,
+                                      error_report & _out_error);
+
+// returns true if the utf8 between _begin and _end is in the normalization form _form. Only
+// normalizes if the quick check says maybe.
+inline bool is_normalized(const char * _begin,
+                          const char * _end,
+                          normalization_form _form,
+                          error_report & _out_error);
+
+// normalizes the utf8 between _begin and _end to _form. If the quick check finds the string to
+// be normalized already (the common case), nothing is copied and the input range is returned.
+// Otherwise the normalized string is stored in _buffer and its range is returned. The stretches
+// that pass the quick check are copied as a whole, only the codepoints around the others are
+// decomposed and composed again. For invalid utf8, _out_error is set and the range is empty.
+inline std::pair<const char *, const char *> normalize(const char * _begin,
+                                                       const char * _end,
+                                                       normalization_form _form,
+                                                       std::string & _buffer,
+                                                       error_report & _out_error);
+
+// returns _str normalized to _form, see above.
+inline std::string normalize(const std::string & _str,
+                             normalization_form _form,
+                             error_report & _out_error);
+
+// map the utf8 between _begin and _end to lower case, upper case or its case folding (for case
+// insensitive comparisons) and write it to _output, which needs room for 3 * (_end - _begin)
+// bytes. These are the full mappings of the unicode database, one codepoint may turn into up to
+// three (i.e. the folding of U+00DF is "ss"). to_lower applies the final sigma rule, the language
+// specific conditional mappings are not applied. Ascii is mapped with SIMD. Return the end of the
+// output. For invalid utf8, _out_error is set and nothing is written.
+inline char * to_lower(const char * _begin,
+                       const char * _end,
+                       char * _output,
+                       error_report & _out_error);
+inline char * to_upper(const char * _begin,
+                       const char * _end,
+                       char * _output,
+                       error_report & _out_error);
+inline char * fold_case(const char * _begin,
+                        const char * _end,
+                        char * _output,
+                        error_report & _out_error);
+
+// return _str mapped to lower case, upper case or its case folding, see above.
+inline std::string to_lower(const std::string & _str, error_report & _out_error);
+inline std::string to_upper(const std::string & _str, error_report & _out_error);
+inline std::string fold_case(const std::string & _str, error_report & _out_error);
+
+// map the utf8 between _begin and _end in place for as long as the mappings keep the length of
+// the codepoints. Return _end if everything was mapped, otherwise the start of the first
+// codepoint whose mapping is shorter or longer. Everything in front of it is mapped. For invalid
+// utf8, _out_error is set, nothing is mapped and _begin is returned.
+inline char * to_lower_in_place(char * _begin, char * _end, error_report & _out_error);
+inline char * to_upper_in_place(char * _begin, char * _end, error_report & _out_error);
+inline char * fold_case_in_place(char * _begin, char * _end, error_report & _out_error);
+
+// map _str in place. Only if a mapping changes the length, the rest of the string behind it is
+// mapped to a temporary buffer and copied back.
+inline void to_lower_in_place(std::string & _str, error_report & _out_error);
+inline void to_upper_in_place(std::string & _str, error_report & _out_error);
+inline void fold_case_in_place(std::string & _str, error_report & _out_error);
+
+// returns the start of the extended grapheme cluster (what a user perceives as one character,
+// i.e. a letter with combining marks or an emoji zwj sequence, see
+// https://unicode.org/reports/tr29/) following the one that starts at _it. _it has to be at the
+// start of a grapheme cluster in front of _end and the utf8 has to be valid. Ascii followed by
+// ascii is a cluster of its own (other than CR LF) without looking up any properties.
+template <class IT>
+IT next_grapheme(IT _it, IT _end);
+
+// returns the start of the grapheme cluster in front of the one that starts at _it. _it has to be
+// at the start of a grapheme cluster behind _begin and the utf8 has to be valid.
+template <class IT>
+IT previous_grapheme(IT _it, IT _begin);
+
+// returns the number of grapheme clusters of the valid utf8 between _begin and _end. For
+// contiguous input, runs of ascii are skipped with SIMD.
+template <class IT>
+size_t count_graphemes(IT _begin, IT _end);
+
+// Implementation follows below:
+// ============================================================================================
+
+namespace detail
+{
+
+using _udata = _unicode_data<>;
+
+// the bits of the values in the normalization tables.
+static constexpr uint16_t _nfc_qc_shift = 8;
+static constexpr uint16_t _nfkc_qc_shift = 10;
+static constexpr uint16_t _canonical_decomposition = 1 << 12;
+static constexpr uint16_t _compat_decomposition = 1 << 13;
+
+// the quick check values in the table.
+static constexpr uint16_t _qc_yes = 0;
+static constexpr uint16_t _qc_maybe = 1;
+static constexpr uint16_t _qc_no = 2;
+
+// the algorithmic hangul syllable (de)composition, see chapter 3.12 of the unicode standard.
+static constexpr uint32_t _hangul_s_base = 0xAC00;
+static constexpr uint32_t _hangul_l_base = 0x1100;
+static constexpr uint32_t _hangul_v_base = 0x1161;
+static constexpr uint32_t _hangul_t_base = 0x11A7;
+static constexpr uint32_t _hangul_l_count = 19;
+static constexpr uint32_t _hangul_v_count = 21;
+static constexpr uint32_t _hangul_t_count = 28;
+static constexpr uint32_t _hangul_n_count = _hangul_v_count * _hangul_t_count;
+static constexpr uint32_t _hangul_s_count = _hangul_l_count * _hangul_n_count;
+
+// returns the canonical combining class (low 8 bits), the quick check values and whether the
+// codepoint has a canonical or compatibility decomposition.
+inline uint16_t _normalization_props(uint32_t _cp)
+{
+    if (_cp >= _udata::limit)
+        return 0;
+    uint32_t block = _udata::normalization_stage1[_cp >> _udata::shift];
+    return _udata::normalization_stage2[(block << _udata::shift) |
+                                        (_cp & ((1u << _udata::shift) - 1))];
+}
+
+inline uint8_t _ccc(uint16_t _props)
+{
+    return static_cast<uint8_t>(_props);
+}
+
+inline uint16_t _quick_check_value(uint16_t _props, normalization_form _form)
+{
+    switch (_form)
+    {
+    case normalization_form::nfc:
+        return (_props >> _nfc_qc_shift) & 3;
+    case normalization_form::nfkc:
+        return (_props >> _nfkc_qc_shift) & 3;
+    case normalization_form::nfd:
+        return _props & _canonical_decomposition ? _qc_no : _qc_yes;
+    default:
+        return _props & (_canonical_decomposition | _compat_decomposition) ? _qc_no : _qc_yes;
+    }
+}
+
+inline bool _composes(normalization_form _form)
+{
+    return _form == normalization_form::nfc || _form == normalization_form::nfkc;
+}
+
+// normalization can start over at codepoints that are a starter and pass the quick check, as
+// nothing in front of them combines with them or anything after them.
+inline bool _is_stable(uint16_t _props, normalization_form _form)
+{
+    return _ccc(_props) == 0 && _quick_check_value(_props, _form) == _qc_yes;
+}
+
+// returns the first byte in between _begin and _end that is not below _bound, see _skip_ascii.
+inline const uint8_t * _skip_below(const uint8_t * _begin, const uint8_t * _end, uint8_t _bound)
+{
+#if defined(UTF8ER_AVX2)
+    const __m256i bound32 = _mm256_set1_epi8(static_cast<char>(_bound));
+    for (; _end - _begin >= 32; _begin += 32)
+    {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(_begin));
+        uint32_t mask = static_cast<uint32_t>(
+            _mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(v, bound32), v)));
+        if (mask)
+            return _begin + _ctz(mask);
+    }
+#endif
+#if defined(UTF8ER_SSE2)
+    const __m128i bound16 = _mm_set1_epi8(static_cast<char>(_bound));
+    for (; _end - _begin >= 16; _begin += 16)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_begin));
+        uint32_t mask = static_cast<uint32_t>(
+            _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(v, bound16), v)));
+        if (mask)
+            return _begin + _ctz(mask);
+    }
+#endif
+    while (_begin != _end && *_begin < _bound)
+        ++_begin;
+    return _begin;
+}
+
+// runs the quick check on the valid utf8 between _begin and _end. _out_stable is set to the start
+// of the last stable codepoint in front of the first codepoint that does not pass, or _begin if
+// there is none. Stops at the first codepoint that does not pass if _stop_at_maybe is true and
+// returns its start in _out_stop (_end if all pass).
+inline quick_check_result _quick_check(const uint8_t * _begin,
+                                       const uint8_t * _end,
+                                       normalization_form _form,
+                                       bool _stop_at_maybe,
+                                       const uint8_t *& _out_stable,
+                                       const uint8_t *& _out_stop)
+{
+    // U+0300 for NFC, U+00C0 for NFD and U+00A0 for the compatibility forms.
+    const uint8_t stable_leads_end = _form == normalization_form::nfc   ? 0xCC
+                                     : _form == normalization_form::nfd ? 0xC3
+                                                                        : 0xC2;
+    quick_check_result result = quick_check_result::yes;
+    const uint8_t * it = _begin;
+    _out_stable = _begin;
+    uint8_t last_ccc = 0;
+    while (it != _end)
+    {
+        // ascii and the two byte sequences with lead bytes below stable_leads_end are stable.
+        // Their continuation bytes are below it as well, so the run ends at a lead byte.
+        if (*it < stable_leads_end)
+        {
+            it = _skip_below(it, _end, stable_leads_end);
+            if (result == quick_check_result::yes)
+                _out_stable = _is_valid_trailing_byte(it[-1]) ? it - 2 : it - 1;
+            last_ccc = 0;
+            continue;
+        }
+
+        const uint8_t * cp_start = it;
+        uint32_t cp;
+        it = _me::decode_and_next(it, cp);
+        uint16_t props = _normalization_props(cp);
+        uint8_t ccc = _ccc(props);
+        uint16_t qc = _quick_check_value(props, _form);
+        if ((last_ccc > ccc && ccc != 0) || qc != _qc_yes)
+        {
+            result = (last_ccc > ccc && ccc != 0) || qc == _qc_no ? quick_check_result::no
+                                                                  : quick_check_result::maybe;
+            if (_stop_at_maybe || result == quick_check_result::no)
+            {
+                _out_stop = cp_start;
+                return result;
+            }
+        }
+        else if (ccc == 0 && result == quick_check_result::yes)
+        {
+            _out_stable = cp_start;
+        }
+        last_ccc = ccc;
+    }
+    _out_stop = _end;
+    return result;
+}
+
+// appends the full decomposition of _cp to _output.
+inline void _decompose(uint32_t _cp, uint16_t _props, bool _compat, std::vector<uint32_t> & _output)
+{
+    if (!(_props & (_compat ? _canonical_decomposition | _compat_decomposition
+                            : _canonical_decomposition)))
+    {
+        _output.push_back(_cp);
+        return;
+    }
+
+    if (_cp >= _hangul_s_base && _cp < _hangul_s_base + _hangul_s_count)
+    {
+        uint32_t index = _cp - _hangul_s_base;
+        _output.push_back(_hangul_l_base + index / _hangul_n_count);
+        _output.push_back(_hangul_v_base + (index % _hangul_n_count) / _hangul_t_count);
+        if (index % _hangul_t_count)
+            _output.push_back(_hangul_t_base + index % _hangul_t_count);
+        return;
+    }
+
+    // the tables hold the codepoint in the upper bits and the offset into the pool in the lower
+    // 14 bits of every entry. The next entry marks the end of the decomposition.
+    bool compat = _compat && (_props & _compat_decomposition);
+    const uint32_t * keys =
+        compat ? _udata::compat_decompositions : _udata::canonical_decompositions;
+    const uint32_t * pool = compat ? _udata::compat_pool : _udata::canonical_pool;
+    size_t count = compat ? _udata::compat_count : _udata::canonical_count;
+    const uint32_t * entry =
+        std::lower_bound(keys, keys + count, _cp << 14, [](uint32_t _a, uint32_t _b) {
+            return _a >> 14 < _b >> 14;
+        });
+    assert(entry != keys + count && (*entry >> 14) == _cp);
+    _output.insert(_output.end(), pool + (entry[0] & 0x3FFF), pool + (entry[1] & 0x3FFF));
+}
+
+// returns the primary composite of _first and _second, or 0 if there is none.
+inline uint32_t _compose(uint32_t _first, uint32_t _second)
+{
+    if (_first >= _hangul_l_base && _first < _hangul_l_base + _hangul_l_count)
+    {
+        if (_second >= _hangul_v_base && _second < _hangul_v_base + _hangul_v_count)
+            return _hangul_s_base + ((_first - _hangul_l_base) * _hangul_v_count +
+                                     (_second - _hangul_v_base)) *
+                                        _hangul_t_count;
+        return 0;
+    }
+    if (_first >= _hangul_s_base && _first < _hangul_s_base + _hangul_s_count)
+    {
+        if ((_first - _hangul_s_base) % _hangul_t_count == 0 && _second > _hangul_t_base &&
+            _second < _hangul_t_base + _hangul_t_count)
+            return _first + (_second - _hangul_t_base);
+        return 0;
+    }
+
+    // every entry is the first and second codepoint followed by the composite.
+    size_t lo = 0;
+    size_t hi = _udata::composite_count;
+    while (lo < hi)
+    {
+        size_t mid = (lo + hi) / 2;
+        const uint32_t * entry = _udata::composites + mid * 3;
+        if (entry[0] < _first || (entry[0] == _first && entry[1] < _second))
+            lo = mid + 1;
+        else
+            hi = mid;
+    }
+    const uint32_t * entry = _udata::composites + lo * 3;
+    if (lo < _udata::composite_count && entry[0] == _first && entry[1] == _second)
+        return entry[2];
+    return 0;
+}
+
+// moves the codepoint at _index in front of the combining marks before it that have a higher
+// combining class. Called for every appended codepoint, this is an insertion sort of the
+// combining marks following every starter.
+inline void _reorder(std::vector<uint32_t> & _cps, size_t _index)
+{
+    uint8_t ccc = _ccc(_normalization_props(_cps[_index]));
+    if (ccc == 0)
+        return;
+    for (; _index > 0 && _ccc(_normalization_props(_cps[_index - 1])) > ccc; --_index)
+        std::swap(_cps[_index], _cps[_index - 1]);
+}
+
+// composes the decomposed and ordered codepoints in _cps in place, see chapter 3.11 of the
+// unicode standard.
+inline void _compose_all(std::vector<uint32_t> & _cps)
+{
+    if (_cps.empty())
+        return;
+
+    size_t starter = 0;
+    // the combining class of the last codepoint that was not composed, 256 if the first
+    // codepoint is not a starter and can't compose.
+    uint32_t last_ccc = _ccc(_normalization_props(_cps[0])) ? 256 : 0;
+    size_t out = 1;
+    for (size_t i = 1; i < _cps.size(); ++i)
+    {
+        uint32_t cp = _cps[i];
+        uint16_t props = _normalization_props(cp);
+        uint32_t ccc = _ccc(props);
+        // only codepoints that may follow a starter in a composite compose.
+        if (((props >> _nfc_qc_shift) & 3) == _qc_maybe && (last_ccc < ccc || last_ccc == 0))
+        {
+            uint32_t composite = _compose(_cps[starter], cp);
+            if (composite)
+            {
+                _cps[starter] = composite;
+                continue;
+            }
+        }
+        if (ccc == 0)
+            starter = out;
+        last_ccc = ccc;
+        _cps[out++] = cp;
+    }
+    _cps.resize(out);
+}
+
+// appends the normalization of the valid utf8 between _begin and _end to _output.
+inline void _normalize(const uint8_t * _begin,
+                       const uint8_t * _end,
+                       normalization_form _form,
+                       std::string & _output)
+{
+    bool compat = _form == normalization_form::nfkc || _form == normalization_form::nfkd;
+    std::vector<uint32_t> cps;
+    const uint8_t * it = _begin;
+    while (it != _end)
+    {
+        const uint8_t * stable;
+        const uint8_t * stop;
+        _quick_check(it, _end, _form, true, stable, stop);
+        _output.append(reinterpret_cast<const char *>(it), reinterpret_cast<const char *>(stable));
+        if (stop == _end)
+        {
+            _output.append(reinterpret_cast<const char *>(stable),
+                           reinterpret_cast<const char *>(_end));
+            return;
+        }
+
+        // decomposes everything up to the next stable codepoint after the one that did not pass.
+        cps.clear();
+        it = stable;
+        while (it != _end)
+        {
+            const uint8_t * next = it;
+            uint32_t cp;
+            next = _me::decode_and_next(next, cp);
+            uint16_t props = _normalization_props(cp);
+            if (it > stop && _is_stable(props, _form))
+                break;
+            size_t first = cps.size();
+            _decompose(cp, props, compat, cps);
+            for (size_t i = first; i < cps.size(); ++i)
+                _reorder(cps, i);
+            it = next;
+        }
+        if (_composes(_form))
+            _compose_all(cps);
+        _me::append_range(cps.begin(), cps.end(), _output);
+    }
+}
+
+// the columns of the case mapping table. The last one holds the flags below.
+static constexpr size_t _case_lower = 0;
+static constexpr size_t _case_upper = 1;
+static constexpr size_t _case_fold = 2;
+static constexpr size_t _case_flags = 3;
+
+// the cased and case ignorable properties, which the final sigma rule looks at.
+static constexpr int32_t _case_cased = 1;
+static constexpr int32_t _case_ignorable = 2;
+
+static constexpr uint32_t _capital_sigma = 0x3A3;
+static constexpr uint32_t _final_sigma = 0x3C2;
+
+// returns the lower, upper and folded case mapping and the flags of _cp. Below
+// _udata::case_expansion a mapping is the difference between the mapped codepoint and _cp, above
+// it the offset into the pool (shifted by two) and the number of codepoints (in the lowest two
+// bits) of a mapping to more than one codepoint.
+inline const int32_t * _case_record(uint32_t _cp)
+{
+    if (_cp >= _udata::limit)
+    {
+        // the second record is the one of the tags and variation selectors in plane 14, which
+        // are case ignorable.
+        bool ignorable = _cp == 0xE0001 || (_cp >= 0xE0020 && _cp < 0xE0080) ||
+                         (_cp >= 0xE0100 && _cp < 0xE01F0);
+        return _udata::case_mappings + (ignorable ? 4 : 0);
+    }
+    uint32_t block = _udata::case_stage1[_cp >> _udata::shift];
+    uint32_t index =
+        _udata::case_stage2[(block << _udata::shift) | (_cp & ((1u << _udata::shift) - 1))];
+    return _udata::case_mappings + index * 4;
+}
+
+// returns whether the last codepoint of the valid utf8 between _begin and _end that is not case
+// ignorable is cased.
+inline bool _ends_cased(const uint8_t * _begin, const uint8_t * _end)
+{
+    while (_end != _begin)
+    {
+        do
+            --_end;
+        while (_is_valid_trailing_byte(*_end));
+        uint32_t cp = _me::decode(_end);
+        int32_t flags = _case_record(cp)[_case_flags];
+        if (!(flags & _case_ignorable))
+            return (flags & _case_cased) != 0;
+    }
+    return false;
+}
+
+// returns whether the first codepoint of the valid utf8 between _begin and _end that is not case
+// ignorable is cased.
+inline bool _starts_cased(const uint8_t * _begin, const uint8_t * _end)
+{
+    while (_begin != _end)
+    {
+        uint32_t cp;
+        _begin = _me::decode_and_next(_begin, cp);
+        int32_t flags = _case_record(cp)[_case_flags];
+        if (!(flags & _case_ignorable))
+            return (flags & _case_cased) != 0;
+    }
+    return false;
+}
+
+// maps the ascii in front of the first non ascii byte between _begin and _end to _output by
+// flipping the case bit of the bytes in between _first and _last. Returns the first non ascii
+// byte. Whole blocks are stored, non ascii bytes unchanged. This is why _output may be _begin
+// and otherwise needs room for three times the input, as _map_case grants.
+inline const uint8_t * _map_ascii(const uint8_t * _begin,
+                                  const uint8_t * _end,
+                                  uint8_t *& _output,
+                                  uint8_t _first,
+                                  uint8_t _last)
+{
+    // non ascii bytes are negative for the signed comparisons and never in between.
+#if defined(UTF8ER_AVX2)
+    const __m256i below32 = _mm256_set1_epi8(static_cast<char>(_first - 1));
+    const __m256i above32 = _mm256_set1_epi8(static_cast<char>(_last + 1));
+    const __m256i bit32 = _mm256_set1_epi8(0x20);
+    for (; _end - _begin >= 32; _begin += 32, _output += 32)
+    {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(_begin));
+        __m256i in =
+            _mm256_and_si256(_mm256_cmpgt_epi8(v, below32), _mm256_cmpgt_epi8(above32, v));
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(_output),
+                            _mm256_xor_si256(v, _mm256_and_si256(in, bit32)));
+        uint32_t mask = static_cast<uint32_t>(_mm256_movemask_epi8(v));
+        if (mask)
+        {
+            _output += _ctz(mask);
+            return _begin + _ctz(mask);
+        }
+    }
+#endif
+#if defined(UTF8ER_SSE2)
+    const __m128i below16 = _mm_set1_epi8(static_cast<char>(_first - 1));
+    const __m128i above16 = _mm_set1_epi8(static_cast<char>(_last + 1));
+    const __m128i bit16 = _mm_set1_epi8(0x20);
+    for (; _end - _begin >= 16; _begin += 16, _output += 16)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_begin));
+        __m128i in = _mm_and_si128(_mm_cmpgt_epi8(v, below16), _mm_cmpgt_epi8(above16, v));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(_output),
+                         _mm_xor_si128(v, _mm_and_si128(in, bit16)));
+        uint32_t mask = static_cast<uint32_t>(_mm_movemask_epi8(v));
+        if (mask)
+        {
+            _output += _ctz(mask);
+            return _begin + _ctz(mask);
+        }
+    }
+#else
+    // adding 0x80 - _first sets the high bit of the bytes from _first on, adding 0x7F - _last the
+    // one of the bytes after _last. Neither overflows for ascii.
+    const uint64_t ones = 0x0101010101010101ull;
+    for (; _end - _begin >= 8; _begin += 8, _output += 8)
+    {
+        uint64_t word;
+        std::memcpy(&word, _begin, 8);
+        if (word & 0x8080808080808080ull)
+            break;
+        uint64_t in = (word + ones * (0x80 - _first)) & ~(word + ones * (0x7F - _last));
+        word ^= (in & 0x8080808080808080ull) >> 2;
+        std::memcpy(_output, &word, 8);
+    }
+#endif
+    for (; _begin != _end && *_begin < 0x80; ++_begin)
+        *_output++ = static_cast<uint8_t>(*_begin ^ (static_cast<uint8_t>(*_begin - _first) <=
+                                                     static_cast<uint8_t>(_last - _first))
+                                                        << 5);
+    return _begin;
+}
+
+// maps the valid utf8 between _begin and _end with the case mapping _op to _output, which needs
+// room for three times the input. If _in_place is true, _output is _begin and the mapping stops
+// at the first codepoint whose mapping has a different length. Returns where it stopped.
+// _text_begin is the start of the whole text, the final sigma rule looks at the codepoints in
+// between it and _begin. Lower casing them in place does not change its outcome.
+inline const uint8_t * _map_case(const uint8_t * _text_begin,
+                                 const uint8_t * _begin,
+                                 const uint8_t * _end,
+                                 uint8_t *& _output,
+                                 size_t _op,
+                                 bool _in_place)
+{
+    const uint8_t first = _op == _case_upper ? 'a' : 'A';
+    const uint8_t last = static_cast<uint8_t>(first + 25);
+    while (_begin != _end)
+    {
+        if (*_begin < 0x80)
+        {
+            _begin = _map_ascii(_begin, _end, _output, first, last);
+            continue;
+        }
+
+        uint32_t cp;
+        const uint8_t * next = _me::decode_and_next(_begin, cp);
+        size_t length = static_cast<size_t>(next - _begin);
+        int32_t mapping = _case_record(cp)[_op];
+        // the final sigma rule of chapter 3.13 of the unicode standard: a capital sigma after a
+        // cased letter that is not followed by one ends a word. Like ICU and python, case
+        // ignorable codepoints are skipped in both directions even if they are cased.
+        if (cp == _capital_sigma && _op == _case_lower && _ends_cased(_text_begin, _begin) &&
+            !_starts_cased(next, _end))
+            mapping = static_cast<int32_t>(_final_sigma - _capital_sigma);
+        // codepoints that map to themselves are encoded again as well, which is faster than
+        // telling them apart for text that mixes cases.
+        if (mapping < _udata::case_expansion)
+        {
+            uint32_t mapped = static_cast<uint32_t>(static_cast<int32_t>(cp) + mapping);
+            if (_in_place && _utf8_length(mapped) != length)
+                return _begin;
+            _output = _encode_impl(mapped, _output);
+        }
+        else
+        {
+            const uint32_t * cps = _udata::case_pool + ((mapping - _udata::case_expansion) >> 2);
+            const uint32_t * cps_end = cps + (mapping & 3);
+            if (_in_place)
+            {
+                size_t mapped_length = 0;
+                for (const uint32_t * it = cps; it != cps_end; ++it)
+                    mapped_length += _utf8_length(*it);
+                if (mapped_length != length)
+                    return _begin;
+            }
+            for (; cps != cps_end; ++cps)
+                _output = _encode_impl(*cps, _output);
+        }
+        _begin = next;
+    }
+    return _begin;
+}
+
+inline char * _map_case(
+    const char * _begin, const char * _end, char * _output, size_t _op, error_report & _out_error)
+{
+    const uint8_t * begin = reinterpret_cast<const uint8_t *>(_begin);
+    const uint8_t * end = reinterpret_cast<const uint8_t *>(_end);
+    _out_error = _validate_bytes(begin, end).first;
+    if (_out_error)
+        return _output;
+    uint8_t * out = reinterpret_cast<uint8_t *>(_output);
+    _map_case(begin, begin, end, out, _op, false);
+    return reinterpret_cast<char *>(out);
+}
+
+inline std::string _map_case(const std::string & _str, size_t _op, error_report & _out_error)
+{
+    std::string ret(_str.size() * 3, '\0');
+    char * end = _map_case(_str.data(), _str.data() + _str.size(), &ret[0], _op, _out_error);
+    ret.resize(static_cast<size_t>(end - ret.data()));
+    return ret;
+}
+
+inline char * _map_case_in_place(char * _begin, char * _end, size_t _op, error_report & _out_error)
+{
+    const uint8_t * begin = reinterpret_cast<const uint8_t *>(_begin);
+    const uint8_t * end = reinterpret_cast<const uint8_t *>(_end);
+    _out_error = _validate_bytes(begin, end).first;
+    if (_out_error)
+        return _begin;
+    uint8_t * out = reinterpret_cast<uint8_t *>(_begin);
+    return _begin + (_map_case(begin, begin, end, out, _op, true) - begin);
+}
+
+inline void _map_case_in_place(std::string & _str, size_t _op, error_report & _out_error)
+{
+    if (_str.empty())
+        return;
+    char * begin = &_str[0];
+    char * end = begin + _str.size();
+    char * stop = _map_case_in_place(begin, end, _op, _out_error);
+    if (_out_error || stop == end)
+        return;
+
+    std::string rest(static_cast<size_t>(end - stop) * 3, '\0');
+    uint8_t * out = reinterpret_cast<uint8_t *>(&rest[0]);
+    _map_case(reinterpret_cast<const uint8_t *>(begin),
+              reinterpret_cast<const uint8_t *>(stop),
+              reinterpret_cast<const uint8_t *>(end),
+              out,
+              _op,
+              false);
+    _str.replace(static_cast<size_t>(stop - begin),
+                 std::string::npos,
+                 rest.data(),
+                 static_cast<size_t>(reinterpret_cast<char *>(out) - rest.data()));
+}
+
+// the grapheme cluster break property values in the grapheme tables, see
+// tools/generate_unicode_data.py.
+static constexpr uint8_t _gcb_other = 0;
+static constexpr uint8_t _gcb_cr = 1;
+static constexpr uint8_t _gcb_lf = 2;
+static constexpr uint8_t _gcb_control = 3;
+static constexpr uint8_t _gcb_extend = 4;
+static constexpr uint8_t _gcb_zwj = 5;
+static constexpr uint8_t _gcb_regional_indicator = 6;
+static constexpr uint8_t _gcb_prepend = 7;
+static constexpr uint8_t _gcb_spacing_mark = 8;
+static constexpr uint8_t _gcb_l = 9;
+static constexpr uint8_t _gcb_v = 10;
+static constexpr uint8_t _gcb_t = 11;
+static constexpr uint8_t _gcb_lv = 12;
+static constexpr uint8_t _gcb_lvt = 13;
+static constexpr uint8_t _gcb_mask = 15;
+// set in addition for extended pictographic codepoints.
+static constexpr uint8_t _gcb_pictographic = 16;
+
+// returns the grapheme cluster break property of _cp and whether it is extended pictographic.
+inline uint8_t _grapheme_props(uint32_t _cp)
+{
+    if (_cp >= _udata::limit)
+    {
+        // only the tags and variation selectors in plane 14 extend, the rest of its first 4096
+        // codepoints are controls.
+        if (_cp >> 12 != 0xE0)
+            return _gcb_other;
+        return (_cp >= 0xE0020 && _cp < 0xE0080) || (_cp >= 0xE0100 && _cp < 0xE01F0)
+                   ? _gcb_extend
+                   : _gcb_control;
+    }
+    uint32_t block = _udata::grapheme_stage1[_cp >> _udata::shift];
+    return _udata::grapheme_stage2[(block << _udata::shift) | (_cp & ((1u << _udata::shift) - 1))];
+}
+
+// for every grapheme cluster break property, the properties that never have a boundary in front
+// of them if they follow it (GB3 to GB9b).
+template <class T = void>
+struct _grapheme_joins_holder
+{
+    static const uint16_t joins[14];
+};
+
+template <class T>
+const uint16_t _grapheme_joins_holder<T>::joins[14] = {
+    // other, CR, LF and control (GB3, GB4)
+    1 << _gcb_extend | 1 << _gcb_zwj | 1 << _gcb_spacing_mark,
+    1 << _gcb_lf,
+    0,
+    0,
+    // extend, zwj and regional indicator (GB9, GB9a)
+    1 << _gcb_extend | 1 << _gcb_zwj | 1 << _gcb_spacing_mark,
+    1 << _gcb_extend | 1 << _gcb_zwj | 1 << _gcb_spacing_mark,
+    1 << _gcb_extend | 1 << _gcb_zwj | 1 << _gcb_spacing_mark,
+    // prepend joins everything but controls (GB9b, GB5), spacing mark.
+    0xFFFF & ~(1 << _gcb_cr | 1 << _gcb_lf | 1 << _gcb_control),
+    1 << _gcb_extend | 1 << _gcb_zwj | 1 << _gcb_spacing_mark,
+    // the hangul syllable types L, V, T, LV and LVT (GB6, GB7, GB8)
+    1 << _gcb_extend | 1 << _gcb_zwj | 1 << _gcb_spacing_mark | 1 << _gcb_l | 1 << _gcb_v |
+        1 << _gcb_lv | 1 << _gcb_lvt,
+    1 << _gcb_extend | 1 << _gcb_zwj | 1 << _gcb_spacing_mark | 1 << _gcb_v | 1 << _gcb_t,
+    1 << _gcb_extend | 1 << _gcb_zwj | 1 << _gcb_spacing_mark | 1 << _gcb_t,
+    1 << _gcb_extend | 1 << _gcb_zwj | 1 << _gcb_spacing_mark | 1 << _gcb_v | 1 << _gcb_t,
+    1 << _gcb_extend | 1 << _gcb_zwj | 1 << _gcb_spacing_mark | 1 << _gcb_t,
+};
+
+// returns true if there is a grapheme cluster boundary between two codepoints with the
+// properties _prev and _next. _zwj_sequence tells if _prev is a ZWJ following an extended
+// pictographic codepoint and any number of Extend, _odd_regional_indicators if _prev ends an odd
+// number of regional indicators.
+inline bool _is_grapheme_break(uint8_t _prev,
+                               uint8_t _next,
+                               bool _zwj_sequence,
+                               bool _odd_regional_indicators)
+{
+    uint8_t next = _next & _gcb_mask;
+    if (_grapheme_joins_holder<>::joins[_prev & _gcb_mask] & (1 << next))
+        return false;
+    // GB11, emoji zwj sequences.
+    if (_zwj_sequence && (_next & _gcb_pictographic))
+        return false;
+    // GB12 and GB13, regional indicators pair up as flags.
+    return !(_odd_regional_indicators && next == _gcb_regional_indicator);
+}
+
+// follows the grapheme cluster rules through a string, one codepoint after the other.
+struct _grapheme_breaker
+{
+    // starts with a codepoint with the properties _props.
+    explicit _grapheme_breaker(uint8_t _props) :
+        m_prev(_props),
+        m_pictographic((_props & _gcb_pictographic) != 0),
+        m_zwj_sequence(false),
+        m_regional_indicators((_props & _gcb_mask) == _gcb_regional_indicator)
+    {
+    }
+
+    // moves on to a codepoint with the properties _props and returns true if there is a grapheme
+    // cluster boundary in front of it.
+    bool next(uint8_t _props)
+    {
+        bool ret = _is_grapheme_break(m_prev, _props, m_zwj_sequence, m_regional_indicators % 2);
+        uint8_t gcb = _props & _gcb_mask;
+        m_zwj_sequence = m_pictographic && gcb == _gcb_zwj;
+        m_pictographic = (_props & _gcb_pictographic) || (m_pictographic && gcb == _gcb_extend);
+        m_regional_indicators = gcb == _gcb_regional_indicator ? m_regional_indicators + 1 : 0;
+        m_prev = _props;
+        return ret;
+    }
+
+    uint8_t m_prev;
+    // true if the codepoints up to m_prev are an extended pictographic one and any number of
+    // Extend.
+    bool m_pictographic;
+    bool m_zwj_sequence;
+    size_t m_regional_indicators;
+};
+
+// returns the first byte between _begin and _end that is not ascii or is a CR. Every byte in
+// front of it but the last is a grapheme cluster of its own.
+inline const uint8_t * _skip_ascii_graphemes(const uint8_t * _begin, const uint8_t * _end)
+{
+#if defined(UTF8ER_AVX2)
+    const __m256i cr32 = _mm256_set1_epi8('\r');
+    for (; _end - _begin >= 32; _begin += 32)
+    {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(_begin));
+        uint32_t mask = static_cast<uint32_t>(
+            _mm256_movemask_epi8(_mm256_or_si256(v, _mm256_cmpeq_epi8(v, cr32))));
+        if (mask)
+            return _begin + _ctz(mask);
+    }
+#endif
+#if defined(UTF8ER_SSE2)
+    const __m128i cr16 = _mm_set1_epi8('\r');
+    for (; _end - _begin >= 16; _begin += 16)
+    {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i *>(_begin));
+        uint32_t mask =
+            static_cast<uint32_t>(_mm_movemask_epi8(_mm_or_si128(v, _mm_cmpeq_epi8(v, cr16))));
+        if (mask)
+            return _begin + _ctz(mask);
+    }
+#endif
+    while (_begin != _end && *_begin < 0x80 && *_begin != '\r')
+        ++_begin;
+    return _begin;
+}
+
+template <class IT>
+size_t _count_graphemes_impl(IT _begin, IT _end, std::false_type)
+{
+    if (_begin == _end)
+        return 0;
+    uint32_t cp;
+    _begin = _me::decode_and_next(_begin, cp);
+    _grapheme_breaker breaker(_grapheme_props(cp));
+    size_t ret = 1;
+    while (_begin != _end)
+    {
+        _begin = _me::decode_and_next(_begin, cp);
+        ret += breaker.next(_grapheme_props(cp));
+    }
+    return ret;
+}
+
+template <class IT>
+size_t _count_graphemes_impl(IT _begin, IT _end, std::true_type)
+{
+    if (_begin == _end)
+        return 0;
+    const uint8_t * it = _byte_ptr(_begin);
+    const uint8_t * end = it + (_end - _begin);
+    size_t ret = 0;
+    while (it != end)
+    {
+        // it is at a boundary here.
+        if (*it < 0x80 && *it != '\r')
+        {
+            // the last byte of the run may be followed by combining marks.
+            const uint8_t * run_end = _skip_ascii_graphemes(it, end);
+            ret += static_cast<size_t>(run_end - it) - 1;
+            it = run_end - 1;
+        }
+
+        // follows the rules until the next boundary in front of ascii.
+        uint32_t cp;
+        it = _me::decode_and_next(it, cp);
+        _grapheme_breaker breaker(_grapheme_props(cp));
+        ++ret;
+        while (it != end)
+        {
+            const uint8_t * next = _me::decode_and_next(it, cp);
+            if (breaker.next(_grapheme_props(cp)))
+            {
+                if (*it < 0x80 && *it != '\r')
+                    break;
+                ++ret;
+            }
+            it = next;
+        }
+    }
+    return ret;
+}
+
+} // namespace detail
+
+inline quick_check_result quick_check(const char * _begin,
+                                      const char * _end,
+                                      normalization_form _form,
+                                      error_report & _out_error)
+{
+    const uint8_t * begin = reinterpret_cast<const uint8_t *>(_begin);
+    const uint8_t * end = reinterpret_cast<const uint8_t *>(_end);
+    _out_error = detail::_validate_bytes(begin, end).first;
+    if (_out_error)
+        return quick_check_result::no;
+    const uint8_t * stable;
+    const uint8_t * stop;
+    return detail::_quick_check(begin, end, _form, false, stable, stop);
+}
+
+inline bool is_normalized(const char * _begin,
+                          const char * _end,
+                          normalization_form _form,
+                          error_report & _out_error)
+{
+    quick_check_result qc = quick_check(_begin, _end, _form, _out_error);
+    if (qc != quick_check_result::maybe)
+        return qc == quick_check_result::yes;
+    std::string buffer;
+    auto res = normalize(_begin, _end, _form, buffer, _out_error);
+    return static_cast<size_t>(res.second - res.first) == static_cast<size_t>(_end - _begin) &&
+           std::equal(res.first, res.second, _begin);
+}
+
+inline std::pair<const char *, const char *> normalize(const char * _begin,
+                                                       const char * _end,
+                                                       normalization_form _form,
+                                                       std::string & _buffer,
+                                                       error_report & _out_error)
+{
+    const uint8_t * begin = reinterpret_cast<const uint8_t *>(_begin);
+    const uint8_t * end = reinterpret_cast<const uint8_t *>(_end);
+    _out_error = detail::_validate_bytes(begin, end).first;
+    if (_out_error)
+        return std::make_pair(_begin, _begin);
+
+    const uint8_t * stable;
+    const uint8_t * stop;
+    detail::_quick_check(begin, end, _form, true, stable, stop);
+    if (stop == end)
+        return std::make_pair(_begin, _end);
+
+    _buffer.clear();
+    detail::_normalize(begin, end, _form, _buffer);
+    return std::make_pair(_buffer.data(), _buffer.data() + _buffer.size());
+}
+
+inline std::string normalize(const std::string & _str,
+                             normalization_form _form,
+                             error_report & _out_error)
+{
+    std::string buffer;
+    auto res = normalize(_str.data(), _str.data() + _str.size(), _form, buffer, _out_error);
+    if (res.first == _str.data())
+        return std::string(res.first, res.second);
+    return buffer;
+}
+
+inline char * to_lower(const char * _begin,
+                       const char * _end,
+                       char * _output,
+                       error_report & _out_error)
+{
+    return detail::_map_case(_begin, _end, _output, detail::_case_lower, _out_error);
+}
+
+inline char * to_upper(const char * _begin,
+                       const char * _end,
+                       char * _output,
+                       error_report & _out_error)
+{
+    return detail::_map_case(_begin, _end, _output, detail::_case_upper, _out_error);
+}
+
+inline char * fold_case(const char * _begin,
+                        const char * _end,
+                        char * _output,
+                        error_report & _out_error)
+{
+    return detail::_map_case(_begin, _end, _output, detail::_case_fold, _out_error);
+}
+
+inline std::string to_lower(const std::string & _str, error_report & _out_error)
+{
+    return detail::_map_case(_str, detail::_case_lower, _out_error);
+}
+
+inline std::string to_upper(const std::string & _str, error_report & _out_error)
+{
+    return detail::_map_case(_str, detail::_case_upper, _out_error);
+}
+
+inline std::string fold_case(const std::string & _str, error_report & _out_error)
+{
+    return detail::_map_case(_str, detail::_case_fold, _out_error);
+}
+
+inline char * to_lower_in_place(char * _begin, char * _end, error_report & _out_error)
+{
+    return detail::_map_case_in_place(_begin, _end, detail::_case_lower, _out_error);
+}
+
+inline char * to_upper_in_place(char * _begin, char * _end, error_report & _out_error)
+{
+    return detail::_map_case_in_place(_begin, _end, detail::_case_upper, _out_error);
+}
+
+inline char * fold_case_in_place(char * _begin, char * _end, error_report & _out_error)
+{
+    return detail::_map_case_in_place(_begin, _end, detail::_case_fold, _out_error);
+}
+
+inline void to_lower_in_place(std::string & _str, error_report & _out_error)
+{
+    detail::_map_case_in_place(_str, detail::_case_lower, _out_error);
+}
+
+inline void to_upper_in_place(std::string & _str, error_report & _out_error)
+{
+    detail::_map_case_in_place(_str, detail::_case_upper, _out_error);
+}
+
+inline void fold_case_in_place(std::string & _str, error_report & _out_error)
+{
+    detail::_map_case_in_place(_str, detail::_case_fold, _out_error);
+}
+
+template <class IT>
+IT next_grapheme(IT _it, IT _end)
+{
+    IT it = _it;
+    uint8_t first = static_cast<uint8_t>(*it);
+    if (first < 0x80 && ++it != _end && static_cast<uint8_t>(*it) < 0x80)
+        return first == '\r' && *it == '\n' ? ++it : it;
+
+    uint32_t cp;
+    it = _me::decode_and_next(_it, cp);
+    detail::_grapheme_breaker breaker(detail::_grapheme_props(cp));
+    while (it != _end)
+    {
+        IT next = _me::decode_and_next(it, cp);
+        if (breaker.next(detail::_grapheme_props(cp)))
+            break;
+        it = next;
+    }
+    return it;
+}
+
+template <class IT>
+IT previous_grapheme(IT _it, IT _begin)
+{
+    IT it = _me::previous(_it);
+    if (it == _begin)
+        return it;
+    // ascii has no properties that join it with what comes before, other than CR LF (and
+    // Prepend, which is never ascii).
+    uint8_t last = static_cast<uint8_t>(*it);
+    IT before = it;
+    --before;
+    if (last < 0x80 && static_cast<uint8_t>(*before) < 0x80)
+        return last == '\n' && *before == '\r' ? before : it;
+
+    uint8_t next = detail::_grapheme_props(_me::decode(it));
+    while (it != _begin)
+    {
+        IT prev_it = _me::previous(it);
+        uint8_t prev = detail::_grapheme_props(_me::decode(prev_it));
+        uint8_t prev_gcb = prev & detail::_gcb_mask;
+        uint8_t next_gcb = next & detail::_gcb_mask;
+
+        // the rules that depend on more than the two codepoints look further back.
+        bool zwj_sequence = false;
+        if (prev_gcb == detail::_gcb_zwj && (next & detail::_gcb_pictographic))
+        {
+            IT back = prev_it;
+            uint8_t props = detail::_gcb_extend;
+            while (back != _begin && (props & detail::_gcb_mask) == detail::_gcb_extend &&
+                   !(props & detail::_gcb_pictographic))
+            {
+                back = _me::previous(back);
+                props = detail::_grapheme_props(_me::decode(back));
+            }
+            zwj_sequence = (props & detail::_gcb_pictographic) != 0;
+        }
+        size_t regional_indicators = 0;
+        if (prev_gcb == detail::_gcb_regional_indicator &&
+            next_gcb == detail::_gcb_regional_indicator)
+        {
+            IT back = prev_it;
+            for (regional_indicators = 1; back != _begin; ++regional_indicators)
+            {
+                back = _me::previous(back);
+                if ((detail::_grapheme_props(_me::decode(back)) & detail::_gcb_mask) !=
+                    detail::_gcb_regional_indicator)
+                    break;
+            }
+        }
+
+        if (detail::_is_grapheme_break(prev, next, zwj_sequence, regional_indicators % 2 == 1))
+            return it;
+        it = prev_it;
+        next = prev;
+    }
+    return it;
+}
+
+template <class IT>
+size_t count_graphemes(IT _begin, IT _end)
+{
+    return detail::_count_graphemes_impl(
+        _begin, _end, detail::_is_contiguous_byte_iter<IT>());
+}
+
+} // namespace utf8er
+
+#endif // UTF8ER_UTF8ER_UNICODE_HPP
@@ -0,0 +1,3464 @@
+// generated by tools/generate_unicode_data.py (unicode 14.0.0), do not edit.
+// license: public domain, see utf8er/utf8er.hpp.
+
+#ifndef UTF8ER_UTF8ER_UNICODE_DATA_HPP
+#define UTF8ER_UTF8ER_UNICODE_DATA_HPP
+
+#include <cstddef>
+#include <cstdint>
+
+namespace utf8er
+{
+namespace detail
+{
+
+// the tables as static members of a template, so that they exist once across translation units.
+template <class T = void>
+struct _unicode_data
+{
+    // no codepoint at or above limit has any of the properties below.
+    static constexpr std::uint32_t limit = 0x30000;
+    // the two stage tables are made of blocks of 1 << shift codepoints.
+    static constexpr std::uint32_t shift = 6;
+    // case mappings at or above this bit are made of more than one codepoint.
+    static constexpr std::int32_t case_expansion = 0x1000000;
+
+    static constexpr std::size_t canonical_count = 2061;
+    static constexpr std::size_t compat_count = 3750;
+    static constexpr std::size_t composite_count = 941;
+
+    static const std::uint8_t normalization_stage1[];
+    static const std::uint16_t normalization_stage2[];
+    static const std::uint32_t canonical_decompositions[];
+    static const std::uint32_t canonical_pool[];
+    static const std::uint32_t compat_decompositions[];
+    static const std::uint32_t compat_pool[];
+    static const std::uint32_t composites[];
+    static const std::uint8_t case_stage1[];
+    static const std::uint16_t case_stage2[];
+    static const std::int32_t case_mappings[];
+    static const std::uint32_t case_pool[];
+    static const std::uint8_t grapheme_stage1[];
+    static const std::uint8_t grapheme_stage2[];
+};
+
+template <class T>
+const std::uint8_t _unicode_data<T>::normalization_stage1[] = {
+    0, 0, 1, 2, 3, 4, 5, 6, 7, 0, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 0, 0, 18, 19, 20, 21, 0, 22,
+    23, 24, 0, 25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 32, 38, 39, 40, 36, 41, 36, 42,
+    43, 40, 0, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 0, 54, 55, 0, 56, 57, 58, 0, 0, 0, 0, 0, 59,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 60, 0, 0, 61, 0, 0, 62, 0, 63, 0, 0, 0, 64, 65, 66,
+    67, 68, 69, 70, 71, 72, 0, 0, 73, 74, 75, 76, 77, 78, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87,
+    88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 0, 0, 0, 0, 98, 99, 100, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 101, 102, 0, 103, 0, 0, 0, 0, 0, 104, 0, 105, 0, 106, 0, 107, 0,
+    0, 108, 109, 99, 99, 99, 110, 111, 112, 113, 114, 115, 99, 116, 0, 117, 118, 99, 99, 99, 99, 99,
+    99, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 119, 120, 121, 0, 122, 0, 123, 124, 0, 0, 125, 126, 127, 128, 129,
+    0, 0, 130, 131, 0, 132, 0, 133, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78,
+    78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 78, 134, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 135, 135, 135, 135,
+    136, 137, 135, 138, 139, 140, 141, 142, 99, 99, 99, 99, 143, 144, 145, 146, 147, 148, 99, 149,
+    150, 99, 151, 152, 0, 0, 0, 0, 0, 0, 0, 153, 0, 0, 0, 154, 0, 155, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 156, 0, 0, 0, 0, 0, 0, 0, 0, 0, 157, 0, 0, 158, 0, 0, 0, 0, 0, 0, 0, 0, 159,
+    0, 0, 0, 0, 0, 160, 0, 0, 161, 162, 0, 0, 163, 164, 0, 165, 128, 0, 166, 167, 0, 0, 168, 169,
+    170, 0, 0, 0, 171, 172, 173, 0, 0, 174, 175, 176, 0, 177, 0, 178, 0, 0, 0, 179, 0, 0, 0, 180,
+    181, 0, 182, 183, 184, 185, 0, 0, 0, 0, 0, 176, 0, 0, 0, 0, 186, 187, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 188, 189, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    190, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 191, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 192, 193, 194, 0, 195, 0, 0, 0, 0, 0, 0, 99, 196, 197, 198, 199, 200,
+    99, 99, 99, 99, 201, 99, 99, 99, 99, 202, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 203, 0, 0, 0, 189, 0, 0, 0, 0, 0, 204, 205, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 206, 0, 207, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 208, 209, 210, 0, 0, 0, 0, 0, 0, 0, 0, 0, 211, 212, 213, 0, 214,
+    215, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 216, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 135, 135, 135, 135,
+    135, 135, 135, 135, 217, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+template <class T>
+const std::uint16_t _unicode_data<T>::normalization_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10240, 0, 0, 0, 0, 0, 0, 0, 10240, 0, 10240, 0, 0, 0, 0, 10240, 0, 0, 10240, 10240, 10240,
+    10240, 0, 0, 10240, 10240, 10240, 0, 10240, 10240, 10240, 0, 4096, 4096, 4096, 4096, 4096, 4096,
+    0, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 0, 4096, 4096, 4096, 4096, 4096, 4096,
+    0, 0, 4096, 4096, 4096, 4096, 4096, 0, 0, 4096, 4096, 4096, 4096, 4096, 4096, 0, 4096, 4096,
+    4096, 4096, 4096, 4096, 4096, 4096, 4096, 0, 4096, 4096, 4096, 4096, 4096, 4096, 0, 0, 4096,
+    4096, 4096, 4096, 4096, 0, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+    4096, 4096, 4096, 4096, 4096, 4096, 0, 0, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+    4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 0, 0, 4096, 4096, 4096, 4096,
+    4096, 4096, 4096, 4096, 4096, 0, 10240, 10240, 4096, 4096, 4096, 4096, 0, 4096, 4096, 4096,
+    4096, 4096, 4096, 10240, 10240, 0, 0, 4096, 4096, 4096, 4096, 4096, 4096, 10240, 0, 0, 4096,
+    4096, 4096, 4096, 4096, 4096, 0, 0, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+    4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 0, 0, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+    4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+    10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4096, 4096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 4096, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+    0, 4096, 4096, 4096, 4096, 4096, 4096, 0, 0, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+    4096, 4096, 4096, 10240, 10240, 10240, 4096, 4096, 0, 0, 4096, 4096, 4096, 4096, 4096, 4096,
+    4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+    4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 0, 0, 4096,
+    4096, 0, 0, 0, 0, 0, 0, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+    4096, 4096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 10240, 10240, 10240, 10240,
+    10240, 0, 0, 10240, 10240, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1510, 1510, 1510, 1510, 1510, 230, 1510, 1510, 1510, 1510,
+    1510, 1510, 1510, 230, 230, 1510, 230, 1510, 230, 1510, 1510, 232, 220, 220, 220, 220, 232,
+    1496, 220, 220, 220, 220, 220, 202, 202, 1500, 1500, 1500, 1500, 1482, 1482, 220, 220, 220, 220,
+    1500, 1500, 220, 1500, 1500, 220, 220, 1, 1, 1, 1, 1281, 220, 220, 220, 220, 230, 230, 230,
+    6886, 6886, 1510, 6886, 6886, 1520, 230, 220, 220, 220, 230, 230, 230, 220, 220, 0, 230, 230,
+    230, 220, 220, 220, 220, 230, 232, 220, 220, 230, 233, 234, 234, 233, 234, 234, 233, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0, 0, 0, 6656, 0, 0, 0, 0, 0, 10240,
+    0, 0, 0, 6656, 0, 0, 0, 0, 0, 10240, 14336, 4096, 6656, 4096, 4096, 4096, 0, 4096, 0, 4096,
+    4096, 4096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4096,
+    4096, 4096, 4096, 4096, 4096, 4096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 4096, 4096, 4096, 4096, 4096, 0, 10240, 10240, 10240, 14336, 14336, 10240, 10240,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 10240, 10240,
+    0, 10240, 10240, 0, 0, 0, 10240, 0, 0, 0, 0, 0, 0, 4096, 4096, 0, 4096, 0, 0, 0, 4096, 0, 0, 0,
+    0, 4096, 4096, 4096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 4096, 0, 4096, 0, 0, 0, 4096, 0, 0, 0, 0, 4096, 4096, 4096,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 4096, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4096, 4096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 4096, 4096, 4096,
+    0, 0, 4096, 4096, 0, 0, 4096, 4096, 4096, 4096, 4096, 4096, 0, 0, 4096, 4096, 4096, 4096, 4096,
+    4096, 0, 0, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 0, 0, 4096,
+    4096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 230, 230,
+    230, 230, 220, 230, 230, 230, 222, 220, 230, 230, 230, 230, 230, 230, 220, 220, 220, 220, 220,
+    220, 230, 230, 220, 230, 230, 222, 228, 230, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 19, 20, 21,
+    22, 0, 23, 0, 24, 25, 0, 230, 220, 0, 18, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230,
+    230, 230, 30, 31, 32, 0, 0, 0, 0, 0, 0, 0, 4096, 4096, 4096, 4096, 4096, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 27, 28, 29,
+    30, 31, 32, 33, 34, 1510, 1510, 1500, 220, 230, 230, 230, 230, 230, 220, 230, 230, 220, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 35, 0, 0, 0, 0, 10240, 10240, 10240, 10240, 0, 0, 0, 0,
+    0, 0, 0, 4096, 0, 4096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 0, 0, 230, 230,
+    230, 230, 230, 230, 230, 0, 0, 230, 230, 230, 230, 220, 230, 0, 0, 230, 230, 0, 220, 230, 230,
+    220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 36, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 230, 220, 230, 230, 220, 230, 230, 220, 220, 220, 230, 220, 220, 230, 220, 230, 230,
+    230, 220, 230, 220, 230, 220, 230, 220, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 220, 230,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 230, 230, 230, 230, 0, 230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 230, 230, 230,
+    0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 220, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 220, 220, 220, 230, 230,
+    230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 220, 220, 220, 220, 220, 230,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 220, 230, 230, 220, 230,
+    230, 220, 230, 230, 230, 220, 220, 220, 27, 28, 29, 230, 230, 230, 220, 230, 230, 220, 220, 230,
+    230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 0, 0, 0, 0, 0, 0, 0, 4096, 0, 0, 4096, 0,
+    0, 0, 0, 0, 0, 0, 1287, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 230, 220,
+    230, 230, 0, 0, 0, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 1280, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4096, 4096, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1280, 0, 0, 0, 0, 6656, 6656, 0, 6656, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6656, 0, 0, 6656, 0, 0, 0, 0, 0, 7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6656, 6656, 6656, 0,
+    0, 6656, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 0, 0, 4096, 4096, 9, 0, 0, 0, 0, 0, 0, 0, 0, 1280,
+    1280, 0, 0, 0, 0, 6656, 6656, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1280, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 4096, 4096, 9, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1280, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 0, 0, 0, 0,
+    9, 0, 0, 0, 0, 0, 0, 0, 84, 1371, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 0, 1280, 0, 0, 0, 0, 4096,
+    4096, 0, 4096, 4096, 0, 9, 0, 0, 0, 0, 0, 0, 0, 1280, 1280, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 1280, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1289, 0, 0, 0, 0, 1280, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 0, 4096,
+    4096, 4096, 1280, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 0,
+    103, 103, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 107, 107, 107, 107, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10240, 0, 0, 0, 0, 118, 118, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 122, 122, 122, 122, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 220, 0, 216, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6656, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 6656, 0, 0, 0, 0, 6656, 0, 0, 0, 0, 6656, 0, 0, 0, 0, 6656, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 6656, 0, 0, 0, 0, 0, 0, 0, 129, 130, 6656, 132, 6656, 6656, 10240, 6656,
+    10240, 130, 130, 130, 130, 0, 0, 130, 6656, 230, 230, 9, 0, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 6656, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6656, 0, 0, 0, 0, 6656, 0, 0, 0, 0, 6656, 0, 0, 0, 0,
+    6656, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6656, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 0,
+    0, 0, 0, 0, 0, 0, 1280, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1280, 1280,
+    1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+    1280, 1280, 1280, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1280, 1280, 1280, 1280,
+    1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280, 1280,
+    1280, 1280, 1280, 1280, 1280, 1280, 1280, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 228, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 222, 230, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 230, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0, 220, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 220, 220, 220, 220, 220, 220, 230, 230, 220, 0,
+    220, 220, 230, 230, 220, 220, 230, 230, 230, 230, 230, 220, 230, 230, 230, 230, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 0, 4096, 0, 4096, 0, 4096, 0, 4096,
+    0, 0, 0, 4096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 7, 1280, 0, 0, 0, 0, 0, 4096, 0, 4096, 0, 0, 4096, 4096, 0, 4096, 9, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 230, 220, 230, 230, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 0, 1, 220, 220, 220, 220, 220, 230,
+    230, 220, 220, 220, 220, 230, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 220, 0, 0, 0, 0, 0, 0, 230, 0,
+    0, 0, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 10240, 10240, 0,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 230, 230, 220, 230, 230,
+    230, 230, 230, 230, 230, 220, 230, 230, 234, 214, 220, 202, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 232, 228, 228, 220, 218, 230, 233, 220,
+    230, 220, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+    4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+    4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+    4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+    4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+    4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 10240, 14336, 0, 0, 0,
+    0, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+    4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+    4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+    4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+    4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+    4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 0, 0, 0, 0, 0, 0, 4096, 4096,
+    4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+    4096, 4096, 4096, 4096, 0, 0, 4096, 4096, 4096, 4096, 4096, 4096, 0, 0, 4096, 4096, 4096, 4096,
+    4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+    4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+    4096, 4096, 0, 0, 4096, 4096, 4096, 4096, 4096, 4096, 0, 0, 4096, 4096, 4096, 4096, 4096, 4096,
+    4096, 4096, 0, 4096, 0, 4096, 0, 4096, 0, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+    4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 6656, 4096, 6656, 4096, 6656, 4096, 6656,
+    4096, 6656, 4096, 6656, 4096, 6656, 0, 0, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+    4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+    4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+    4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 0, 4096, 4096, 4096,
+    4096, 4096, 6656, 4096, 10240, 6656, 10240, 10240, 14336, 4096, 4096, 4096, 0, 4096, 4096, 4096,
+    6656, 4096, 6656, 4096, 14336, 14336, 14336, 4096, 4096, 4096, 6656, 0, 0, 4096, 4096, 4096,
+    4096, 4096, 6656, 0, 14336, 14336, 14336, 4096, 4096, 4096, 6656, 4096, 4096, 4096, 4096, 4096,
+    4096, 4096, 6656, 4096, 14336, 14848, 6656, 0, 0, 4096, 4096, 4096, 0, 4096, 4096, 4096, 6656,
+    4096, 6656, 4096, 14848, 10240, 0, 14848, 14848, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 10240, 10240, 0, 10240,
+    10240, 0, 0, 0, 0, 10240, 0, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 10240, 10240, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 10240, 10240, 0, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    230, 230, 1, 1, 230, 230, 230, 230, 1, 1, 1, 230, 230, 0, 0, 0, 0, 230, 0, 0, 0, 1, 1, 230, 220,
+    230, 1, 1, 220, 220, 220, 220, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 10240,
+    10240, 10240, 0, 10240, 10240, 10240, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 0, 10240, 10240, 0, 0, 10240, 10240, 10240, 10240, 10240, 0, 0, 10240,
+    10240, 10240, 0, 10240, 0, 6656, 0, 10240, 0, 6656, 6656, 10240, 10240, 0, 10240, 10240, 10240,
+    0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 10240, 10240, 10240, 10240, 10240, 10240,
+    0, 0, 0, 0, 10240, 10240, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4096, 4096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4096,
+    4096, 4096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 0, 0, 0, 0, 4096,
+    0, 0, 4096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 0, 4096,
+    0, 0, 0, 0, 0, 10240, 10240, 0, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4096, 0, 0, 4096, 0, 0, 4096, 0, 4096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4096, 0, 4096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 4096, 4096, 4096, 4096, 0, 0, 4096,
+    4096, 0, 0, 4096, 4096, 0, 0, 0, 0, 0, 0, 4096, 4096, 0, 0, 4096, 4096, 0, 0, 4096, 4096, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4096, 4096, 4096, 4096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 4096, 4096, 4096,
+    0, 0, 0, 0, 0, 0, 4096, 4096, 4096, 4096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 6656, 6656, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6656, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 218, 228, 232,
+    222, 224, 224, 0, 0, 0, 0, 0, 0, 10240, 0, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4096, 0, 4096, 0, 4096, 0, 4096, 0, 4096, 0, 4096, 0, 4096, 0, 4096, 0, 4096,
+    0, 4096, 0, 4096, 0, 4096, 0, 0, 4096, 0, 4096, 0, 4096, 0, 0, 0, 0, 0, 0, 4096, 4096, 0, 4096,
+    4096, 0, 4096, 4096, 0, 4096, 4096, 0, 4096, 4096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4096, 0, 0, 0, 0, 1288, 1288, 10240, 10240, 0, 4096, 10240, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4096, 0, 4096, 0, 4096, 0, 4096, 0, 4096, 0, 4096, 0, 4096, 0, 4096, 0,
+    4096, 0, 4096, 0, 4096, 0, 4096, 0, 0, 4096, 0, 4096, 0, 4096, 0, 0, 0, 0, 0, 0, 4096, 4096, 0,
+    4096, 4096, 0, 4096, 4096, 0, 4096, 4096, 0, 4096, 4096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 0, 0, 4096, 4096, 4096, 4096, 0, 0, 0, 4096, 10240, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 0, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0, 0, 0, 0, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 10240, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 10240, 10240, 10240, 0, 0, 0, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230,
+    230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0, 230, 230,
+    220, 0, 0, 230, 230, 0, 0, 0, 0, 0, 230, 230, 0, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 4096, 4096, 4096,
+    4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+    4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096, 4096,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6656, 6656,
+    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 0, 0, 6656, 0, 6656, 0,
+    0, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 0, 6656, 0, 6656, 0, 0, 6656,
+    6656, 0, 0, 0, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+    6656, 6656, 6656, 6656, 6656, 6656, 6656, 0, 0, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+    6656, 6656, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 10240, 10240, 10240, 10240, 10240, 0, 0, 0, 0, 0, 6656, 26, 6656, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 6656, 6656, 6656, 6656, 6656,
+    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 0, 6656, 6656, 6656, 6656, 6656, 0, 6656, 0,
+    6656, 6656, 0, 6656, 6656, 0, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 0, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0,
+    230, 230, 230, 230, 230, 230, 230, 220, 220, 220, 220, 220, 220, 220, 230, 230, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 10240, 10240,
+    10240, 10240, 0, 0, 0, 0, 10240, 10240, 10240, 0, 10240, 0, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 0, 0, 0, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 0, 10240,
+    10240, 10240, 10240, 10240, 10240, 0, 0, 10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 10240,
+    10240, 10240, 10240, 10240, 10240, 0, 0, 10240, 10240, 10240, 0, 0, 0, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 10240, 10240, 10240, 10240, 10240, 0,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 0, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 1, 220, 0,
+    0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 220, 220, 230, 230, 230, 220, 230, 220, 220, 220,
+    220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 220, 230, 220, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 0, 4096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4096, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 1287, 0, 0, 0, 0, 0, 230, 230, 230, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1280, 0, 0, 0, 0, 0, 0, 4096, 4096, 0, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 7, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 1280, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 4096, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1280, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 0, 0, 0, 230, 230, 230, 230, 230, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1280, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1280, 4096, 4096, 1280, 4096, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1280, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4096, 4096, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1280, 0, 0, 0, 0, 0, 0, 0, 4096, 0, 0, 0, 0, 9, 9, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 9, 9, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 230, 230, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 6, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6656, 6656, 6656,
+    6656, 6656, 6656, 6656, 216, 216, 1, 1, 1, 0, 0, 0, 226, 216, 216, 216, 216, 216, 0, 0, 0, 0, 0,
+    0, 0, 0, 220, 220, 220, 220, 220, 220, 220, 220, 0, 0, 230, 230, 230, 230, 230, 220, 220, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230,
+    230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6656, 6656, 6656, 6656, 6656, 6656, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230,
+    230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0,
+    10240, 10240, 0, 0, 10240, 0, 0, 10240, 10240, 0, 0, 10240, 10240, 10240, 10240, 0, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 10240, 0, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 0, 10240, 10240, 10240, 10240, 0, 0, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 0, 10240, 10240, 10240, 10240, 0, 10240, 10240, 10240, 10240, 10240, 0, 10240, 0,
+    0, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 0, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 230, 230, 230, 230, 230, 230,
+    230, 0, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 230, 0,
+    0, 230, 230, 230, 230, 230, 230, 230, 0, 230, 230, 0, 230, 230, 230, 230, 230, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230,
+    230, 230, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 220, 220, 220, 220, 220, 220, 220, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 230, 230,
+    230, 230, 230, 230, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240,
+    10240, 10240, 10240, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 0, 10240, 10240, 0, 10240, 0, 0, 10240, 0, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 10240, 10240, 10240, 10240, 0, 10240, 0,
+    10240, 0, 0, 0, 0, 0, 0, 10240, 0, 0, 0, 0, 10240, 0, 10240, 0, 10240, 0, 10240, 10240, 10240,
+    0, 10240, 10240, 0, 10240, 0, 0, 10240, 0, 10240, 0, 10240, 0, 10240, 0, 10240, 0, 10240, 10240,
+    0, 10240, 0, 0, 10240, 10240, 10240, 10240, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    0, 10240, 10240, 10240, 10240, 0, 10240, 10240, 10240, 10240, 0, 10240, 0, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 0, 0, 0,
+    10240, 10240, 10240, 0, 10240, 10240, 10240, 10240, 10240, 0, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 0, 0,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 0, 0, 0,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 10240, 10240, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 10240, 10240, 0, 0, 0, 0, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 10240, 10240, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10240, 10240, 10240, 10240, 10240, 10240,
+    10240, 10240, 10240, 10240, 0, 0, 0, 0, 0, 0, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+    6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656, 6656,
+    6656, 6656, 6656, 6656, 6656, 6656, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+template <class T>
+const std::uint32_t _unicode_data<T>::canonical_decompositions[] = {
+    3145728, 3162114, 3178500, 3194886, 3211272, 3227658, 3260428, 3276814, 3293200, 3309586,
+    3325972, 3342358, 3358744, 3375130, 3391516, 3424286, 3440672, 3457058, 3473444, 3489830,
+    3506216, 3555370, 3571756, 3588142, 3604528, 3620914, 3670068, 3686454, 3702840, 3719226,
+    3735612, 3751998, 3784768, 3801154, 3817540, 3833926, 3850312, 3866698, 3883084, 3899470,
+    3915856, 3948626, 3965012, 3981398, 3997784, 4014170, 4030556, 4079710, 4096096, 4112482,
+    4128868, 4145254, 4178024, 4194410, 4210796, 4227182, 4243568, 4259954, 4276340, 4292726,
+    4309112, 4325498, 4341884, 4358270, 4374656, 4391042, 4407428, 4423814, 4440200, 4489354,
+    4505740, 4522126, 4538512, 4554898, 4571284, 4587670, 4604056, 4620442, 4636828, 4653214,
+    4669600, 4685986, 4702372, 4718758, 4735144, 4751530, 4767916, 4784302, 4800688, 4849842,
+    4866228, 4882614, 4899000, 4915386, 4931772, 4948158, 4964544, 4980930, 5046468, 5062854,
+    5079240, 5095626, 5128396, 5144782, 5161168, 5177554, 5193940, 5210326, 5292248, 5308634,
+    5325020, 5341406, 5357792, 5374178, 5439716, 5456102, 5472488, 5488874, 5505260, 5521646,
+    5570800, 5587186, 5603572, 5619958, 5636344, 5652730, 5669116, 5685502, 5701888, 5718274,
+    5734660, 5751046, 5767432, 5783818, 5800204, 5816590, 5832976, 5849362, 5898516, 5914902,
+    5931288, 5947674, 5964060, 5980446, 5996832, 6013218, 6029604, 6045990, 6062376, 6078762,
+    6095148, 6111534, 6127920, 6144306, 6160692, 6177078, 6193464, 6209850, 6226236, 6242622,
+    6259008, 6816066, 6832452, 7061830, 7078216, 7553354, 7569740, 7586126, 7602512, 7618898,
+    7635284, 7651670, 7668056, 7684442, 7700829, 7717216, 7733603, 7749990, 7766377, 7782764,
+    7799151, 7831922, 7848309, 7864696, 7881083, 7897470, 7913856, 7963010, 7979396, 7995782,
+    8012168, 8028554, 8044940, 8061326, 8077713, 8094100, 8110486, 8126872, 8192410, 8208796,
+    8257950, 8274336, 8290722, 8307109, 8323496, 8339882, 8356268, 8372654, 8389040, 8405426,
+    8421812, 8438198, 8454584, 8470970, 8487356, 8503742, 8520128, 8536514, 8552900, 8569286,
+    8585672, 8602058, 8618444, 8634830, 8651216, 8667602, 8683988, 8700374, 8716760, 8733146,
+    8749532, 8765918, 8782304, 8798690, 8815076, 8831462, 8880616, 8897002, 9011692, 9028078,
+    9044464, 9060850, 9077236, 9093623, 9110010, 9126397, 9142784, 9159170, 9175556, 9191943,
+    9208330, 9224716, 13632014, 13648399, 13681168, 13697553, 14483987, 14647828, 14762517,
+    14778903, 14795289, 14811674, 14828060, 14844446, 14877216, 14909986, 14926372, 14942758,
+    15368745, 15385131, 15401517, 15417903, 15434289, 15450675, 15467061, 15893048, 15909434,
+    15925820, 15942206, 15958592, 16040514, 16056900, 16777798, 16794184, 16826954, 16892492,
+    16974414, 16990800, 17007186, 17187412, 17711702, 18088536, 18104922, 18137692, 18203230,
+    18285152, 18301538, 18317924, 18711142, 18727528, 19939946, 19956332, 20185710, 20202096,
+    20218482, 20234868, 20284022, 20300408, 20349562, 20365948, 20382334, 20398720, 20415106,
+    20431492, 20480646, 20497032, 20513418, 20529804, 20546190, 20562576, 20611730, 20628116,
+    20644502, 20660888, 20677274, 20693660, 20710046, 20726432, 20742818, 20759204, 20775590,
+    20791976, 20841130, 20857516, 25723566, 25739952, 25756338, 25772724, 25789110, 28312248,
+    28345018, 28623548, 38421182, 38552256, 38601410, 39191236, 39207622, 39224008, 39240394,
+    39256780, 39273166, 39289552, 39305938, 41075412, 41091798, 41353944, 41370330, 41403100,
+    42779358, 42828512, 43401954, 43418340, 43434726, 43483880, 47317738, 47366892, 47383278,
+    47645424, 47661810, 48562932, 49447670, 49464056, 49480442, 51512060, 53478142, 53592832,
+    53609218, 53641988, 53658374, 55739145, 55755531, 55771917, 58098447, 58131217, 58147603,
+    58163990, 64013080, 64176922, 64258844, 64340766, 64422688, 64635682, 64799524, 64832294,
+    64848680, 64881450, 65028908, 65323822, 65487664, 65569586, 65651508, 65733430, 65946424,
+    67732282, 113345340, 113378110, 113410880, 113443650, 113476420, 113541958, 114213704,
+    114246474, 114295628, 114312014, 114344784, 125829970, 125846356, 125862742, 125879128,
+    125895514, 125911900, 125928286, 125944672, 125961058, 125977445, 125993832, 126010218,
+    126026604, 126042990, 126059376, 126075762, 126092148, 126108534, 126124920, 126141306,
+    126157692, 126174079, 126190466, 126206853, 126223240, 126239626, 126256012, 126272398,
+    126288784, 126305171, 126321558, 126337944, 126354330, 126370716, 126387102, 126403488,
+    126419874, 126436260, 126452646, 126469032, 126485418, 126501804, 126518190, 126534576,
+    126550962, 126567348, 126583734, 126600121, 126616508, 126632894, 126649280, 126665666,
+    126682052, 126698438, 126714824, 126731210, 126747596, 126763983, 126780370, 126796756,
+    126813142, 126829528, 126845914, 126862300, 126878686, 126895072, 126911458, 126927844,
+    126944230, 126960616, 126977002, 126993388, 127009774, 127026160, 127042546, 127058932,
+    127075318, 127091705, 127108092, 127124479, 127140866, 127157253, 127173640, 127190027,
+    127206414, 127222800, 127239186, 127255572, 127271958, 127288344, 127304730, 127321116,
+    127337502, 127353889, 127370276, 127386662, 127403048, 127419434, 127435820, 127452206,
+    127468592, 127484979, 127501366, 127517753, 127534140, 127550527, 127566914, 127583300,
+    127599686, 127616072, 127632458, 127648844, 127665230, 127681616, 127698002, 127714388,
+    127730774, 127747160, 127763546, 127779932, 127796318, 127812705, 127829092, 127845479,
+    127861866, 127878252, 127894638, 127911024, 127927410, 127943796, 127960182, 127976568,
+    127992954, 128009340, 128025726, 128042112, 128058498, 128074884, 128091270, 128107656,
+    128124042, 128140428, 128156814, 128173200, 128189586, 128205972, 128222358, 128238744,
+    128255130, 128271516, 128287902, 128304288, 128320674, 128337060, 128369830, 128451752,
+    128468138, 128484524, 128500910, 128517296, 128533683, 128550070, 128566457, 128582844,
+    128599231, 128615618, 128632005, 128648392, 128664779, 128681166, 128697553, 128713940,
+    128730327, 128746714, 128763101, 128779488, 128795875, 128812262, 128828649, 128845036,
+    128861422, 128877808, 128894194, 128910580, 128926966, 128943352, 128959739, 128976126,
+    128992513, 129008900, 129025287, 129041674, 129058061, 129074448, 129090835, 129107222,
+    129123608, 129139994, 129156380, 129172766, 129189152, 129205538, 129221924, 129238310,
+    129254697, 129271084, 129287471, 129303858, 129320245, 129336632, 129353019, 129369406,
+    129385793, 129402180, 129418567, 129434954, 129451341, 129467728, 129484115, 129500502,
+    129516889, 129533276, 129549663, 129566050, 129582436, 129598822, 129615208, 129631594,
+    129647981, 129664368, 129680755, 129697142, 129713529, 129729916, 129746303, 129762690,
+    129779077, 129795464, 129811850, 129828236, 129844622, 129861008, 129877394, 129893780,
+    129910166, 130024856, 130041242, 130057628, 130074015, 130090402, 130106789, 130123176,
+    130139563, 130155950, 130172336, 130188722, 130205109, 130221496, 130237883, 130254270,
+    130270657, 130287044, 130303430, 130319816, 130336203, 130352590, 130368977, 130418132,
+    130434518, 130450904, 130467291, 130483678, 130500065, 130549220, 130565606, 130581992,
+    130598379, 130614766, 130631153, 130647540, 130663927, 130680314, 130696700, 130713086,
+    130729473, 130745860, 130762247, 130778634, 130795021, 130811408, 130827794, 130844180,
+    130860567, 130876954, 130893341, 130909728, 130926115, 130942502, 130958888, 130975274,
+    130991661, 131008048, 131024435, 131040822, 131057209, 131073596, 131089982, 131106368,
+    131122755, 131139142, 131155529, 131204684, 131221070, 131237456, 131253843, 131270230,
+    131286617, 131335772, 131352158, 131368544, 131384931, 131401318, 131417705, 131434092,
+    131450479, 131483250, 131516020, 131548791, 131581562, 131597949, 131614335, 131630721,
+    131647108, 131663495, 131679882, 131696269, 131712656, 131729043, 131745429, 131761815,
+    131778202, 131794589, 131810976, 131827363, 131843750, 131860137, 131876523, 131892909,
+    131909295, 131925681, 131942067, 131958453, 131974839, 131991225, 132007611, 132023997,
+    132040383, 132056769, 132073155, 132122309, 132138696, 132155083, 132171471, 132187859,
+    132204247, 132220635, 132237023, 132253411, 132269798, 132286185, 132302573, 132318961,
+    132335349, 132351737, 132368125, 132384513, 132400900, 132417287, 132433675, 132450063,
+    132466451, 132482839, 132499227, 132515615, 132532002, 132548389, 132564777, 132581165,
+    132597553, 132613941, 132630329, 132646717, 132663104, 132679491, 132695879, 132712267,
+    132728655, 132745043, 132761431, 132777819, 132794206, 132810593, 132826981, 132843369,
+    132859757, 132876145, 132892533, 132908921, 132925307, 132941693, 132958080, 132974466,
+    133007237, 133023623, 133040010, 133056396, 133072782, 133089168, 133105554, 133138324,
+    133187477, 133203863, 133220250, 133236636, 133269407, 133285793, 133302180, 133318566,
+    133334952, 133351338, 133367724, 133384110, 133400496, 133416882, 133433268, 133449654,
+    133466040, 133482427, 133531582, 133547968, 133564355, 133580741, 133597127, 133613513,
+    133646283, 133662669, 133679055, 133695441, 133711827, 133728213, 133744600, 133760987,
+    133777373, 133793759, 133810145, 133826532, 133842918, 133859304, 133875690, 133892076,
+    133908462, 133924848, 133941234, 133990387, 134006774, 134023160, 134055931, 134072317,
+    134088704, 134105090, 134121476, 134137862, 134154248, 134170634, 134219787, 134236172,
+    139036685, 139102222, 139118607, 140937233, 140953619, 141264917, 141772823, 141789209,
+    141805595, 142673949, 142755871, 142805025, 143198243, 143231013, 143673383, 143722537,
+    143771691, 143804461, 144181295, 144214065, 144394291, 144410677, 144427063, 144443449,
+    144459835, 144508989, 144525375, 144574529, 144590915, 144705605, 144721991, 144771145,
+    144787531, 144836685, 144853071, 145426513, 145442899, 145459285, 145475671, 146278489,
+    146294875, 146311261, 146327647, 146442337, 146458723, 146475109, 146491495, 147474537,
+    147490922, 179767403, 202573933, 202606703, 202639473, 202672243, 202705013, 202737783,
+    202770553, 202803323, 202836093, 202868863, 202901633, 202934403, 202983557, 203016327,
+    203049097, 203163787, 203180173, 203212943, 203229329, 203262099, 203278485, 203311255,
+    203327641, 203360411, 203376797, 203753631, 203917473, 204146851, 204179621, 204212391,
+    204245161, 204277931, 204310701, 204343471, 204376241, 204409011, 204441781, 204474551,
+    204507321, 204556475, 204589245, 204622015, 204736705, 204753091, 204785861, 204802247,
+    204835017, 204851403, 204884173, 204900559, 204933329, 204949715, 205326549, 205375703,
+    205392089, 205408475, 205424861, 205490399, 1044383969, 1044400354, 1044416739, 1044433124,
+    1044449509, 1044465894, 1044482279, 1044498664, 1044515049, 1044531434, 1044547819, 1044564204,
+    1044580589, 1044596974, 1044613359, 1044629744, 1044646129, 1044662514, 1044678899, 1044695284,
+    1044711669, 1044728054, 1044744439, 1044760824, 1044777209, 1044793594, 1044809979, 1044826364,
+    1044842749, 1044859134, 1044875519, 1044891904, 1044908289, 1044924674, 1044941059, 1044957444,
+    1044973829, 1044990214, 1045006599, 1045022984, 1045039369, 1045055754, 1045072139, 1045088524,
+    1045104909, 1045121294, 1045137679, 1045154064, 1045170449, 1045186834, 1045203219, 1045219604,
+    1045235989, 1045252374, 1045268759, 1045285144, 1045301529, 1045317914, 1045334299, 1045350684,
+    1045367069, 1045383454, 1045399839, 1045416224, 1045432609, 1045448994, 1045465379, 1045481764,
+    1045498149, 1045514534, 1045530919, 1045547304, 1045563689, 1045580074, 1045596459, 1045612844,
+    1045629229, 1045645614, 1045661999, 1045678384, 1045694769, 1045711154, 1045727539, 1045743924,
+    1045760309, 1045776694, 1045793079, 1045809464, 1045825849, 1045842234, 1045858619, 1045875004,
+    1045891389, 1045907774, 1045924159, 1045940544, 1045956929, 1045973314, 1045989699, 1046006084,
+    1046022469, 1046038854, 1046055239, 1046071624, 1046088009, 1046104394, 1046120779, 1046137164,
+    1046153549, 1046169934, 1046186319, 1046202704, 1046219089, 1046235474, 1046251859, 1046268244,
+    1046284629, 1046301014, 1046317399, 1046333784, 1046350169, 1046366554, 1046382939, 1046399324,
+    1046415709, 1046432094, 1046448479, 1046464864, 1046481249, 1046497634, 1046514019, 1046530404,
+    1046546789, 1046563174, 1046579559, 1046595944, 1046612329, 1046628714, 1046645099, 1046661484,
+    1046677869, 1046694254, 1046710639, 1046727024, 1046743409, 1046759794, 1046776179, 1046792564,
+    1046808949, 1046825334, 1046841719, 1046858104, 1046874489, 1046890874, 1046907259, 1046923644,
+    1046940029, 1046956414, 1046972799, 1046989184, 1047005569, 1047021954, 1047038339, 1047054724,
+    1047071109, 1047087494, 1047103879, 1047120264, 1047136649, 1047153034, 1047169419, 1047185804,
+    1047202189, 1047218574, 1047234959, 1047251344, 1047267729, 1047284114, 1047300499, 1047316884,
+    1047333269, 1047349654, 1047366039, 1047382424, 1047398809, 1047415194, 1047431579, 1047447964,
+    1047464349, 1047480734, 1047497119, 1047513504, 1047529889, 1047546274, 1047562659, 1047579044,
+    1047595429, 1047611814, 1047628199, 1047644584, 1047660969, 1047677354, 1047693739, 1047710124,
+    1047726509, 1047742894, 1047759279, 1047775664, 1047792049, 1047808434, 1047824819, 1047841204,
+    1047857589, 1047873974, 1047890359, 1047906744, 1047923129, 1047939514, 1047955899, 1047972284,
+    1047988669, 1048005054, 1048021439, 1048037824, 1048054209, 1048070594, 1048086979, 1048103364,
+    1048119749, 1048136134, 1048152519, 1048168904, 1048185289, 1048201674, 1048218059, 1048234444,
+    1048250829, 1048267214, 1048283599, 1048299984, 1048316369, 1048332754, 1048349139, 1048365524,
+    1048381909, 1048398294, 1048414679, 1048431064, 1048447449, 1048463834, 1048480219, 1048496604,
+    1048512989, 1048529374, 1048545759, 1048562144, 1048578529, 1048594914, 1048611299, 1048627684,
+    1048644069, 1048660454, 1048676839, 1048693224, 1048709609, 1048725994, 1048742379, 1048758764,
+    1048775149, 1048791534, 1048840687, 1048873456, 1048922609, 1048938994, 1048955379, 1048971764,
+    1048988149, 1049004534, 1049020919, 1049037304, 1049053689, 1049070074, 1049102843, 1049135612,
+    1049184765, 1049201150, 1049266687, 1049283072, 1049299457, 1049315842, 1049332227, 1049348612,
+    1049364997, 1049381382, 1049397767, 1049414152, 1049430537, 1049446922, 1049463307, 1049479692,
+    1049496077, 1049512462, 1049528847, 1049545232, 1049561617, 1049578002, 1049594387, 1049610772,
+    1049627157, 1049643542, 1049659927, 1049676312, 1049692697, 1049709082, 1049725467, 1049741852,
+    1049758237, 1049774622, 1049791007, 1049807392, 1049823777, 1049840162, 1049856547, 1049872932,
+    1049889317, 1049905702, 1049922087, 1049938472, 1049954857, 1049971242, 1049987627, 1050004012,
+    1050020397, 1050036782, 1050053167, 1050069552, 1050085937, 1050102322, 1050118707, 1050135092,
+    1050151477, 1050167862, 1050184247, 1050200632, 1050217017, 1050233402, 1050249787, 1050266172,
+    1050282557, 1050298942, 1050315327, 1050331712, 1050348097, 1050364482, 1050413635, 1050430020,
+    1050446405, 1050462790, 1050479175, 1050495560, 1050511945, 1050528330, 1050544715, 1050561100,
+    1050577485, 1050593870, 1050610255, 1050626640, 1050643025, 1050659410, 1050675795, 1050692180,
+    1050708565, 1050724950, 1050741335, 1050757720, 1050774105, 1050790490, 1050806875, 1050823260,
+    1050839645, 1050856030, 1050872415, 1050888800, 1050905185, 1050921570, 1050937955, 1050954340,
+    1050970725, 1050987110, 1051003495, 1051019880, 1051036265, 1051052650, 1051069035, 1051085420,
+    1051101805, 1051118190, 1051134575, 1051150960, 1051167345, 1051183730, 1051200115, 1051216500,
+    1051232885, 1051249270, 1051265655, 1051282040, 1051298425, 1051314810, 1051331195, 1051347580,
+    1051363965, 1051380350, 1051396735, 1051413120, 1051429505, 1051445890, 1051462275, 1051478660,
+    1051495045, 1051511430, 1051527815, 1051544200, 1051560585, 1051576970, 1051593355, 1051609740,
+    1051626125, 1051642510, 1051658895, 1051675280, 1051691665, 1051708050, 1051724435, 1051740820,
+    1051757205, 1051773590, 1051789975, 1051806360, 1051822745, 1051839130, 1051855515, 1051871900,
+    1051888285, 1051904670, 1051921055, 1051937440, 1051953825, 1051970210, 1051986595, 1052002980,
+    1052019365, 1052035750, 1052052135, 1052068520, 1052084905, 1052101290, 1052117675, 1052134060,
+    1053248173, 1053280943, 1053461169, 1053477555, 1053493941, 1053510328, 1053526715, 1053543101,
+    1053559487, 1053575873, 1053592259, 1053608645, 1053625031, 1053641417, 1053657803, 1053690573,
+    1053706959, 1053723345, 1053739731, 1053756117, 1053788887, 1053821657, 1053838043, 1053870813,
+    1053887199, 1053919969, 1053936355, 1053952741, 1053969127, 1053985513, 1054001899, 1054018285,
+    1054034671, 1054051057, 1143376627, 1143409397, 1143655159, 1145801465, 1145817851, 1154665213,
+    1154681599, 1160694529, 1160710915, 1160743685, 1164872455, 1164888841, 1179519755, 1951894285,
+    1951910671, 1951927057, 1951943444, 1951959831, 1951976218, 1951992605, 1953418016, 1953434402,
+    1953450788, 1953467175, 1953483562, 1953499949, 3187673904, 3187690289, 3187706674, 3187723059,
+    3187739444, 3187755829, 3187772214, 3187788599, 3187804984, 3187821369, 3187837754, 3187854139,
+    3187870524, 3187886909, 3187903294, 3187919679, 3187936064, 3187952449, 3187968834, 3187985219,
+    3188001604, 3188017989, 3188034374, 3188050759, 3188067144, 3188083529, 3188099914, 3188116299,
+    3188132684, 3188149069, 3188165454, 3188181839, 3188198224, 3188214609, 3188230994, 3188247379,
+    3188263764, 3188280149, 3188296534, 3188312919, 3188329304, 3188345689, 3188362074, 3188378459,
+    3188394844, 3188411229, 3188427614, 3188443999, 3188460384, 3188476769, 3188493154, 3188509539,
+    3188525924, 3188542309, 3188558694, 3188575079, 3188591464, 3188607849, 3188624234, 3188640619,
+    3188657004, 3188673389, 3188689774, 3188706159, 3188722544, 3188738929, 3188755314, 3188771699,
+    3188788084, 3188804469, 3188820854, 3188837239, 3188853624, 3188870009, 3188886394, 3188902779,
+    3188919164, 3188935549, 3188951934, 3188968319, 3188984704, 3189001089, 3189017474, 3189033859,
+    3189050244, 3189066629, 3189083014, 3189099399, 3189115784, 3189132169, 3189148554, 3189164939,
+    3189181324, 3189197709, 3189214094, 3189230479, 3189246864, 3189263249, 3189279634, 3189296019,
+    3189312404, 3189328789, 3189345174, 3189361559, 3189377944, 3189394329, 3189410714, 3189427099,
+    3189443484, 3189459869, 3189476254, 3189492639, 3189509024, 3189525409, 3189541794, 3189558179,
+    3189574564, 3189590949, 3189607334, 3189623719, 3189640104, 3189656489, 3189672874, 3189689259,
+    3189705644, 3189722029, 3189738414, 3189754799, 3189771184, 3189787569, 3189803954, 3189820339,
+    3189836724, 3189853109, 3189869494, 3189885879, 3189902264, 3189918649, 3189935034, 3189951419,
+    3189967804, 3189984189, 3190000574, 3190016959, 3190033344, 3190049729, 3190066114, 3190082499,
+    3190098884, 3190115269, 3190131654, 3190148039, 3190164424, 3190180809, 3190197194, 3190213579,
+    3190229964, 3190246349, 3190262734, 3190279119, 3190295504, 3190311889, 3190328274, 3190344659,
+    3190361044, 3190377429, 3190393814, 3190410199, 3190426584, 3190442969, 3190459354, 3190475739,
+    3190492124, 3190508509, 3190524894, 3190541279, 3190557664, 3190574049, 3190590434, 3190606819,
+    3190623204, 3190639589, 3190655974, 3190672359, 3190688744, 3190705129, 3190721514, 3190737899,
+    3190754284, 3190770669, 3190787054, 3190803439, 3190819824, 3190836209, 3190852594, 3190868979,
+    3190885364, 3190901749, 3190918134, 3190934519, 3190950904, 3190967289, 3190983674, 3191000059,
+    3191016444, 3191032829, 3191049214, 3191065599, 3191081984, 3191098369, 3191114754, 3191131139,
+    3191147524, 3191163909, 3191180294, 3191196679, 3191213064, 3191229449, 3191245834, 3191262219,
+    3191278604, 3191294989, 3191311374, 3191327759, 3191344144, 3191360529, 3191376914, 3191393299,
+    3191409684, 3191426069, 3191442454, 3191458839, 3191475224, 3191491609, 3191507994, 3191524379,
+    3191540764, 3191557149, 3191573534, 3191589919, 3191606304, 3191622689, 3191639074, 3191655459,
+    3191671844, 3191688229, 3191704614, 3191720999, 3191737384, 3191753769, 3191770154, 3191786539,
+    3191802924, 3191819309, 3191835694, 3191852079, 3191868464, 3191884849, 3191901234, 3191917619,
+    3191934004, 3191950389, 3191966774, 3191983159, 3191999544, 3192015929, 3192032314, 3192048699,
+    3192065084, 3192081469, 3192097854, 3192114239, 3192130624, 3192147009, 3192163394, 3192179779,
+    3192196164, 3192212549, 3192228934, 3192245319, 3192261704, 3192278089, 3192294474, 3192310859,
+    3192327244, 3192343629, 3192360014, 3192376399, 3192392784, 3192409169, 3192425554, 3192441939,
+    3192458324, 3192474709, 3192491094, 3192507479, 3192523864, 3192540249, 3192556634, 3192573019,
+    3192589404, 3192605789, 3192622174, 3192638559, 3192654944, 3192671329, 3192687714, 3192704099,
+    3192720484, 3192736869, 3192753254, 3192769639, 3192786024, 3192802409, 3192818794, 3192835179,
+    3192851564, 3192867949, 3192884334, 3192900719, 3192917104, 3192933489, 3192949874, 3192966259,
+    3192982644, 3192999029, 3193015414, 3193031799, 3193048184, 3193064569, 3193080954, 3193097339,
+    3193113724, 3193130109, 3193146494, 3193162879, 3193179264, 3193195649, 3193212034, 3193228419,
+    3193244804, 3193261189, 3193277574, 3193293959, 3193310344, 3193326729, 3193343114, 3193359499,
+    3193375884, 3193392269, 3193408654, 3193425039, 3193441424, 3193457809, 3193474194, 3193490579,
+    3193506964, 3193523349, 3193539734, 3193556119, 3193572504, 3193588889, 3193605274, 3193621659,
+    3193638044, 3193654429, 3193670814, 3193687199, 3193703584, 3193719969, 3193736354, 3193752739,
+    3193769124, 3193785509, 3193801894, 3193818279, 3193834664, 3193851049, 3193867434, 3193883819,
+    3193900204, 3193916589, 3193932974, 3193949359, 3193965744, 3193982129, 3193998514, 3194014899,
+    3194031284, 3194047669, 3194064054, 3194080439, 3194096824, 3194113209, 3194129594, 3194145979,
+    3194162364, 3194178749, 3194195134, 3194211519, 3194227904, 3194244289, 3194260674, 3194277059,
+    3194293444, 3194309829, 3194326214, 3194342599, 3194358984, 3194375369, 3194391754, 3194408139,
+    3194424524, 3194440909, 3194457294, 3194473679, 3194490064, 3194506449, 3194522834, 3194539219,
+    3194555604, 3194571989, 3194588374, 3194604759, 3194621144, 3194637529, 3194653914, 3194670299,
+    3194686684, 3194703069, 3194719454, 3194735839, 3194752224, 3194768609, 3194784994, 3194801379,
+    3194817764, 3194834149, 3194850534, 3194866919, 3194883304, 3194899689, 3194916074, 3194932459,
+    3194948844, 3194965229, 3194981614, 3194997999, 3195014384, 3195030769, 3195047154, 3195063539,
+    3195079924, 3195096309, 3195112694, 3195129079, 3195145464, 3195161849, 3195178234, 3195194619,
+    3195211004, 3195227389, 3195243774, 3195260159, 3195276544, 3195292929, 3195309314, 3195325699,
+    3195342084, 3195358469, 3195374854, 3195391239, 3195407624, 3195424009, 3195440394, 3195456779,
+    3195473164, 3195489549, 3195505934, 3195522319, 3195538704, 3195555089, 3195571474, 3195587859,
+    3195604244, 3195620629, 3195637014, 3195653399, 3195669784, 3195686169, 3195702554, 3195718939,
+    3195735324, 3195751709, 3195768094, 3195784479, 3195800864, 3195817249, 3195833634, 3195850019,
+    3195866404, 3195882789, 3195899174, 3195915559, 3195931944, 3195948329, 3195964714, 3195981099,
+    3195997484, 3196013869, 3196030254, 3196046639, 3196063024, 3196079409, 3196095794, 3196112179,
+    3196128564, 3196144949, 3196161334, 3196177719, 3196194104, 3196210489, 3196226874, 3196243259,
+    3196259644, 3196276029, 3196292414, 3196308799, 3196325184, 3196341569, 3196357954, 3196374339,
+    3196390724, 3196407109, 3196423494, 3196439879, 3196456264, 3196472649, 3196489034, 3196505419,
+    3196521804, 3196538189, 3221228878,
+};
+
+template <class T>
+const std::uint32_t _unicode_data<T>::canonical_pool[] = {
+    65, 768, 65, 769, 65, 770, 65, 771, 65, 776, 65, 778, 67, 807, 69, 768, 69, 769, 69, 770, 69,
+    776, 73, 768, 73, 769, 73, 770, 73, 776, 78, 771, 79, 768, 79, 769, 79, 770, 79, 771, 79, 776,
+    85, 768, 85, 769, 85, 770, 85, 776, 89, 769, 97, 768, 97, 769, 97, 770, 97, 771, 97, 776, 97,
+    778, 99, 807, 101, 768, 101, 769, 101, 770, 101, 776, 105, 768, 105, 769, 105, 770, 105, 776,
+    110, 771, 111, 768, 111, 769, 111, 770, 111, 771, 111, 776, 117, 768, 117, 769, 117, 770, 117,
+    776, 121, 769, 121, 776, 65, 772, 97, 772, 65, 774, 97, 774, 65, 808, 97, 808, 67, 769, 99, 769,
+    67, 770, 99, 770, 67, 775, 99, 775, 67, 780, 99, 780, 68, 780, 100, 780, 69, 772, 101, 772, 69,
+    774, 101, 774, 69, 775, 101, 775, 69, 808, 101, 808, 69, 780, 101, 780, 71, 770, 103, 770, 71,
+    774, 103, 774, 71, 775, 103, 775, 71, 807, 103, 807, 72, 770, 104, 770, 73, 771, 105, 771, 73,
+    772, 105, 772, 73, 774, 105, 774, 73, 808, 105, 808, 73, 775, 74, 770, 106, 770, 75, 807, 107,
+    807, 76, 769, 108, 769, 76, 807, 108, 807, 76, 780, 108, 780, 78, 769, 110, 769, 78, 807, 110,
+    807, 78, 780, 110, 780, 79, 772, 111, 772, 79, 774, 111, 774, 79, 779, 111, 779, 82, 769, 114,
+    769, 82, 807, 114, 807, 82, 780, 114, 780, 83, 769, 115, 769, 83, 770, 115, 770, 83, 807, 115,
+    807, 83, 780, 115, 780, 84, 807, 116, 807, 84, 780, 116, 780, 85, 771, 117, 771, 85, 772, 117,
+    772, 85, 774, 117, 774, 85, 778, 117, 778, 85, 779, 117, 779, 85, 808, 117, 808, 87, 770, 119,
+    770, 89, 770, 121, 770, 89, 776, 90, 769, 122, 769, 90, 775, 122, 775, 90, 780, 122, 780, 79,
+    795, 111, 795, 85, 795, 117, 795, 65, 780, 97, 780, 73, 780, 105, 780, 79, 780, 111, 780, 85,
+    780, 117, 780, 85, 776, 772, 117, 776, 772, 85, 776, 769, 117, 776, 769, 85, 776, 780, 117, 776,
+    780, 85, 776, 768, 117, 776, 768, 65, 776, 772, 97, 776, 772, 65, 775, 772, 97, 775, 772, 198,
+    772, 230, 772, 71, 780, 103, 780, 75, 780, 107, 780, 79, 808, 111, 808, 79, 808, 772, 111, 808,
+    772, 439, 780, 658, 780, 106, 780, 71, 769, 103, 769, 78, 768, 110, 768, 65, 778, 769, 97, 778,
+    769, 198, 769, 230, 769, 216, 769, 248, 769, 65, 783, 97, 783, 65, 785, 97, 785, 69, 783, 101,
+    783, 69, 785, 101, 785, 73, 783, 105, 783, 73, 785, 105, 785, 79, 783, 111, 783, 79, 785, 111,
+    785, 82, 783, 114, 783, 82, 785, 114, 785, 85, 783, 117, 783, 85, 785, 117, 785, 83, 806, 115,
+    806, 84, 806, 116, 806, 72, 780, 104, 780, 65, 775, 97, 775, 69, 807, 101, 807, 79, 776, 772,
+    111, 776, 772, 79, 771, 772, 111, 771, 772, 79, 775, 111, 775, 79, 775, 772, 111, 775, 772, 89,
+    772, 121, 772, 768, 769, 787, 776, 769, 697, 59, 168, 769, 913, 769, 183, 917, 769, 919, 769,
+    921, 769, 927, 769, 933, 769, 937, 769, 953, 776, 769, 921, 776, 933, 776, 945, 769, 949, 769,
+    951, 769, 953, 769, 965, 776, 769, 953, 776, 965, 776, 959, 769, 965, 769, 969, 769, 978, 769,
+    978, 776, 1045, 768, 1045, 776, 1043, 769, 1030, 776, 1050, 769, 1048, 768, 1059, 774, 1048,
+    774, 1080, 774, 1077, 768, 1077, 776, 1075, 769, 1110, 776, 1082, 769, 1080, 768, 1091, 774,
+    1140, 783, 1141, 783, 1046, 774, 1078, 774, 1040, 774, 1072, 774, 1040, 776, 1072, 776, 1045,
+    774, 1077, 774, 1240, 776, 1241, 776, 1046, 776, 1078, 776, 1047, 776, 1079, 776, 1048, 772,
+    1080, 772, 1048, 776, 1080, 776, 1054, 776, 1086, 776, 1256, 776, 1257, 776, 1069, 776, 1101,
+    776, 1059, 772, 1091, 772, 1059, 776, 1091, 776, 1059, 779, 1091, 779, 1063, 776, 1095, 776,
+    1067, 776, 1099, 776, 1575, 1619, 1575, 1620, 1608, 1620, 1575, 1621, 1610, 1620, 1749, 1620,
+    1729, 1620, 1746, 1620, 2344, 2364, 2352, 2364, 2355, 2364, 2325, 2364, 2326, 2364, 2327, 2364,
+    2332, 2364, 2337, 2364, 2338, 2364, 2347, 2364, 2351, 2364, 2503, 2494, 2503, 2519, 2465, 2492,
+    2466, 2492, 2479, 2492, 2610, 2620, 2616, 2620, 2582, 2620, 2583, 2620, 2588, 2620, 2603, 2620,
+    2887, 2902, 2887, 2878, 2887, 2903, 2849, 2876, 2850, 2876, 2962, 3031, 3014, 3006, 3015, 3006,
+    3014, 3031, 3142, 3158, 3263, 3285, 3270, 3285, 3270, 3286, 3270, 3266, 3270, 3266, 3285, 3398,
+    3390, 3399, 3390, 3398, 3415, 3545, 3530, 3545, 3535, 3545, 3535, 3530, 3545, 3551, 3906, 4023,
+    3916, 4023, 3921, 4023, 3926, 4023, 3931, 4023, 3904, 4021, 3953, 3954, 3953, 3956, 4018, 3968,
+    4019, 3968, 3953, 3968, 3986, 4023, 3996, 4023, 4001, 4023, 4006, 4023, 4011, 4023, 3984, 4021,
+    4133, 4142, 6917, 6965, 6919, 6965, 6921, 6965, 6923, 6965, 6925, 6965, 6929, 6965, 6970, 6965,
+    6972, 6965, 6974, 6965, 6975, 6965, 6978, 6965, 65, 805, 97, 805, 66, 775, 98, 775, 66, 803, 98,
+    803, 66, 817, 98, 817, 67, 807, 769, 99, 807, 769, 68, 775, 100, 775, 68, 803, 100, 803, 68,
+    817, 100, 817, 68, 807, 100, 807, 68, 813, 100, 813, 69, 772, 768, 101, 772, 768, 69, 772, 769,
+    101, 772, 769, 69, 813, 101, 813, 69, 816, 101, 816, 69, 807, 774, 101, 807, 774, 70, 775, 102,
+    775, 71, 772, 103, 772, 72, 775, 104, 775, 72, 803, 104, 803, 72, 776, 104, 776, 72, 807, 104,
+    807, 72, 814, 104, 814, 73, 816, 105, 816, 73, 776, 769, 105, 776, 769, 75, 769, 107, 769, 75,
+    803, 107, 803, 75, 817, 107, 817, 76, 803, 108, 803, 76, 803, 772, 108, 803, 772, 76, 817, 108,
+    817, 76, 813, 108, 813, 77, 769, 109, 769, 77, 775, 109, 775, 77, 803, 109, 803, 78, 775, 110,
+    775, 78, 803, 110, 803, 78, 817, 110, 817, 78, 813, 110, 813, 79, 771, 769, 111, 771, 769, 79,
+    771, 776, 111, 771, 776, 79, 772, 768, 111, 772, 768, 79, 772, 769, 111, 772, 769, 80, 769, 112,
+    769, 80, 775, 112, 775, 82, 775, 114, 775, 82, 803, 114, 803, 82, 803, 772, 114, 803, 772, 82,
+    817, 114, 817, 83, 775, 115, 775, 83, 803, 115, 803, 83, 769, 775, 115, 769, 775, 83, 780, 775,
+    115, 780, 775, 83, 803, 775, 115, 803, 775, 84, 775, 116, 775, 84, 803, 116, 803, 84, 817, 116,
+    817, 84, 813, 116, 813, 85, 804, 117, 804, 85, 816, 117, 816, 85, 813, 117, 813, 85, 771, 769,
+    117, 771, 769, 85, 772, 776, 117, 772, 776, 86, 771, 118, 771, 86, 803, 118, 803, 87, 768, 119,
+    768, 87, 769, 119, 769, 87, 776, 119, 776, 87, 775, 119, 775, 87, 803, 119, 803, 88, 775, 120,
+    775, 88, 776, 120, 776, 89, 775, 121, 775, 90, 770, 122, 770, 90, 803, 122, 803, 90, 817, 122,
+    817, 104, 817, 116, 776, 119, 778, 121, 778, 383, 775, 65, 803, 97, 803, 65, 777, 97, 777, 65,
+    770, 769, 97, 770, 769, 65, 770, 768, 97, 770, 768, 65, 770, 777, 97, 770, 777, 65, 770, 771,
+    97, 770, 771, 65, 803, 770, 97, 803, 770, 65, 774, 769, 97, 774, 769, 65, 774, 768, 97, 774,
+    768, 65, 774, 777, 97, 774, 777, 65, 774, 771, 97, 774, 771, 65, 803, 774, 97, 803, 774, 69,
+    803, 101, 803, 69, 777, 101, 777, 69, 771, 101, 771, 69, 770, 769, 101, 770, 769, 69, 770, 768,
+    101, 770, 768, 69, 770, 777, 101, 770, 777, 69, 770, 771, 101, 770, 771, 69, 803, 770, 101, 803,
+    770, 73, 777, 105, 777, 73, 803, 105, 803, 79, 803, 111, 803, 79, 777, 111, 777, 79, 770, 769,
+    111, 770, 769, 79, 770, 768, 111, 770, 768, 79, 770, 777, 111, 770, 777, 79, 770, 771, 111, 770,
+    771, 79, 803, 770, 111, 803, 770, 79, 795, 769, 111, 795, 769, 79, 795, 768, 111, 795, 768, 79,
+    795, 777, 111, 795, 777, 79, 795, 771, 111, 795, 771, 79, 795, 803, 111, 795, 803, 85, 803, 117,
+    803, 85, 777, 117, 777, 85, 795, 769, 117, 795, 769, 85, 795, 768, 117, 795, 768, 85, 795, 777,
+    117, 795, 777, 85, 795, 771, 117, 795, 771, 85, 795, 803, 117, 795, 803, 89, 768, 121, 768, 89,
+    803, 121, 803, 89, 777, 121, 777, 89, 771, 121, 771, 945, 787, 945, 788, 945, 787, 768, 945,
+    788, 768, 945, 787, 769, 945, 788, 769, 945, 787, 834, 945, 788, 834, 913, 787, 913, 788, 913,
+    787, 768, 913, 788, 768, 913, 787, 769, 913, 788, 769, 913, 787, 834, 913, 788, 834, 949, 787,
+    949, 788, 949, 787, 768, 949, 788, 768, 949, 787, 769, 949, 788, 769, 917, 787, 917, 788, 917,
+    787, 768, 917, 788, 768, 917, 787, 769, 917, 788, 769, 951, 787, 951, 788, 951, 787, 768, 951,
+    788, 768, 951, 787, 769, 951, 788, 769, 951, 787, 834, 951, 788, 834, 919, 787, 919, 788, 919,
+    787, 768, 919, 788, 768, 919, 787, 769, 919, 788, 769, 919, 787, 834, 919, 788, 834, 953, 787,
+    953, 788, 953, 787, 768, 953, 788, 768, 953, 787, 769, 953, 788, 769, 953, 787, 834, 953, 788,
+    834, 921, 787, 921, 788, 921, 787, 768, 921, 788, 768, 921, 787, 769, 921, 788, 769, 921, 787,
+    834, 921, 788, 834, 959, 787, 959, 788, 959, 787, 768, 959, 788, 768, 959, 787, 769, 959, 788,
+    769, 927, 787, 927, 788, 927, 787, 768, 927, 788, 768, 927, 787, 769, 927, 788, 769, 965, 787,
+    965, 788, 965, 787, 768, 965, 788, 768, 965, 787, 769, 965, 788, 769, 965, 787, 834, 965, 788,
+    834, 933, 788, 933, 788, 768, 933, 788, 769, 933, 788, 834, 969, 787, 969, 788, 969, 787, 768,
+    969, 788, 768, 969, 787, 769, 969, 788, 769, 969, 787, 834, 969, 788, 834, 937, 787, 937, 788,
+    937, 787, 768, 937, 788, 768, 937, 787, 769, 937, 788, 769, 937, 787, 834, 937, 788, 834, 945,
+    768, 945, 769, 949, 768, 949, 769, 951, 768, 951, 769, 953, 768, 953, 769, 959, 768, 959, 769,
+    965, 768, 965, 769, 969, 768, 969, 769, 945, 787, 837, 945, 788, 837, 945, 787, 768, 837, 945,
+    788, 768, 837, 945, 787, 769, 837, 945, 788, 769, 837, 945, 787, 834, 837, 945, 788, 834, 837,
+    913, 787, 837, 913, 788, 837, 913, 787, 768, 837, 913, 788, 768, 837, 913, 787, 769, 837, 913,
+    788, 769, 837, 913, 787, 834, 837, 913, 788, 834, 837, 951, 787, 837, 951, 788, 837, 951, 787,
+    768, 837, 951, 788, 768, 837, 951, 787, 769, 837, 951, 788, 769, 837, 951, 787, 834, 837, 951,
+    788, 834, 837, 919, 787, 837, 919, 788, 837, 919, 787, 768, 837, 919, 788, 768, 837, 919, 787,
+    769, 837, 919, 788, 769, 837, 919, 787, 834, 837, 919, 788, 834, 837, 969, 787, 837, 969, 788,
+    837, 969, 787, 768, 837, 969, 788, 768, 837, 969, 787, 769, 837, 969, 788, 769, 837, 969, 787,
+    834, 837, 969, 788, 834, 837, 937, 787, 837, 937, 788, 837, 937, 787, 768, 837, 937, 788, 768,
+    837, 937, 787, 769, 837, 937, 788, 769, 837, 937, 787, 834, 837, 937, 788, 834, 837, 945, 774,
+    945, 772, 945, 768, 837, 945, 837, 945, 769, 837, 945, 834, 945, 834, 837, 913, 774, 913, 772,
+    913, 768, 913, 769, 913, 837, 953, 168, 834, 951, 768, 837, 951, 837, 951, 769, 837, 951, 834,
+    951, 834, 837, 917, 768, 917, 769, 919, 768, 919, 769, 919, 837, 8127, 768, 8127, 769, 8127,
+    834, 953, 774, 953, 772, 953, 776, 768, 953, 776, 769, 953, 834, 953, 776, 834, 921, 774, 921,
+    772, 921, 768, 921, 769, 8190, 768, 8190, 769, 8190, 834, 965, 774, 965, 772, 965, 776, 768,
+    965, 776, 769, 961, 787, 961, 788, 965, 834, 965, 776, 834, 933, 774, 933, 772, 933, 768, 933,
+    769, 929, 788, 168, 768, 168, 769, 96, 969, 768, 837, 969, 837, 969, 769, 837, 969, 834, 969,
+    834, 837, 927, 768, 927, 769, 937, 768, 937, 769, 937, 837, 180, 8194, 8195, 937, 75, 65, 778,
+    8592, 824, 8594, 824, 8596, 824, 8656, 824, 8660, 824, 8658, 824, 8707, 824, 8712, 824, 8715,
+    824, 8739, 824, 8741, 824, 8764, 824, 8771, 824, 8773, 824, 8776, 824, 61, 824, 8801, 824, 8781,
+    824, 60, 824, 62, 824, 8804, 824, 8805, 824, 8818, 824, 8819, 824, 8822, 824, 8823, 824, 8826,
+    824, 8827, 824, 8834, 824, 8835, 824, 8838, 824, 8839, 824, 8866, 824, 8872, 824, 8873, 824,
+    8875, 824, 8828, 824, 8829, 824, 8849, 824, 8850, 824, 8882, 824, 8883, 824, 8884, 824, 8885,
+    824, 12296, 12297, 10973, 824, 12363, 12441, 12365, 12441, 12367, 12441, 12369, 12441, 12371,
+    12441, 12373, 12441, 12375, 12441, 12377, 12441, 12379, 12441, 12381, 12441, 12383, 12441,
+    12385, 12441, 12388, 12441, 12390, 12441, 12392, 12441, 12399, 12441, 12399, 12442, 12402,
+    12441, 12402, 12442, 12405, 12441, 12405, 12442, 12408, 12441, 12408, 12442, 12411, 12441,
+    12411, 12442, 12358, 12441, 12445, 12441, 12459, 12441, 12461, 12441, 12463, 12441, 12465,
+    12441, 12467, 12441, 12469, 12441, 12471, 12441, 12473, 12441, 12475, 12441, 12477, 12441,
+    12479, 12441, 12481, 12441, 12484, 12441, 12486, 12441, 12488, 12441, 12495, 12441, 12495,
+    12442, 12498, 12441, 12498, 12442, 12501, 12441, 12501, 12442, 12504, 12441, 12504, 12442,
+    12507, 12441, 12507, 12442, 12454, 12441, 12527, 12441, 12528, 12441, 12529, 12441, 12530,
+    12441, 12541, 12441, 35912, 26356, 36554, 36040, 28369, 20018, 21477, 40860, 40860, 22865,
+    37329, 21895, 22856, 25078, 30313, 32645, 34367, 34746, 35064, 37007, 27138, 27931, 28889,
+    29662, 33853, 37226, 39409, 20098, 21365, 27396, 29211, 34349, 40478, 23888, 28651, 34253,
+    35172, 25289, 33240, 34847, 24266, 26391, 28010, 29436, 37070, 20358, 20919, 21214, 25796,
+    27347, 29200, 30439, 32769, 34310, 34396, 36335, 38706, 39791, 40442, 30860, 31103, 32160,
+    33737, 37636, 40575, 35542, 22751, 24324, 31840, 32894, 29282, 30922, 36034, 38647, 22744,
+    23650, 27155, 28122, 28431, 32047, 32311, 38475, 21202, 32907, 20956, 20940, 31260, 32190,
+    33777, 38517, 35712, 25295, 27138, 35582, 20025, 23527, 24594, 29575, 30064, 21271, 30971,
+    20415, 24489, 19981, 27852, 25976, 32034, 21443, 22622, 30465, 33865, 35498, 27578, 36784,
+    27784, 25342, 33509, 25504, 30053, 20142, 20841, 20937, 26753, 31975, 33391, 35538, 37327,
+    21237, 21570, 22899, 24300, 26053, 28670, 31018, 38317, 39530, 40599, 40654, 21147, 26310,
+    27511, 36706, 24180, 24976, 25088, 25754, 28451, 29001, 29833, 31178, 32244, 32879, 36646,
+    34030, 36899, 37706, 21015, 21155, 21693, 28872, 35010, 35498, 24265, 24565, 25467, 27566,
+    31806, 29557, 20196, 22265, 23527, 23994, 24604, 29618, 29801, 32666, 32838, 37428, 38646,
+    38728, 38936, 20363, 31150, 37300, 38584, 24801, 20102, 20698, 23534, 23615, 26009, 27138,
+    29134, 30274, 34044, 36988, 40845, 26248, 38446, 21129, 26491, 26611, 27969, 28316, 29705,
+    30041, 30827, 32016, 39006, 20845, 25134, 38520, 20523, 23833, 28138, 36650, 24459, 24900,
+    26647, 29575, 38534, 21033, 21519, 23653, 26131, 26446, 26792, 27877, 29702, 30178, 32633,
+    35023, 35041, 37324, 38626, 21311, 28346, 21533, 29136, 29848, 34298, 38563, 40023, 40607,
+    26519, 28107, 33256, 31435, 31520, 31890, 29376, 28825, 35672, 20160, 33590, 21050, 20999,
+    24230, 25299, 31958, 23429, 27934, 26292, 36667, 34892, 38477, 35211, 24275, 20800, 21952,
+    22618, 26228, 20958, 29482, 30410, 31036, 31070, 31077, 31119, 38742, 31934, 32701, 34322,
+    35576, 36920, 37117, 39151, 39164, 39208, 40372, 37086, 38583, 20398, 20711, 20813, 21193,
+    21220, 21329, 21917, 22022, 22120, 22592, 22696, 23652, 23662, 24724, 24936, 24974, 25074,
+    25935, 26082, 26257, 26757, 28023, 28186, 28450, 29038, 29227, 29730, 30865, 31038, 31049,
+    31048, 31056, 31062, 31069, 31117, 31118, 31296, 31361, 31680, 32244, 32265, 32321, 32626,
+    32773, 33261, 33401, 33401, 33879, 35088, 35222, 35585, 35641, 36051, 36104, 36790, 36920,
+    38627, 38911, 38971, 24693, 148206, 33304, 20006, 20917, 20840, 20352, 20805, 20864, 21191,
+    21242, 21917, 21845, 21913, 21986, 22618, 22707, 22852, 22868, 23138, 23336, 24274, 24281,
+    24425, 24493, 24792, 24910, 24840, 24974, 24928, 25074, 25140, 25540, 25628, 25682, 25942,
+    26228, 26391, 26395, 26454, 27513, 27578, 27969, 28379, 28363, 28450, 28702, 29038, 30631,
+    29237, 29359, 29482, 29809, 29958, 30011, 30237, 30239, 30410, 30427, 30452, 30538, 30528,
+    30924, 31409, 31680, 31867, 32091, 32244, 32574, 32773, 33618, 33775, 34681, 35137, 35206,
+    35222, 35519, 35576, 35531, 35585, 35582, 35565, 35641, 35722, 36104, 36664, 36978, 37273,
+    37494, 38524, 38627, 38742, 38875, 38911, 38923, 38971, 39698, 40860, 141386, 141380, 144341,
+    15261, 16408, 16441, 152137, 154832, 163539, 40771, 40846, 1497, 1460, 1522, 1463, 1513, 1473,
+    1513, 1474, 1513, 1468, 1473, 1513, 1468, 1474, 1488, 1463, 1488, 1464, 1488, 1468, 1489, 1468,
+    1490, 1468, 1491, 1468, 1492, 1468, 1493, 1468, 1494, 1468, 1496, 1468, 1497, 1468, 1498, 1468,
+    1499, 1468, 1500, 1468, 1502, 1468, 1504, 1468, 1505, 1468, 1507, 1468, 1508, 1468, 1510, 1468,
+    1511, 1468, 1512, 1468, 1513, 1468, 1514, 1468, 1493, 1465, 1489, 1471, 1499, 1471, 1508, 1471,
+    69785, 69818, 69787, 69818, 69797, 69818, 69937, 69927, 69938, 69927, 70471, 70462, 70471,
+    70487, 70841, 70842, 70841, 70832, 70841, 70845, 71096, 71087, 71097, 71087, 71989, 71984,
+    119127, 119141, 119128, 119141, 119128, 119141, 119150, 119128, 119141, 119151, 119128, 119141,
+    119152, 119128, 119141, 119153, 119128, 119141, 119154, 119225, 119141, 119226, 119141, 119225,
+    119141, 119150, 119226, 119141, 119150, 119225, 119141, 119151, 119226, 119141, 119151, 20029,
+    20024, 20033, 131362, 20320, 20398, 20411, 20482, 20602, 20633, 20711, 20687, 13470, 132666,
+    20813, 20820, 20836, 20855, 132380, 13497, 20839, 20877, 132427, 20887, 20900, 20172, 20908,
+    20917, 168415, 20981, 20995, 13535, 21051, 21062, 21106, 21111, 13589, 21191, 21193, 21220,
+    21242, 21253, 21254, 21271, 21321, 21329, 21338, 21363, 21373, 21375, 21375, 21375, 133676,
+    28784, 21450, 21471, 133987, 21483, 21489, 21510, 21662, 21560, 21576, 21608, 21666, 21750,
+    21776, 21843, 21859, 21892, 21892, 21913, 21931, 21939, 21954, 22294, 22022, 22295, 22097,
+    22132, 20999, 22766, 22478, 22516, 22541, 22411, 22578, 22577, 22700, 136420, 22770, 22775,
+    22790, 22810, 22818, 22882, 136872, 136938, 23020, 23067, 23079, 23000, 23142, 14062, 14076,
+    23304, 23358, 23358, 137672, 23491, 23512, 23527, 23539, 138008, 23551, 23558, 24403, 23586,
+    14209, 23648, 23662, 23744, 23693, 138724, 23875, 138726, 23918, 23915, 23932, 24033, 24034,
+    14383, 24061, 24104, 24125, 24169, 14434, 139651, 14460, 24240, 24243, 24246, 24266, 172946,
+    24318, 140081, 140081, 33281, 24354, 24354, 14535, 144056, 156122, 24418, 24427, 14563, 24474,
+    24525, 24535, 24569, 24705, 14650, 14620, 24724, 141012, 24775, 24904, 24908, 24910, 24908,
+    24954, 24974, 25010, 24996, 25007, 25054, 25074, 25078, 25104, 25115, 25181, 25265, 25300,
+    25424, 142092, 25405, 25340, 25448, 25475, 25572, 142321, 25634, 25541, 25513, 14894, 25705,
+    25726, 25757, 25719, 14956, 25935, 25964, 143370, 26083, 26360, 26185, 15129, 26257, 15112,
+    15076, 20882, 20885, 26368, 26268, 32941, 17369, 26391, 26395, 26401, 26462, 26451, 144323,
+    15177, 26618, 26501, 26706, 26757, 144493, 26766, 26655, 26900, 15261, 26946, 27043, 27114,
+    27304, 145059, 27355, 15384, 27425, 145575, 27476, 15438, 27506, 27551, 27578, 27579, 146061,
+    138507, 146170, 27726, 146620, 27839, 27853, 27751, 27926, 27966, 28023, 27969, 28009, 28024,
+    28037, 146718, 27956, 28207, 28270, 15667, 28363, 28359, 147153, 28153, 28526, 147294, 147342,
+    28614, 28729, 28702, 28699, 15766, 28746, 28797, 28791, 28845, 132389, 28997, 148067, 29084,
+    148395, 29224, 29237, 29264, 149000, 29312, 29333, 149301, 149524, 29562, 29579, 16044, 29605,
+    16056, 16056, 29767, 29788, 29809, 29829, 29898, 16155, 29988, 150582, 30014, 150674, 30064,
+    139679, 30224, 151457, 151480, 151620, 16380, 16392, 30452, 151795, 151794, 151833, 151859,
+    30494, 30495, 30495, 30538, 16441, 30603, 16454, 16534, 152605, 30798, 30860, 30924, 16611,
+    153126, 31062, 153242, 153285, 31119, 31211, 16687, 31296, 31306, 31311, 153980, 154279, 154279,
+    31470, 16898, 154539, 31686, 31689, 16935, 154752, 31954, 17056, 31976, 31971, 32000, 155526,
+    32099, 17153, 32199, 32258, 32325, 17204, 156200, 156231, 17241, 156377, 32634, 156478, 32661,
+    32762, 32773, 156890, 156963, 32864, 157096, 32880, 144223, 17365, 32946, 33027, 17419, 33086,
+    23221, 157607, 157621, 144275, 144284, 33281, 33284, 36766, 17515, 33425, 33419, 33437, 21171,
+    33457, 33459, 33469, 33510, 158524, 33509, 33565, 33635, 33709, 33571, 33725, 33767, 33879,
+    33619, 33738, 33740, 33756, 158774, 159083, 158933, 17707, 34033, 34035, 34070, 160714, 34148,
+    159532, 17757, 17761, 159665, 159954, 17771, 34384, 34396, 34407, 34409, 34473, 34440, 34574,
+    34530, 34681, 34600, 34667, 34694, 17879, 34785, 34817, 17913, 34912, 34915, 161383, 35031,
+    35038, 17973, 35066, 13499, 161966, 162150, 18110, 18119, 35488, 35565, 35722, 35925, 162984,
+    36011, 36033, 36123, 36215, 163631, 133124, 36299, 36284, 36336, 133342, 36564, 36664, 165330,
+    165357, 37012, 37105, 37137, 165678, 37147, 37432, 37591, 37592, 37500, 37881, 37909, 166906,
+    38283, 18837, 38327, 167287, 18918, 38595, 23986, 38691, 168261, 168474, 19054, 19062, 38880,
+    168970, 19122, 169110, 38923, 38923, 38953, 169398, 39138, 19251, 39209, 39335, 39362, 39422,
+    19406, 170800, 39698, 40000, 40189, 19662, 19693, 40295, 172238, 19704, 172293, 172558, 172689,
+    40635, 19798, 40697, 40702, 40709, 40719, 40726, 40763, 173568,
+};
+
+template <class T>
+const std::uint32_t _unicode_data<T>::compat_decompositions[] = {
+    2621440, 2752513, 2785283, 2867204, 2916358, 2932743, 2949128, 2965514, 3014667, 3031053,
+    3047438, 3080207, 3096594, 3112981, 5013528, 5029914, 5226524, 5242910, 5390368, 6275106,
+    7405603, 7421990, 7438377, 7454764, 7471150, 7487536, 7503922, 7520308, 7536694, 8142904,
+    8159290, 8175676, 11272254, 11288639, 11305024, 11321409, 11337794, 11354179, 11370564,
+    11386949, 11403334, 11927623, 11944009, 11960395, 11976781, 11993167, 12009553, 12058707,
+    12075092, 12091477, 12107862, 12124247, 14581848, 14745690, 14762076, 15990879, 16007264,
+    16023649, 16040034, 16056420, 16072806, 16089191, 16515176, 16531561, 16547946, 16580715,
+    16597100, 16662637, 23183470, 27082864, 27099250, 27115636, 27132022, 59555960, 61653114,
+    62324860, 62341246, 63111296, 64864385, 64897156, 71237767, 122355848, 122372233, 122388618,
+    122421387, 122437772, 122454157, 122470542, 122486927, 122503312, 122519697, 122536082,
+    122552467, 122568852, 122585237, 122618006, 122634391, 122650776, 122667161, 122683546,
+    122699931, 122716316, 122732701, 122749086, 122765471, 122781856, 122798241, 122814626,
+    122831011, 122847396, 122863781, 122880166, 122896551, 122929320, 122945705, 122962090,
+    122978475, 122994860, 123011245, 123027630, 123044015, 123060400, 123076785, 123093170,
+    123109555, 123125940, 123142325, 123158710, 123175095, 123191480, 123207865, 123224250,
+    123240635, 123257020, 123273405, 123289790, 123306175, 123322560, 123338945, 123355330,
+    123371715, 123601092, 124174533, 124190918, 124207303, 124223688, 124240073, 124256458,
+    124272843, 124289228, 124305613, 124321998, 124338383, 124354768, 124371153, 124387538,
+    124403923, 124420308, 124436693, 124453078, 124469463, 124485848, 124502233, 124518618,
+    124535003, 124551388, 124567773, 124584158, 124600543, 124616928, 124633313, 124649698,
+    124666083, 124682468, 124698853, 124715238, 124731623, 124748008, 124764393, 128352490,
+    128368876, 133120238, 133153008, 133169394, 133185780, 133382391, 133398778, 133415165,
+    133644544, 133660931, 133677318, 133906697, 133923084, 134168847, 134185233, 134218003,
+    134234388, 134250773, 134267158, 134283543, 134299928, 134316313, 134332698, 134349083,
+    134365468, 134381853, 134496542, 134594847, 134807841, 134824226, 134840612, 134988071,
+    135053608, 135069994, 135102765, 135119151, 135201074, 135233844, 135381302, 135397688,
+    135414074, 135643452, 135774528, 136053057, 136069442, 136118595, 136134980, 136151365,
+    136167750, 136184135, 136200520, 136216905, 136233290, 136249675, 136266060, 136282445,
+    136298830, 136315215, 136331600, 136347985, 136364370, 136380755, 136397140, 136413525,
+    136429910, 136446295, 136462680, 136479065, 136495450, 136511835, 136528220, 136544605,
+    136577374, 136593759, 136610144, 136626529, 136642914, 136659299, 136675684, 136692069,
+    136708454, 136724839, 136741224, 136757609, 136773994, 136970603, 138412397, 138428784,
+    138445171, 138461556, 138494326, 138510713, 138527100, 138559869, 138576255, 138592640,
+    138609025, 138625410, 138641795, 138658180, 138674565, 138690950, 138707335, 138723720,
+    138756489, 138772874, 138822028, 138838413, 138854798, 138871183, 138887568, 138936721,
+    138953107, 138969494, 139002264, 139067801, 139133338, 139149723, 139182492, 139198877,
+    139215262, 139248031, 139264416, 139280801, 139297186, 139313571, 139329956, 139346341,
+    139379110, 139395497, 139411882, 139428267, 139444652, 139461037, 139542958, 139559343,
+    139575728, 139592113, 139608498, 139723187, 139739574, 139755961, 139772349, 139788736,
+    139805123, 139821510, 139837897, 139854284, 139870671, 139887058, 139903445, 139919832,
+    139936219, 139952606, 139968993, 139985379, 140001764, 140018150, 140034537, 140050923,
+    140067308, 140083694, 140100081, 140116469, 140132855, 140149240, 140165626, 140182013,
+    140198398, 140214783, 140231168, 140247553, 140263938, 140280324, 140296711, 140313097,
+    140329482, 140345868, 140362255, 140378643, 140395029, 140411414, 140427800, 140444187,
+    140460572, 140476957, 140493342, 140657183, 143327778, 143344164, 143376935, 143393321,
+    152568364, 152584749, 152601134, 152617519, 152633904, 152650289, 152666674, 152683059,
+    152699444, 152715829, 152732215, 152748601, 152764987, 152781373, 152797759, 152814145,
+    152830531, 152846917, 152863303, 152879689, 152896075, 152912462, 152928849, 152945236,
+    152961623, 152978010, 152994397, 153010784, 153027171, 153043558, 153059946, 153076334,
+    153092722, 153109110, 153125498, 153141886, 153158274, 153174662, 153191050, 153207438,
+    153223826, 153240212, 153256598, 153272984, 153289370, 153305756, 153322142, 153338528,
+    153354914, 153371300, 153387687, 153404074, 153420461, 153436848, 153453235, 153469622,
+    153486009, 153502396, 153518783, 153535170, 153551557, 153567944, 153584331, 153600718,
+    153617105, 153633492, 153649879, 153666266, 153682653, 153699040, 153715427, 153731814,
+    153748201, 153764588, 153780975, 153797362, 153813749, 153830136, 153846523, 153862910,
+    153879297, 153895684, 153912071, 153928458, 153944845, 153961232, 153977619, 153994004,
+    154010389, 154026774, 154043159, 154059544, 154075929, 154092314, 154108699, 154125084,
+    154141469, 154157854, 154174239, 154190624, 154207009, 154223394, 154239779, 154256164,
+    154272549, 154288934, 154305319, 154321704, 154338089, 154354474, 154370859, 154387244,
+    154403629, 154420014, 154436399, 154452784, 154469169, 154485554, 154501939, 154518324,
+    154534709, 154551094, 154567479, 154583864, 154600249, 154616634, 154633019, 154649404,
+    154665789, 154682174, 154698559, 154714944, 154731329, 154747714, 154764099, 154780484,
+    154796869, 154813254, 154829639, 176358216, 178062156, 178078543, 178094929, 186581844,
+    186598229, 190563158, 195543895, 196920152, 197133145, 197149530, 197165915, 197182300,
+    197198685, 197215070, 197231455, 197247840, 197264225, 197280610, 197296995, 197313380,
+    197329765, 197346150, 197362535, 197378920, 197395305, 197411690, 197428075, 197444460,
+    197460845, 197477230, 197493615, 197510000, 197526385, 197542770, 197559155, 197575540,
+    197591925, 197608310, 197624695, 197641080, 197657465, 197673850, 197690235, 197706620,
+    197723005, 197739390, 197755775, 197772160, 197788545, 197804930, 197821315, 197837700,
+    197854085, 197870470, 197886855, 197903240, 197919625, 197936010, 197952395, 197968780,
+    197985165, 198001550, 198017935, 198034320, 198050705, 198067090, 198083475, 198099860,
+    198116245, 198132630, 198149015, 198165400, 198181785, 198198170, 198214555, 198230940,
+    198247325, 198263710, 198280095, 198296480, 198312865, 198329250, 198345635, 198362020,
+    198378405, 198394790, 198411175, 198427560, 198443945, 198460330, 198476715, 198493100,
+    198509485, 198525870, 198542255, 198558640, 198575025, 198591410, 198607795, 198624180,
+    198640565, 198656950, 198673335, 198689720, 198706105, 198722490, 198738875, 198755260,
+    198771645, 198788030, 198804415, 198820800, 198837185, 198853570, 198869955, 198886340,
+    198902725, 198919110, 198935495, 198951880, 198968265, 198984650, 199001035, 199017420,
+    199033805, 199050190, 199066575, 199082960, 199099345, 199115730, 199132115, 199148500,
+    199164885, 199181270, 199197655, 199214040, 199230425, 199246810, 199263195, 199279580,
+    199295965, 199312350, 199328735, 199345120, 199361505, 199377890, 199394275, 199410660,
+    199427045, 199443430, 199459815, 199476200, 199492585, 199508970, 199525355, 199541740,
+    199558125, 199574510, 199590895, 199607280, 199623665, 199640050, 199656435, 199672820,
+    199689205, 199705590, 199721975, 199738360, 199754745, 199771130, 199787515, 199803900,
+    199820285, 199836670, 199853055, 199869440, 199885825, 199902210, 199918595, 199934980,
+    199951365, 199967750, 199984135, 200000520, 200016905, 200033290, 200049675, 200066060,
+    200082445, 200098830, 200115215, 200131600, 200147985, 200164370, 200180755, 200197140,
+    200213525, 200229910, 200246295, 200262680, 200279065, 200295450, 200311835, 200328220,
+    200344605, 200360990, 200377375, 200393760, 200410145, 200426530, 200442915, 200459300,
+    200475685, 200492070, 200508455, 200524840, 200541225, 200557610, 200573995, 200590380,
+    200606765, 200623150, 201327663, 202212400, 202245169, 202261554, 202277939, 203867188,
+    203883574, 203932728, 205505594, 206324796, 206341181, 206357566, 206373951, 206390336,
+    206406721, 206423106, 206439491, 206455876, 206472261, 206488646, 206505031, 206521416,
+    206537801, 206554186, 206570571, 206586956, 206603341, 206619726, 206636111, 206652496,
+    206668881, 206685266, 206701651, 206718036, 206734421, 206750806, 206767191, 206783576,
+    206799961, 206816346, 206832731, 206849116, 206865501, 206881886, 206898271, 206914656,
+    206931041, 206947426, 206963811, 206980196, 206996581, 207012966, 207029351, 207045736,
+    207062121, 207078506, 207094891, 207111276, 207127661, 207144046, 207160431, 207176816,
+    207193201, 207209586, 207225971, 207242356, 207258741, 207275126, 207291511, 207307896,
+    207324281, 207340666, 207357051, 207373436, 207389821, 207406206, 207422591, 207438976,
+    207455361, 207471746, 207488131, 207504516, 207520901, 207537286, 207553671, 207570056,
+    207586441, 207602826, 207619211, 207635596, 207651981, 207668366, 207684751, 207701136,
+    207717521, 207733906, 207750291, 207766676, 207783061, 207799446, 207815831, 207832216,
+    207848601, 207914138, 207930523, 207946908, 207963293, 207979678, 207996063, 208012448,
+    208028833, 208045218, 208061603, 208077988, 208094373, 208110758, 208127143, 209716392,
+    209732779, 209749166, 209765553, 209781940, 209798327, 209814714, 209831101, 209847488,
+    209863875, 209880262, 209896649, 209913036, 209929423, 209945810, 209962198, 209978586,
+    209994974, 210011362, 210027750, 210044138, 210060526, 210076914, 210093302, 210109690,
+    210126078, 210142466, 210158854, 210175242, 210191630, 210208021, 210240795, 210257182,
+    210273569, 210289956, 210306343, 210322730, 210339117, 210355504, 210371891, 210388278,
+    210404665, 210421052, 210437439, 210453826, 210470213, 210486600, 210502987, 210519374,
+    210535761, 210552148, 210568535, 210584922, 210601309, 210617696, 210634083, 210650470,
+    210666857, 210683244, 210699631, 210716018, 210732405, 210748792, 210765179, 210781566,
+    210797953, 210814340, 210830727, 210847112, 210863497, 210879882, 211027339, 211043726,
+    211060112, 211076498, 211092884, 211109270, 211125656, 211142042, 211158428, 211174814,
+    211191200, 211207586, 211223972, 211240358, 211256744, 211273130, 211289516, 211305901,
+    211322286, 211338671, 211355056, 211371441, 211387826, 211404211, 211420596, 211436981,
+    211453366, 211469751, 211486136, 211502521, 211518906, 211535292, 211551678, 211568064,
+    211584450, 211600836, 211617222, 211633608, 211649994, 211666380, 211682766, 211699152,
+    211715538, 211731924, 211748310, 211764699, 211781087, 211813857, 211830242, 211846627,
+    211863012, 211879397, 211895782, 211912167, 211928552, 211944937, 211961322, 211977707,
+    211994092, 212010477, 212026862, 212043247, 212059632, 212076017, 212092402, 212108787,
+    212125172, 212141557, 212157942, 212174327, 212190712, 212207097, 212223482, 212239867,
+    212256252, 212272637, 212289022, 212305407, 212321792, 212338177, 212354562, 212370947,
+    212387332, 212403717, 212420102, 212436487, 212452872, 212469257, 212485642, 212502027,
+    212518412, 212534797, 212551182, 212567567, 212583952, 212600337, 212616722, 212633108,
+    212649494, 212665880, 212682266, 212698652, 212715038, 212731424, 212747810, 212764196,
+    212780582, 212796968, 212813354, 212829740, 212846126, 212862512, 212878898, 212895284,
+    212911670, 212928056, 212944442, 212960828, 212977214, 212993600, 213009986, 213026373,
+    213042760, 213059147, 213075533, 213091920, 213108306, 213124693, 213141078, 213157463,
+    213173848, 213190233, 213206618, 213223003, 213239388, 213255773, 213272158, 213288543,
+    213304928, 213321313, 213337698, 213354083, 213370468, 213386853, 213403238, 213419623,
+    213436008, 213452393, 213468778, 213485163, 213501548, 213517933, 213534318, 213550703,
+    213567088, 213583473, 213599858, 213616243, 213632628, 213649013, 213665398, 213681783,
+    213698168, 213714553, 213730938, 213747323, 213763708, 213780093, 213796478, 213812863,
+    213829248, 213845633, 213862018, 213878403, 213894788, 213911174, 213927563, 213943951,
+    213960340, 213976727, 213993116, 214009503, 214025890, 214042280, 214058668, 214075055,
+    214091442, 214107829, 214124217, 214140605, 214156993, 214173381, 214189769, 214206157,
+    214222545, 214238935, 214255321, 214271711, 214288101, 214304490, 214320878, 214337268,
+    214353658, 214370046, 214386433, 214402820, 214419208, 214435596, 214451985, 214468374,
+    214484761, 214501148, 214517536, 214533923, 214550310, 214566696, 214583082, 214599469,
+    214615856, 214632246, 214648634, 214665023, 214681413, 214697801, 214714188, 214730575,
+    214746965, 214763353, 214779743, 214796130, 214812519, 214828906, 214845294, 214861681,
+    214878069, 214894458, 214910846, 214927235, 214943623, 214960009, 214976398, 214992785,
+    215009172, 215025560, 215041947, 215058334, 215074721, 215091110, 215107498, 215123884,
+    215140274, 215156661, 215173050, 215189438, 215205826, 215222213, 215238600, 215254988,
+    215271374, 215287762, 215304151, 215320537, 215336927, 215353314, 215369700, 215386086,
+    215402472, 215418858, 215435244, 215451630, 215468016, 215484402, 215500788, 215517174,
+    215533561, 215549948, 215566335, 215582722, 215599109, 215615496, 215631883, 215648270,
+    215664657, 215681044, 215697431, 215713818, 215730205, 215746592, 215762979, 215779366,
+    215795752, 215812138, 215828525, 215844911, 215861297, 215877683, 215894070, 215910457,
+    215926843, 215943229, 215959615, 215976001, 215992387, 216008775, 216025161, 216041547,
+    216057933, 216074319, 216090705, 216107091, 216123477, 216139863, 216156250, 216172638,
+    216189024, 216205410, 216221796, 216238182, 216254568, 216270954, 216287340, 216303727,
+    216320114, 216336501, 216352888, 216369274, 216385660, 216402046, 216418432, 216434818,
+    216451204, 216467590, 216483976, 216500362, 216516748, 216533135, 216549522, 216565908,
+    216582295, 216598682, 216615069, 216631455, 216647842, 216664229, 216680617, 216697003,
+    216713390, 216729777, 216746164, 216762551, 216778940, 216795330, 216811716, 216828102,
+    216844488, 216860874, 216877260, 216893646, 216910032, 216926418, 216942804, 216959190,
+    216975576, 216991962, 217008348, 217024734, 217041120, 217057506, 217073892, 217090278,
+    217106666, 217123052, 217139438, 217155824, 217172212, 217188599, 217204985, 217221371,
+    217237757, 217254143, 217270529, 217286915, 217303301, 217319687, 217336073, 217352459,
+    217368846, 217385232, 217401618, 217418005, 217434392, 217450778, 217467166, 217483553,
+    217499939, 217516325, 217532711, 217549097, 217565484, 217581871, 217598257, 217614643,
+    217631029, 217647415, 217663801, 217680187, 217696573, 217712959, 217729345, 217745732,
+    217762119, 217778506, 217794893, 217811280, 217827667, 217844054, 217860441, 217876828,
+    217893215, 217909602, 217925989, 217942376, 217958763, 217975150, 217991537, 218007924,
+    218024311, 218040698, 218057085, 218073472, 218089859, 698812806, 698829191, 702286216,
+    704416137, 704432522, 704448907, 704514444, 704530829, 718735758, 718752143, 718768528,
+    718784913, 718948754, 1052772755, 1052789141, 1052805527, 1052821913, 1052838300, 1052854687,
+    1052871073, 1053084067, 1053100453, 1053116839, 1053133225, 1053149611, 1053297069, 1053313454,
+    1053329839, 1053346224, 1053362609, 1053378994, 1053395379, 1053411764, 1053428149, 1053444534,
+    1054067127, 1054083513, 1054099898, 1054116283, 1054132668, 1054149053, 1054165438, 1054181823,
+    1054198208, 1054214593, 1054230978, 1054247363, 1054263748, 1054280133, 1054296518, 1054312903,
+    1054329288, 1054345673, 1054362058, 1054378443, 1054394828, 1054411213, 1054427598, 1054443983,
+    1054460368, 1054476753, 1054493138, 1054509523, 1054525908, 1054542293, 1054558678, 1054575063,
+    1054591448, 1054607833, 1054624218, 1054640603, 1054656988, 1054673373, 1054689758, 1054706143,
+    1054722528, 1054738913, 1054755298, 1054771683, 1054788068, 1054804453, 1054820838, 1054837223,
+    1054853608, 1054869993, 1054886378, 1054902763, 1054919148, 1054935533, 1054951918, 1054968303,
+    1054984688, 1055001073, 1055017458, 1055033843, 1055050228, 1055066613, 1055082998, 1055099383,
+    1055115768, 1055132153, 1055148538, 1055164923, 1055181308, 1055197693, 1055214078, 1055230463,
+    1055246848, 1055263233, 1055279618, 1055296003, 1055312388, 1055328773, 1055345158, 1055361543,
+    1055377928, 1055394313, 1055410698, 1055427083, 1055443468, 1055459853, 1055476239, 1055492625,
+    1055509010, 1055525395, 1055541780, 1055558165, 1055574550, 1055590935, 1055607320, 1055623705,
+    1055640090, 1055656475, 1055672861, 1056229919, 1056246304, 1056262689, 1056279074, 1056295459,
+    1056311844, 1056328229, 1056344614, 1056360999, 1056377384, 1056393769, 1056410155, 1056426540,
+    1056442925, 1056459310, 1056475695, 1056492080, 1056508465, 1056524850, 1056541235, 1056557620,
+    1056574005, 1056590390, 1056606775, 1056623162, 1056639549, 1056655936, 1056672323, 1056688710,
+    1056705097, 1056721484, 1056737871, 1056754258, 1056770645, 1056787032, 1056803419, 1056819806,
+    1056836193, 1056852580, 1056868967, 1056885354, 1056901741, 1056918126, 1056934511, 1056950896,
+    1056967281, 1056983668, 1057000055, 1057016442, 1057032829, 1057049216, 1057065602, 1057081988,
+    1057098374, 1057114760, 1057131146, 1057147532, 1057163918, 1057180304, 1057196690, 1057213076,
+    1057229462, 1057245848, 1057262234, 1057278620, 1057295006, 1057311392, 1057327778, 1057344164,
+    1057360550, 1057376936, 1057393322, 1057409708, 1057426094, 1057442480, 1057458866, 1057475252,
+    1057491638, 1057508024, 1057524410, 1057540796, 1057557182, 1057573568, 1057589954, 1057606340,
+    1057622726, 1057639112, 1057655498, 1057671884, 1057688270, 1057704656, 1057721042, 1057737428,
+    1057753814, 1057770200, 1057786586, 1057802972, 1057819358, 1057835744, 1057852130, 1057868516,
+    1057884902, 1057901288, 1057917674, 1057934060, 1057950446, 1057966832, 1057983218, 1057999604,
+    1058015990, 1058032376, 1058048762, 1058065148, 1058081534, 1058097920, 1058114306, 1058130692,
+    1058147078, 1058163464, 1058179850, 1058196236, 1058212622, 1058229008, 1058245394, 1058261780,
+    1058278166, 1058294552, 1058310938, 1058327324, 1058343710, 1058360096, 1058376482, 1058392868,
+    1058409254, 1058425640, 1058442026, 1058458412, 1058474798, 1058491184, 1058507570, 1058523957,
+    1058540344, 1058556731, 1058573118, 1058589505, 1058605892, 1058622279, 1058638666, 1058655053,
+    1058671440, 1058687827, 1058704214, 1058720600, 1058736986, 1058753372, 1058769758, 1058786144,
+    1058802530, 1058818916, 1058835302, 1058851688, 1058868074, 1058884460, 1058900846, 1058917232,
+    1058933618, 1058950004, 1058966390, 1058982776, 1058999162, 1059015548, 1059031934, 1059048320,
+    1059064706, 1059081092, 1059097478, 1059113864, 1059130250, 1059146636, 1059163022, 1059179408,
+    1059195794, 1059212180, 1059228566, 1059244952, 1059261338, 1059277724, 1059294110, 1059310496,
+    1059326882, 1059343268, 1059359654, 1059376040, 1059392426, 1059408812, 1059425198, 1059441584,
+    1059457971, 1059474358, 1059490745, 1059507132, 1059523519, 1059539905, 1059556291, 1059572677,
+    1059589063, 1059605449, 1059621835, 1059638221, 1059654607, 1059670993, 1059687379, 1059703765,
+    1059720151, 1059736537, 1059752923, 1059769309, 1059785695, 1059802081, 1059818467, 1059834853,
+    1059851239, 1059867625, 1059884011, 1059900397, 1059916783, 1059933169, 1059949555, 1059965941,
+    1059982327, 1059998713, 1060015099, 1060031485, 1060047871, 1060064257, 1060080643, 1060097029,
+    1060113415, 1060129801, 1060146187, 1060162573, 1060178959, 1060195345, 1060211731, 1060228117,
+    1060244503, 1060260889, 1060277275, 1060293661, 1060310047, 1060326433, 1060342819, 1060359205,
+    1060375591, 1060391977, 1060408363, 1060424749, 1060441135, 1060457521, 1060473907, 1060490293,
+    1060506679, 1060523065, 1060539451, 1060555837, 1060572223, 1060588609, 1060604995, 1060621381,
+    1060637768, 1060654155, 1060670541, 1060686927, 1060703313, 1060719699, 1060736085, 1060752471,
+    1060768857, 1060785243, 1060801629, 1060818015, 1060834401, 1060850787, 1060867173, 1060883559,
+    1060899945, 1060916331, 1060932717, 1060949104, 1060965491, 1060981878, 1060998264, 1061014650,
+    1061031036, 1061047422, 1061063808, 1061080194, 1061096580, 1061112966, 1061129352, 1061145738,
+    1061162124, 1061178510, 1061194896, 1061211282, 1061227668, 1061244054, 1061260440, 1061276826,
+    1061293212, 1061309598, 1061325984, 1061342370, 1061358756, 1061375142, 1061391528, 1061407914,
+    1061424300, 1061440686, 1061457072, 1061473458, 1061489844, 1061506230, 1061522616, 1061539002,
+    1061555388, 1061571774, 1061588160, 1061604546, 1061620932, 1061637318, 1061653704, 1061670090,
+    1061686476, 1061702862, 1061719248, 1061735634, 1061752020, 1061768406, 1061784792, 1061801178,
+    1061817564, 1061833950, 1061850336, 1061866722, 1061883108, 1061899494, 1061915880, 1061932266,
+    1061948652, 1061965038, 1061981424, 1061997810, 1062014196, 1062030582, 1062046968, 1062063354,
+    1062079740, 1062096126, 1062112512, 1062128898, 1062145284, 1062161670, 1062472968, 1062489355,
+    1062505742, 1062522129, 1062538516, 1062554903, 1062571290, 1062587677, 1062604064, 1062620451,
+    1062636838, 1062653225, 1062669612, 1062685999, 1062702386, 1062718773, 1062735160, 1062751547,
+    1062767934, 1062784321, 1062800708, 1062817095, 1062833482, 1062849869, 1062866256, 1062882643,
+    1062899030, 1062915417, 1062931804, 1062948191, 1062964578, 1062980965, 1062997352, 1063013739,
+    1063030126, 1063046513, 1063062900, 1063079287, 1063095674, 1063112061, 1063128448, 1063144835,
+    1063161222, 1063177609, 1063193996, 1063210383, 1063226770, 1063243157, 1063259544, 1063275931,
+    1063292318, 1063308705, 1063325092, 1063341479, 1063357866, 1063374253, 1063390640, 1063407027,
+    1063423414, 1063439801, 1063456188, 1063472575, 1063488962, 1063505349, 1063554504, 1063570891,
+    1063587278, 1063603665, 1063620052, 1063636439, 1063652826, 1063669213, 1063685600, 1063701987,
+    1063718374, 1063734761, 1063751148, 1063767535, 1063783922, 1063800309, 1063816696, 1063833083,
+    1063849470, 1063865857, 1063882244, 1063898631, 1063915018, 1063931405, 1063947792, 1063964179,
+    1063980566, 1063996953, 1064013340, 1064029727, 1064046114, 1064062501, 1064078888, 1064095275,
+    1064111662, 1064128049, 1064144436, 1064160823, 1064177210, 1064193597, 1064209984, 1064226371,
+    1064242758, 1064259145, 1064275532, 1064291919, 1064308306, 1064324693, 1064341080, 1064357467,
+    1064373854, 1064390241, 1064406628, 1064423015, 1065094762, 1065111149, 1065127536, 1065143924,
+    1065160312, 1065176700, 1065193088, 1065209476, 1065225864, 1065242252, 1065258639, 1065275041,
+    1065291433, 1065619117, 1065635502, 1065651887, 1065668272, 1065684657, 1065701042, 1065717427,
+    1065733812, 1065750197, 1065766582, 1066143417, 1066159803, 1066176188, 1066192573, 1066208958,
+    1066225343, 1066241728, 1066258113, 1066274498, 1066290883, 1066307268, 1066323653, 1066340038,
+    1066356423, 1066372808, 1066389193, 1066405578, 1066421963, 1066438348, 1066454733, 1066471118,
+    1066520271, 1066536656, 1066553041, 1066569427, 1066585813, 1066602199, 1066618585, 1066634970,
+    1066651355, 1066667740, 1066684125, 1066700510, 1066733279, 1066749664, 1066766049, 1066782434,
+    1066798819, 1066815204, 1066831589, 1066847974, 1066864359, 1066880744, 1066897129, 1066913514,
+    1066929899, 1066946284, 1066962669, 1066979054, 1066995439, 1067011824, 1067028209, 1067060978,
+    1067077363, 1067093748, 1067110133, 1067192054, 1067208440, 1067224826, 1067257596, 1067290366,
+    1067306752, 1067323138, 1067339524, 1067355910, 1067372296, 1067388682, 1067405068, 1067421454,
+    1067437840, 1067454226, 1067470611, 1067486997, 1067503383, 1067519769, 1067536155, 1067552541,
+    1067568927, 1067585313, 1067601699, 1067618085, 1067634471, 1067650857, 1067667243, 1067683628,
+    1067700013, 1067716398, 1067732783, 1067749168, 1067765553, 1067781938, 1067798323, 1067814708,
+    1067831093, 1067847478, 1067863863, 1067880248, 1067896633, 1067913018, 1067929403, 1067945788,
+    1067962173, 1067978558, 1067994943, 1068011328, 1068027713, 1068044098, 1068060483, 1068076868,
+    1068093253, 1068109638, 1068126023, 1068142408, 1068158793, 1068175178, 1068191563, 1068207948,
+    1068224333, 1068240718, 1068257103, 1068273488, 1068289873, 1068306258, 1068322643, 1068339028,
+    1068355413, 1068371798, 1068388183, 1068404568, 1068420953, 1068437338, 1068453723, 1068470108,
+    1068486493, 1068502878, 1068519263, 1068535648, 1068552033, 1068568418, 1068584803, 1068601188,
+    1068617573, 1068633958, 1068650343, 1068666728, 1068683113, 1068699498, 1068715883, 1068732268,
+    1068748653, 1068765038, 1068781423, 1068797808, 1068814193, 1068830578, 1068846963, 1068863348,
+    1068879733, 1068896118, 1068912503, 1068928888, 1068945273, 1068961658, 1068978043, 1068994428,
+    1069010813, 1069027198, 1069043583, 1069059968, 1069076353, 1069092738, 1069109123, 1069125508,
+    1069141893, 1069158278, 1069174663, 1069191048, 1069207433, 1069223818, 1069240203, 1069256588,
+    1069272973, 1069289358, 1069305743, 1069322128, 1069338513, 1069354898, 1069371283, 1069387670,
+    1069404057, 1069420444, 1069436831, 1069453218, 1069469605, 1069485991, 1069567913, 1069584298,
+    1069600683, 1069617068, 1069633453, 1069649838, 1069666223, 1069682608, 1069698993, 1069715378,
+    1069731763, 1069748148, 1069764533, 1069780918, 1069797303, 1069813688, 1069830073, 1069846458,
+    1069862843, 1069879228, 1069895613, 1069911998, 1069928383, 1069944768, 1069961153, 1069977538,
+    1069993923, 1070010308, 1070026693, 1070043078, 1070059463, 1070075848, 1070092233, 1070108618,
+    1070125003, 1070141388, 1070157773, 1070174158, 1070190543, 1070206928, 1070223313, 1070239698,
+    1070256083, 1070272468, 1070288853, 1070305238, 1070321623, 1070338008, 1070354393, 1070370778,
+    1070387163, 1070403548, 1070419933, 1070436318, 1070452703, 1070469088, 1070485473, 1070501858,
+    1070518243, 1070534628, 1070551013, 1070567398, 1070583783, 1070600168, 1070616553, 1070632938,
+    1070649323, 1070665708, 1070682093, 1070698478, 1070714863, 1070731248, 1070747633, 1070764018,
+    1070780403, 1070796788, 1070813173, 1070829558, 1070845943, 1070862328, 1070878713, 1070895098,
+    1070911483, 1070927868, 1070944253, 1070960638, 1070977023, 1070993408, 1071009793, 1071026178,
+    1071042563, 1071058948, 1071075333, 1071091718, 1071108103, 1071124488, 1071140873, 1071157258,
+    1071173643, 1071190028, 1071206413, 1071222798, 1071239183, 1071255568, 1071271953, 1071288338,
+    1071304723, 1071321108, 1071337493, 1071353878, 1071370263, 1071386648, 1071403033, 1071419418,
+    1071435803, 1071452188, 1071468573, 1071484958, 1071501343, 1071517728, 1071534113, 1071550498,
+    1071566883, 1071583268, 1071599653, 1071616038, 1071632423, 1071648808, 1071665193, 1071681578,
+    1071697963, 1071714348, 1071730733, 1071747118, 1071763503, 1071779888, 1071796273, 1071812658,
+    1071829043, 1071845428, 1071861813, 1071878198, 1071894583, 1071910968, 1071927353, 1071943738,
+    1071960123, 1071976508, 1071992893, 1072009278, 1072025663, 1072042048, 1072058433, 1072074818,
+    1072091203, 1072107588, 1072123973, 1072140358, 1072156743, 1072173128, 1072189513, 1072205898,
+    1072222283, 1072238668, 1072255053, 1072271438, 1072287823, 1072304208, 1072320593, 1072336978,
+    1072353363, 1072369748, 1072386133, 1072402518, 1072418903, 1072435288, 1072451673, 1072468058,
+    1072484443, 1072500828, 1072517213, 1072533598, 1072549983, 1072566368, 1072582753, 1072599138,
+    1072615523, 1072631908, 1072648293, 1072664678, 1072730215, 1072746600, 1072762985, 1072779370,
+    1072795755, 1072812140, 1072861293, 1072877678, 1072894063, 1072910448, 1072926833, 1072943218,
+    1072992371, 1073008756, 1073025141, 1073041526, 1073057911, 1073074296, 1073123449, 1073139834,
+    1073156219, 1073221756, 1073238141, 1073254526, 1073270911, 1073287297, 1073303682, 1073320067,
+    1073352836, 1073369221, 1073385606, 1073401991, 1073418376, 1073434761, 1073451146, 1105219723,
+    1105236108, 1105252493, 1105268878, 1105285263, 1105318032, 1105334417, 1105350802, 1105367187,
+    1105383572, 1105399957, 1105416342, 1105432727, 1105449112, 1105465497, 1105481882, 1105498267,
+    1105514652, 1105531037, 1105547422, 1105563807, 1105580192, 1105596577, 1105612962, 1105629347,
+    1105645732, 1105662117, 1105678502, 1105694887, 1105711272, 1105727657, 1105744042, 1105760427,
+    1105776812, 1105793197, 1105809582, 1105825967, 1105842352, 1105858737, 1105875122, 1105891507,
+    1105907892, 1105924277, 1105940662, 1105957047, 1105973432, 1105989817, 1106022586, 1106038971,
+    1106055356, 1106071741, 1106088126, 1106104511, 1106120896, 1106137281, 1106153666, 1962938563,
+    1962954948, 1962971333, 1962987718, 1963004103, 1963020488, 1963036873, 1963053258, 1963069643,
+    1963086028, 1963102413, 1963118798, 1963135183, 1963151568, 1963167953, 1963184338, 1963200723,
+    1963217108, 1963233493, 1963249878, 1963266263, 1963282648, 1963299033, 1963315418, 1963331803,
+    1963348188, 1963364573, 1963380958, 1963397343, 1963413728, 1963430113, 1963446498, 1963462883,
+    1963479268, 1963495653, 1963512038, 1963528423, 1963544808, 1963561193, 1963577578, 1963593963,
+    1963610348, 1963626733, 1963643118, 1963659503, 1963675888, 1963692273, 1963708658, 1963725043,
+    1963741428, 1963757813, 1963774198, 1963790583, 1963806968, 1963823353, 1963839738, 1963856123,
+    1963872508, 1963888893, 1963905278, 1963921663, 1963938048, 1963954433, 1963970818, 1963987203,
+    1964003588, 1964019973, 1964036358, 1964052743, 1964069128, 1964085513, 1964101898, 1964118283,
+    1964134668, 1964151053, 1964167438, 1964183823, 1964200208, 1964216593, 1964232978, 1964249363,
+    1964265748, 1964282133, 1964298518, 1964314903, 1964347672, 1964364057, 1964380442, 1964396827,
+    1964413212, 1964429597, 1964445982, 1964462367, 1964478752, 1964495137, 1964511522, 1964527907,
+    1964544292, 1964560677, 1964577062, 1964593447, 1964609832, 1964626217, 1964642602, 1964658987,
+    1964675372, 1964691757, 1964708142, 1964724527, 1964740912, 1964757297, 1964773682, 1964790067,
+    1964806452, 1964822837, 1964839222, 1964855607, 1964871992, 1964888377, 1964904762, 1964921147,
+    1964937532, 1964953917, 1964970302, 1964986687, 1965003072, 1965019457, 1965035842, 1965052227,
+    1965068612, 1965084997, 1965101382, 1965117767, 1965134152, 1965150537, 1965166922, 1965183307,
+    1965199692, 1965216077, 1965232462, 1965248847, 1965265232, 1965281617, 1965298002, 1965314387,
+    1965330772, 1965347157, 1965363542, 1965379927, 1965396312, 1965412697, 1965429082, 1965445467,
+    1965461852, 1965478237, 1965494622, 1965527391, 1965543776, 1965592929, 1965642082, 1965658467,
+    1965707620, 1965724005, 1965740390, 1965756775, 1965789544, 1965805929, 1965822314, 1965838699,
+    1965855084, 1965871469, 1965887854, 1965904239, 1965920624, 1965937009, 1965953394, 1965969779,
+    1966002548, 1966035317, 1966051702, 1966068087, 1966084472, 1966100857, 1966117242, 1966133627,
+    1966166396, 1966182781, 1966199166, 1966215551, 1966231936, 1966248321, 1966264706, 1966281091,
+    1966297476, 1966313861, 1966330246, 1966346631, 1966363016, 1966379401, 1966395786, 1966412171,
+    1966428556, 1966444941, 1966461326, 1966477711, 1966494096, 1966510481, 1966526866, 1966543251,
+    1966559636, 1966576021, 1966592406, 1966608791, 1966625176, 1966641561, 1966657946, 1966674331,
+    1966690716, 1966707101, 1966723486, 1966739871, 1966756256, 1966772641, 1966789026, 1966805411,
+    1966821796, 1966838181, 1966854566, 1966870951, 1966887336, 1966903721, 1966920106, 1966936491,
+    1966952876, 1966969261, 1966985646, 1967002031, 1967018416, 1967034801, 1967051186, 1967067571,
+    1967083956, 1967100341, 1967116726, 1967133111, 1967149496, 1967165881, 1967182266, 1967198651,
+    1967215036, 1967247805, 1967264190, 1967280575, 1967296960, 1967346113, 1967362498, 1967378883,
+    1967395268, 1967411653, 1967428038, 1967444423, 1967460808, 1967493577, 1967509962, 1967526347,
+    1967542732, 1967559117, 1967575502, 1967591887, 1967624656, 1967641041, 1967657426, 1967673811,
+    1967690196, 1967706581, 1967722966, 1967739351, 1967755736, 1967772121, 1967788506, 1967804891,
+    1967821276, 1967837661, 1967854046, 1967870431, 1967886816, 1967903201, 1967919586, 1967935971,
+    1967952356, 1967968741, 1967985126, 1968001511, 1968017896, 1968034281, 1968050666, 1968067051,
+    1968099820, 1968116205, 1968132590, 1968148975, 1968181744, 1968198129, 1968214514, 1968230899,
+    1968247284, 1968280053, 1968345590, 1968361975, 1968378360, 1968394745, 1968411130, 1968427515,
+    1968443900, 1968476669, 1968493054, 1968509439, 1968525824, 1968542209, 1968558594, 1968574979,
+    1968591364, 1968607749, 1968624134, 1968640519, 1968656904, 1968673289, 1968689674, 1968706059,
+    1968722444, 1968738829, 1968755214, 1968771599, 1968787984, 1968804369, 1968820754, 1968837139,
+    1968853524, 1968869909, 1968886294, 1968902679, 1968919064, 1968935449, 1968951834, 1968968219,
+    1968984604, 1969000989, 1969017374, 1969033759, 1969050144, 1969066529, 1969082914, 1969099299,
+    1969115684, 1969132069, 1969148454, 1969164839, 1969181224, 1969197609, 1969213994, 1969230379,
+    1969246764, 1969263149, 1969279534, 1969295919, 1969312304, 1969328689, 1969345074, 1969361459,
+    1969377844, 1969394229, 1969410614, 1969426999, 1969443384, 1969459769, 1969476154, 1969492539,
+    1969508924, 1969525309, 1969541694, 1969558079, 1969574464, 1969590849, 1969607234, 1969623619,
+    1969640004, 1969656389, 1969672774, 1969689159, 1969705544, 1969721929, 1969738314, 1969754699,
+    1969771084, 1969787469, 1969803854, 1969820239, 1969836624, 1969853009, 1969869394, 1969885779,
+    1969902164, 1969918549, 1969934934, 1969951319, 1969967704, 1969984089, 1970000474, 1970016859,
+    1970033244, 1970049629, 1970066014, 1970082399, 1970098784, 1970115169, 1970131554, 1970147939,
+    1970164324, 1970180709, 1970197094, 1970213479, 1970229864, 1970246249, 1970262634, 1970279019,
+    1970295404, 1970311789, 1970328174, 1970344559, 1970360944, 1970377329, 1970393714, 1970410099,
+    1970426484, 1970442869, 1970459254, 1970475639, 1970492024, 1970508409, 1970524794, 1970541179,
+    1970557564, 1970573949, 1970590334, 1970606719, 1970623104, 1970639489, 1970655874, 1970672259,
+    1970688644, 1970705029, 1970721414, 1970737799, 1970754184, 1970770569, 1970786954, 1970803339,
+    1970819724, 1970836109, 1970852494, 1970868879, 1970885264, 1970901649, 1970918034, 1970934419,
+    1970950804, 1970967189, 1970983574, 1970999959, 1971016344, 1971032729, 1971049114, 1971065499,
+    1971081884, 1971098269, 1971114654, 1971131039, 1971147424, 1971163809, 1971180194, 1971196579,
+    1971212964, 1971229349, 1971245734, 1971262119, 1971278504, 1971294889, 1971311274, 1971327659,
+    1971344044, 1971360429, 1971376814, 1971393199, 1971409584, 1971425969, 1971442354, 1971458739,
+    1971475124, 1971491509, 1971507894, 1971524279, 1971540664, 1971557049, 1971573434, 1971589819,
+    1971606204, 1971622589, 1971638974, 1971655359, 1971671744, 1971688129, 1971704514, 1971720899,
+    1971737284, 1971753669, 1971770054, 1971786439, 1971802824, 1971819209, 1971835594, 1971851979,
+    1971868364, 1971884749, 1971901134, 1971917519, 1971933904, 1971950289, 1971966674, 1971983059,
+    1971999444, 1972015829, 1972032214, 1972048599, 1972064984, 1972081369, 1972097754, 1972114139,
+    1972130524, 1972146909, 1972163294, 1972179679, 1972196064, 1972212449, 1972228834, 1972245219,
+    1972261604, 1972277989, 1972294374, 1972310759, 1972327144, 1972343529, 1972359914, 1972376299,
+    1972392684, 1972409069, 1972425454, 1972441839, 1972458224, 1972474609, 1972490994, 1972507379,
+    1972523764, 1972540149, 1972556534, 1972572919, 1972589304, 1972605689, 1972622074, 1972638459,
+    1972654844, 1972671229, 1972687614, 1972703999, 1972720384, 1972736769, 1972753154, 1972769539,
+    1972785924, 1972802309, 1972818694, 1972835079, 1972851464, 1972867849, 1972884234, 1972900619,
+    1972917004, 1972933389, 1972949774, 1972966159, 1972982544, 1972998929, 1973015314, 1973031699,
+    1973048084, 1973064469, 1973080854, 1973097239, 1973113624, 1973130009, 1973146394, 1973162779,
+    1973179164, 1973195549, 1973211934, 1973228319, 1973244704, 1973261089, 1973277474, 1973293859,
+    1973310244, 1973326629, 1973343014, 1973359399, 1973375784, 1973392169, 1973408554, 1973424939,
+    1973441324, 1973457709, 1973474094, 1973490479, 1973506864, 1973523249, 1973539634, 1973556019,
+    1973572404, 1973588789, 1973605174, 1973621559, 1973637944, 1973654329, 1973670714, 1973687099,
+    1973703484, 1973719869, 1973736254, 1973752639, 1973769024, 1973785409, 1973801794, 1973818179,
+    1973834564, 1973850949, 1973867334, 1973883719, 1973900104, 1973916489, 1973932874, 1973949259,
+    1973965644, 1973982029, 1973998414, 1974014799, 1974031184, 1974080337, 1974096722, 1974113107,
+    1974129492, 1974145877, 1974162262, 1974178647, 1974195032, 1974211417, 1974227802, 1974244187,
+    1974260572, 1974276957, 1974293342, 1974309727, 1974326112, 1974342497, 1974358882, 1974375267,
+    1974391652, 1974408037, 1974424422, 1974440807, 1974457192, 1974473577, 1974489962, 1974506347,
+    1974522732, 1974539117, 1974555502, 1974571887, 1974588272, 1974604657, 1974621042, 1974637427,
+    1974653812, 1974670197, 1974686582, 1974702967, 1974719352, 1974735737, 1974752122, 1974768507,
+    1974784892, 1974801277, 1974817662, 1974834047, 1974850432, 1974866817, 1974883202, 1974899587,
+    1974915972, 1974932357, 1974948742, 1974965127, 1974981512, 1974997897, 1975014282, 1975030667,
+    1975047052, 1975063437, 1975079822, 1975096207, 1975112592, 1975128977, 1975145362, 1975161747,
+    1975178132, 1975194517, 1975210902, 1975227287, 1975243672, 1975260057, 1975276442, 1975292827,
+    1975309212, 1975325597, 1975341982, 1975358367, 1975374752, 1975391137, 1975407522, 1975423907,
+    1975440292, 1975456677, 1975473062, 1975489447, 1975505832, 1975522217, 1975538602, 1975554987,
+    1975571372, 1975587757, 1975604142, 1975620527, 1975636912, 1975653297, 1975669682, 1975686067,
+    1975702452, 1975718837, 1975735222, 1975751607, 1975767992, 1975784377, 1975800762, 1975817147,
+    1975833532, 1975849917, 1975866302, 1975882687, 1975899072, 1975915457, 1975931842, 1975948227,
+    1975964612, 1975980997, 1975997382, 1976013767, 1976030152, 1976046537, 1976062922, 1976079307,
+    1976095692, 1976112077, 1976128462, 1976144847, 1976161232, 1976177617, 1976194002, 1976210387,
+    1976226772, 1976243157, 1976259542, 1976275927, 1976292312, 1976308697, 1976325082, 1976341467,
+    1976357852, 1976374237, 1976390622, 1976407007, 1976423392, 1976439777, 1976456162, 1976472547,
+    1976488932, 1976505317, 1976521702, 1976538087, 1976554472, 1976570857, 1976587242, 1976603627,
+    1976620012, 1976636397, 1976652782, 1976669167, 1976685552, 1976701937, 1976718322, 1976734707,
+    1976751092, 1976767477, 1976783862, 1976800247, 1976816632, 1976833017, 1976849402, 1976865787,
+    1976882172, 1976898557, 1976914942, 1976931327, 1976947712, 1976964097, 1976980482, 1976996867,
+    1977013252, 1977029637, 1977046022, 1977062407, 1977078792, 1977095177, 1977111562, 1977127947,
+    1977144332, 1977160717, 1977177102, 1977193487, 1977209872, 1977226257, 1977242642, 1977259027,
+    1977275412, 1977291797, 1977308182, 1977324567, 1977340952, 1977357337, 1977373722, 1977390107,
+    1977406492, 1977422877, 1977439262, 1977455647, 1977472032, 1977488417, 1977504802, 1977521187,
+    1977537572, 1977553957, 1977570342, 1977586727, 1977603112, 1977619497, 1977635882, 1977652267,
+    1977668652, 1977685037, 1977701422, 1977717807, 1977734192, 1977750577, 1977766962, 1977783347,
+    1977799732, 1977816117, 1977832502, 1977848887, 1977865272, 1977881657, 1977898042, 1977914427,
+    1977930812, 1977947197, 1977963582, 1977979967, 1977996352, 1978012737, 1978029122, 1978045507,
+    1978061892, 1978078277, 1978094662, 1978111047, 1978127432, 1978143817, 1978160202, 1978176587,
+    1978192972, 1978209357, 1978225742, 1978242127, 1978258512, 1978274897, 1978291282, 1978307667,
+    1978324052, 1978340437, 1978356822, 1978373207, 1978389592, 1978405977, 1978422362, 1978438747,
+    1978455132, 1978471517, 1978487902, 1978504287, 1978520672, 1978537057, 1978553442, 1978569827,
+    1978586212, 1978602597, 1978618982, 1978635367, 1978651752, 1978668137, 1978684522, 1978700907,
+    1978717292, 1978733677, 1978750062, 1978766447, 1978782832, 1978799217, 1978815602, 1978831987,
+    1978848372, 1978897525, 1978913910, 1978930295, 1978946680, 1978963065, 1978979450, 1978995835,
+    1979012220, 1979028605, 1979044990, 1979061375, 1979077760, 1979094145, 1979110530, 1979126915,
+    1979143300, 1979159685, 1979176070, 1979192455, 1979208840, 1979225225, 1979241610, 1979257995,
+    1979274380, 1979290765, 1979307150, 1979323535, 1979339920, 1979356305, 1979372690, 1979389075,
+    1979405460, 1979421845, 1979438230, 1979454615, 1979471000, 1979487385, 1979503770, 1979520155,
+    1979536540, 1979552925, 1979569310, 1979585695, 1979602080, 1979618465, 1979634850, 1979651235,
+    1979667620, 1979684005, 1979700390, 2071991463, 2072007848, 2072024233, 2072040618, 2072073387,
+    2072089772, 2072106157, 2072122542, 2072138927, 2072155312, 2072171697, 2072188082, 2072204467,
+    2072220852, 2072237237, 2072253622, 2072270007, 2072286392, 2072302777, 2072319162, 2072335547,
+    2072351932, 2072368317, 2072384702, 2072401087, 2072417472, 2072433857, 2072450242, 2072466627,
+    2072483012, 2072499397, 2072532166, 2072548551, 2072581320, 2072630473, 2072663242, 2072679627,
+    2072696012, 2072712397, 2072728782, 2072745167, 2072761552, 2072777937, 2072794322, 2072810707,
+    2072843476, 2072859861, 2072876246, 2072892631, 2072925400, 2072958169, 2073072858, 2073154779,
+    2073187548, 2073220317, 2073253086, 2073269471, 2073285856, 2073318625, 2073335010, 2073367779,
+    2073416932, 2073449701, 2073482470, 2073515239, 2073548008, 2073580777, 2073597162, 2073629931,
+    2073679084, 2073695469, 2073711854, 2073728239, 2073761008, 2073777393, 2073793778, 2073810163,
+    2073826548, 2073842933, 2073859318, 2073892087, 2073908472, 2073924857, 2073941242, 2073974011,
+    2073990396, 2074006781, 2074023166, 2074055935, 2074088704, 2074105089, 2074121474, 2074137859,
+    2074154244, 2074170629, 2074187014, 2074203399, 2074219784, 2074236169, 2074268938, 2074285323,
+    2074301708, 2074318093, 2074334478, 2074350863, 2074367248, 2074383633, 2074400018, 2074416403,
+    2074432788, 2074449173, 2074465558, 2074481943, 2074498328, 2074514713, 2074531098, 2074629403,
+    2074645788, 2074662173, 2074694942, 2074711327, 2074727712, 2074744097, 2074760482, 2074793251,
+    2074809636, 2074826021, 2074842406, 2074858791, 2074875176, 2074891561, 2074907946, 2074924331,
+    2074940716, 2074957101, 2074973486, 2074989871, 2075006256, 2075022641, 2075039026, 2075055411,
+    2084574516, 2084590902, 2084607288, 2084623674, 2084640060, 2084656446, 2084672832, 2084689218,
+    2084705604, 2084721990, 2084738376, 2084836682, 2084853069, 2084869456, 2084885843, 2084902230,
+    2084918617, 2084935004, 2084951391, 2084967778, 2084984165, 2085000552, 2085016939, 2085033326,
+    2085049713, 2085066100, 2085082487, 2085098874, 2085115261, 2085131648, 2085148035, 2085164422,
+    2085180809, 2085197196, 2085213583, 2085229970, 2085246357, 2085262744, 2085279131, 2085295516,
+    2085311901, 2085328287, 2085361057, 2085377442, 2085393827, 2085410212, 2085426597, 2085442982,
+    2085459367, 2085475752, 2085492137, 2085508522, 2085524907, 2085541292, 2085557677, 2085574062,
+    2085590447, 2085606832, 2085623217, 2085639602, 2085655987, 2085672372, 2085688757, 2085705142,
+    2085721527, 2085737912, 2085754297, 2085770682, 2085787067, 2085803453, 2085819839, 2085836225,
+    2085852611, 2085868998, 2086311368, 2086327754, 2086344140, 2086933966, 2088768976, 2088785362,
+    2088801748, 2089031125, 2089047510, 2089063895, 2089080280, 2089096666, 2089113051, 2089129436,
+    2089145821, 2089162206, 2089178591, 2089194976, 2089211361, 2089227746, 2089244131, 2089260516,
+    2089276901, 2089293286, 2089309671, 2089326056, 2089342441, 2089358826, 2089375211, 2089391596,
+    2089407981, 2089424366, 2089440751, 2089457136, 2089473521, 2089489906, 2089506291, 2089522676,
+    2089539061, 2089555446, 2089571831, 2089588216, 2089604601, 2089620986, 2089637371, 2089653756,
+    2089670141, 2089686526, 2089702911, 2089719296, 2089735681, 2089817602, 2089833989, 2089850376,
+    2089866763, 2089883150, 2089899537, 2089915924, 2089932311, 2089948698, 2090079773, 2090096158,
+    2130449951, 2130466336, 2130482721, 2130499106, 2130515491, 2130531876, 2130548261, 2130564646,
+    2130581031, 2130597416, 3221231145,
+};
+
+template <class T>
+const std::uint32_t _unicode_data<T>::compat_pool[] = {
+    32, 32, 776, 97, 32, 772, 50, 51, 32, 769, 956, 32, 807, 49, 111, 49, 8260, 52, 49, 8260, 50,
+    51, 8260, 52, 73, 74, 105, 106, 76, 183, 108, 183, 700, 110, 115, 68, 90, 780, 68, 122, 780,
+    100, 122, 780, 76, 74, 76, 106, 108, 106, 78, 74, 78, 106, 110, 106, 68, 90, 68, 122, 100, 122,
+    104, 614, 106, 114, 633, 635, 641, 119, 121, 32, 774, 32, 775, 32, 778, 32, 808, 32, 771, 32,
+    779, 611, 108, 115, 120, 661, 32, 837, 32, 769, 32, 776, 769, 946, 952, 933, 933, 769, 933, 776,
+    966, 960, 954, 961, 962, 920, 949, 931, 1381, 1410, 1575, 1652, 1608, 1652, 1735, 1652, 1610,
+    1652, 3661, 3634, 3789, 3762, 3755, 3737, 3755, 3745, 3851, 4018, 3953, 3968, 4019, 3953, 3968,
+    4316, 65, 198, 66, 68, 69, 398, 71, 72, 73, 74, 75, 76, 77, 78, 79, 546, 80, 82, 84, 85, 87, 97,
+    592, 593, 7426, 98, 100, 101, 601, 603, 604, 103, 107, 109, 331, 111, 596, 7446, 7447, 112, 116,
+    117, 7453, 623, 118, 7461, 946, 947, 948, 966, 967, 105, 114, 117, 118, 946, 947, 961, 966, 967,
+    1085, 594, 99, 597, 240, 604, 102, 607, 609, 613, 616, 617, 618, 7547, 669, 621, 7557, 671, 625,
+    624, 626, 627, 628, 629, 632, 642, 643, 427, 649, 650, 7452, 651, 652, 122, 656, 657, 658, 952,
+    97, 702, 115, 775, 32, 787, 32, 787, 32, 834, 32, 776, 834, 32, 787, 768, 32, 787, 769, 32, 787,
+    834, 32, 788, 768, 32, 788, 769, 32, 788, 834, 32, 776, 768, 32, 776, 769, 32, 769, 32, 788, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 8208, 32, 819, 46, 46, 46, 46, 46, 46, 32, 8242, 8242,
+    8242, 8242, 8242, 8245, 8245, 8245, 8245, 8245, 33, 33, 32, 773, 63, 63, 63, 33, 33, 63, 8242,
+    8242, 8242, 8242, 32, 48, 105, 52, 53, 54, 55, 56, 57, 43, 8722, 61, 40, 41, 110, 48, 49, 50,
+    51, 52, 53, 54, 55, 56, 57, 43, 8722, 61, 40, 41, 97, 101, 111, 120, 601, 104, 107, 108, 109,
+    110, 112, 115, 116, 82, 115, 97, 47, 99, 97, 47, 115, 67, 176, 67, 99, 47, 111, 99, 47, 117,
+    400, 176, 70, 103, 72, 72, 72, 104, 295, 73, 73, 76, 108, 78, 78, 111, 80, 81, 82, 82, 82, 83,
+    77, 84, 69, 76, 84, 77, 90, 90, 66, 67, 101, 69, 70, 77, 111, 1488, 1489, 1490, 1491, 105, 70,
+    65, 88, 960, 947, 915, 928, 8721, 68, 100, 101, 105, 106, 49, 8260, 55, 49, 8260, 57, 49, 8260,
+    49, 48, 49, 8260, 51, 50, 8260, 51, 49, 8260, 53, 50, 8260, 53, 51, 8260, 53, 52, 8260, 53, 49,
+    8260, 54, 53, 8260, 54, 49, 8260, 56, 51, 8260, 56, 53, 8260, 56, 55, 8260, 56, 49, 8260, 73,
+    73, 73, 73, 73, 73, 73, 86, 86, 86, 73, 86, 73, 73, 86, 73, 73, 73, 73, 88, 88, 88, 73, 88, 73,
+    73, 76, 67, 68, 77, 105, 105, 105, 105, 105, 105, 105, 118, 118, 118, 105, 118, 105, 105, 118,
+    105, 105, 105, 105, 120, 120, 120, 105, 120, 105, 105, 108, 99, 100, 109, 48, 8260, 51, 8747,
+    8747, 8747, 8747, 8747, 8750, 8750, 8750, 8750, 8750, 49, 50, 51, 52, 53, 54, 55, 56, 57, 49,
+    48, 49, 49, 49, 50, 49, 51, 49, 52, 49, 53, 49, 54, 49, 55, 49, 56, 49, 57, 50, 48, 40, 49, 41,
+    40, 50, 41, 40, 51, 41, 40, 52, 41, 40, 53, 41, 40, 54, 41, 40, 55, 41, 40, 56, 41, 40, 57, 41,
+    40, 49, 48, 41, 40, 49, 49, 41, 40, 49, 50, 41, 40, 49, 51, 41, 40, 49, 52, 41, 40, 49, 53, 41,
+    40, 49, 54, 41, 40, 49, 55, 41, 40, 49, 56, 41, 40, 49, 57, 41, 40, 50, 48, 41, 49, 46, 50, 46,
+    51, 46, 52, 46, 53, 46, 54, 46, 55, 46, 56, 46, 57, 46, 49, 48, 46, 49, 49, 46, 49, 50, 46, 49,
+    51, 46, 49, 52, 46, 49, 53, 46, 49, 54, 46, 49, 55, 46, 49, 56, 46, 49, 57, 46, 50, 48, 46, 40,
+    97, 41, 40, 98, 41, 40, 99, 41, 40, 100, 41, 40, 101, 41, 40, 102, 41, 40, 103, 41, 40, 104, 41,
+    40, 105, 41, 40, 106, 41, 40, 107, 41, 40, 108, 41, 40, 109, 41, 40, 110, 41, 40, 111, 41, 40,
+    112, 41, 40, 113, 41, 40, 114, 41, 40, 115, 41, 40, 116, 41, 40, 117, 41, 40, 118, 41, 40, 119,
+    41, 40, 120, 41, 40, 121, 41, 40, 122, 41, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+    78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 97, 98, 99, 100, 101, 102, 103, 104, 105,
+    106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 48, 8747,
+    8747, 8747, 8747, 58, 58, 61, 61, 61, 61, 61, 61, 106, 86, 11617, 27597, 40863, 19968, 20008,
+    20022, 20031, 20057, 20101, 20108, 20128, 20154, 20799, 20837, 20843, 20866, 20886, 20907,
+    20960, 20981, 20992, 21147, 21241, 21269, 21274, 21304, 21313, 21340, 21353, 21378, 21430,
+    21448, 21475, 22231, 22303, 22763, 22786, 22794, 22805, 22823, 22899, 23376, 23424, 23544,
+    23567, 23586, 23608, 23662, 23665, 24027, 24037, 24049, 24062, 24178, 24186, 24191, 24308,
+    24318, 24331, 24339, 24400, 24417, 24435, 24515, 25096, 25142, 25163, 25903, 25908, 25991,
+    26007, 26020, 26041, 26080, 26085, 26352, 26376, 26408, 27424, 27490, 27513, 27571, 27595,
+    27604, 27611, 27663, 27668, 27700, 28779, 29226, 29238, 29243, 29247, 29255, 29273, 29275,
+    29356, 29572, 29577, 29916, 29926, 29976, 29983, 29992, 30000, 30091, 30098, 30326, 30333,
+    30382, 30399, 30446, 30683, 30690, 30707, 31034, 31160, 31166, 31348, 31435, 31481, 31859,
+    31992, 32566, 32593, 32650, 32701, 32769, 32780, 32786, 32819, 32895, 32905, 33251, 33258,
+    33267, 33276, 33292, 33307, 33311, 33390, 33394, 33400, 34381, 34411, 34880, 34892, 34915,
+    35198, 35211, 35282, 35328, 35895, 35910, 35925, 35960, 35997, 36196, 36208, 36275, 36523,
+    36554, 36763, 36784, 36789, 37009, 37193, 37318, 37324, 37329, 38263, 38272, 38428, 38582,
+    38585, 38632, 38737, 38750, 38754, 38761, 38859, 38893, 38899, 38913, 39080, 39131, 39135,
+    39318, 39321, 39340, 39592, 39640, 39647, 39717, 39727, 39730, 39740, 39770, 40165, 40565,
+    40575, 40613, 40635, 40643, 40653, 40657, 40697, 40701, 40718, 40723, 40736, 40763, 40778,
+    40786, 40845, 40860, 40864, 32, 12306, 21313, 21316, 21317, 32, 12441, 32, 12442, 12424, 12426,
+    12467, 12488, 4352, 4353, 4522, 4354, 4524, 4525, 4355, 4356, 4357, 4528, 4529, 4530, 4531,
+    4532, 4533, 4378, 4358, 4359, 4360, 4385, 4361, 4362, 4363, 4364, 4365, 4366, 4367, 4368, 4369,
+    4370, 4449, 4450, 4451, 4452, 4453, 4454, 4455, 4456, 4457, 4458, 4459, 4460, 4461, 4462, 4463,
+    4464, 4465, 4466, 4467, 4468, 4469, 4448, 4372, 4373, 4551, 4552, 4556, 4558, 4563, 4567, 4569,
+    4380, 4573, 4575, 4381, 4382, 4384, 4386, 4387, 4391, 4393, 4395, 4396, 4397, 4398, 4399, 4402,
+    4406, 4416, 4423, 4428, 4593, 4594, 4439, 4440, 4441, 4484, 4485, 4488, 4497, 4498, 4500, 4510,
+    4513, 19968, 20108, 19977, 22235, 19978, 20013, 19979, 30002, 20057, 19993, 19969, 22825, 22320,
+    20154, 40, 4352, 41, 40, 4354, 41, 40, 4355, 41, 40, 4357, 41, 40, 4358, 41, 40, 4359, 41, 40,
+    4361, 41, 40, 4363, 41, 40, 4364, 41, 40, 4366, 41, 40, 4367, 41, 40, 4368, 41, 40, 4369, 41,
+    40, 4370, 41, 40, 4352, 4449, 41, 40, 4354, 4449, 41, 40, 4355, 4449, 41, 40, 4357, 4449, 41,
+    40, 4358, 4449, 41, 40, 4359, 4449, 41, 40, 4361, 4449, 41, 40, 4363, 4449, 41, 40, 4364, 4449,
+    41, 40, 4366, 4449, 41, 40, 4367, 4449, 41, 40, 4368, 4449, 41, 40, 4369, 4449, 41, 40, 4370,
+    4449, 41, 40, 4364, 4462, 41, 40, 4363, 4457, 4364, 4453, 4523, 41, 40, 4363, 4457, 4370, 4462,
+    41, 40, 19968, 41, 40, 20108, 41, 40, 19977, 41, 40, 22235, 41, 40, 20116, 41, 40, 20845, 41,
+    40, 19971, 41, 40, 20843, 41, 40, 20061, 41, 40, 21313, 41, 40, 26376, 41, 40, 28779, 41, 40,
+    27700, 41, 40, 26408, 41, 40, 37329, 41, 40, 22303, 41, 40, 26085, 41, 40, 26666, 41, 40, 26377,
+    41, 40, 31038, 41, 40, 21517, 41, 40, 29305, 41, 40, 36001, 41, 40, 31069, 41, 40, 21172, 41,
+    40, 20195, 41, 40, 21628, 41, 40, 23398, 41, 40, 30435, 41, 40, 20225, 41, 40, 36039, 41, 40,
+    21332, 41, 40, 31085, 41, 40, 20241, 41, 40, 33258, 41, 40, 33267, 41, 21839, 24188, 25991,
+    31631, 80, 84, 69, 50, 49, 50, 50, 50, 51, 50, 52, 50, 53, 50, 54, 50, 55, 50, 56, 50, 57, 51,
+    48, 51, 49, 51, 50, 51, 51, 51, 52, 51, 53, 4352, 4354, 4355, 4357, 4358, 4359, 4361, 4363,
+    4364, 4366, 4367, 4368, 4369, 4370, 4352, 4449, 4354, 4449, 4355, 4449, 4357, 4449, 4358, 4449,
+    4359, 4449, 4361, 4449, 4363, 4449, 4364, 4449, 4366, 4449, 4367, 4449, 4368, 4449, 4369, 4449,
+    4370, 4449, 4366, 4449, 4535, 4352, 4457, 4364, 4462, 4363, 4468, 4363, 4462, 19968, 20108,
+    19977, 22235, 20116, 20845, 19971, 20843, 20061, 21313, 26376, 28779, 27700, 26408, 37329,
+    22303, 26085, 26666, 26377, 31038, 21517, 29305, 36001, 31069, 21172, 31192, 30007, 22899,
+    36969, 20778, 21360, 27880, 38917, 20241, 20889, 27491, 19978, 20013, 19979, 24038, 21491,
+    21307, 23447, 23398, 30435, 20225, 36039, 21332, 22812, 51, 54, 51, 55, 51, 56, 51, 57, 52, 48,
+    52, 49, 52, 50, 52, 51, 52, 52, 52, 53, 52, 54, 52, 55, 52, 56, 52, 57, 53, 48, 49, 26376, 50,
+    26376, 51, 26376, 52, 26376, 53, 26376, 54, 26376, 55, 26376, 56, 26376, 57, 26376, 49, 48,
+    26376, 49, 49, 26376, 49, 50, 26376, 72, 103, 101, 114, 103, 101, 86, 76, 84, 68, 12450, 12452,
+    12454, 12456, 12458, 12459, 12461, 12463, 12465, 12467, 12469, 12471, 12473, 12475, 12477,
+    12479, 12481, 12484, 12486, 12488, 12490, 12491, 12492, 12493, 12494, 12495, 12498, 12501,
+    12504, 12507, 12510, 12511, 12512, 12513, 12514, 12516, 12518, 12520, 12521, 12522, 12523,
+    12524, 12525, 12527, 12528, 12529, 12530, 20196, 21644, 12450, 12495, 12442, 12540, 12488,
+    12450, 12523, 12501, 12449, 12450, 12531, 12504, 12442, 12450, 12450, 12540, 12523, 12452,
+    12491, 12531, 12463, 12441, 12452, 12531, 12481, 12454, 12457, 12531, 12456, 12473, 12463,
+    12540, 12488, 12441, 12456, 12540, 12459, 12540, 12458, 12531, 12473, 12458, 12540, 12512,
+    12459, 12452, 12522, 12459, 12521, 12483, 12488, 12459, 12525, 12522, 12540, 12459, 12441,
+    12525, 12531, 12459, 12441, 12531, 12510, 12461, 12441, 12459, 12441, 12461, 12441, 12491,
+    12540, 12461, 12517, 12522, 12540, 12461, 12441, 12523, 12479, 12441, 12540, 12461, 12525,
+    12461, 12525, 12463, 12441, 12521, 12512, 12461, 12525, 12513, 12540, 12488, 12523, 12461,
+    12525, 12527, 12483, 12488, 12463, 12441, 12521, 12512, 12463, 12441, 12521, 12512, 12488,
+    12531, 12463, 12523, 12475, 12441, 12452, 12525, 12463, 12525, 12540, 12493, 12465, 12540,
+    12473, 12467, 12523, 12490, 12467, 12540, 12507, 12442, 12469, 12452, 12463, 12523, 12469,
+    12531, 12481, 12540, 12512, 12471, 12522, 12531, 12463, 12441, 12475, 12531, 12481, 12475,
+    12531, 12488, 12479, 12441, 12540, 12473, 12486, 12441, 12471, 12488, 12441, 12523, 12488,
+    12531, 12490, 12494, 12494, 12483, 12488, 12495, 12452, 12484, 12495, 12442, 12540, 12475,
+    12531, 12488, 12495, 12442, 12540, 12484, 12495, 12441, 12540, 12524, 12523, 12498, 12442,
+    12450, 12473, 12488, 12523, 12498, 12442, 12463, 12523, 12498, 12442, 12467, 12498, 12441,
+    12523, 12501, 12449, 12521, 12483, 12488, 12441, 12501, 12451, 12540, 12488, 12501, 12441,
+    12483, 12471, 12455, 12523, 12501, 12521, 12531, 12504, 12463, 12479, 12540, 12523, 12504,
+    12442, 12477, 12504, 12442, 12491, 12498, 12504, 12523, 12484, 12504, 12442, 12531, 12473,
+    12504, 12442, 12540, 12471, 12441, 12504, 12441, 12540, 12479, 12507, 12442, 12452, 12531,
+    12488, 12507, 12441, 12523, 12488, 12507, 12531, 12507, 12442, 12531, 12488, 12441, 12507,
+    12540, 12523, 12507, 12540, 12531, 12510, 12452, 12463, 12525, 12510, 12452, 12523, 12510,
+    12483, 12495, 12510, 12523, 12463, 12510, 12531, 12471, 12519, 12531, 12511, 12463, 12525,
+    12531, 12511, 12522, 12511, 12522, 12495, 12441, 12540, 12523, 12513, 12459, 12441, 12513,
+    12459, 12441, 12488, 12531, 12513, 12540, 12488, 12523, 12516, 12540, 12488, 12441, 12516,
+    12540, 12523, 12518, 12450, 12531, 12522, 12483, 12488, 12523, 12522, 12521, 12523, 12498,
+    12442, 12540, 12523, 12540, 12501, 12441, 12523, 12524, 12512, 12524, 12531, 12488, 12465,
+    12441, 12531, 12527, 12483, 12488, 48, 28857, 49, 28857, 50, 28857, 51, 28857, 52, 28857, 53,
+    28857, 54, 28857, 55, 28857, 56, 28857, 57, 28857, 49, 48, 28857, 49, 49, 28857, 49, 50, 28857,
+    49, 51, 28857, 49, 52, 28857, 49, 53, 28857, 49, 54, 28857, 49, 55, 28857, 49, 56, 28857, 49,
+    57, 28857, 50, 48, 28857, 50, 49, 28857, 50, 50, 28857, 50, 51, 28857, 50, 52, 28857, 104, 80,
+    97, 100, 97, 65, 85, 98, 97, 114, 111, 86, 112, 99, 100, 109, 100, 109, 50, 100, 109, 51, 73,
+    85, 24179, 25104, 26157, 21644, 22823, 27491, 26126, 27835, 26666, 24335, 20250, 31038, 112, 65,
+    110, 65, 956, 65, 109, 65, 107, 65, 75, 66, 77, 66, 71, 66, 99, 97, 108, 107, 99, 97, 108, 112,
+    70, 110, 70, 956, 70, 956, 103, 109, 103, 107, 103, 72, 122, 107, 72, 122, 77, 72, 122, 71, 72,
+    122, 84, 72, 122, 956, 108, 109, 108, 100, 108, 107, 108, 102, 109, 110, 109, 956, 109, 109,
+    109, 99, 109, 107, 109, 109, 109, 50, 99, 109, 50, 109, 50, 107, 109, 50, 109, 109, 51, 99, 109,
+    51, 109, 51, 107, 109, 51, 109, 8725, 115, 109, 8725, 115, 50, 80, 97, 107, 80, 97, 77, 80, 97,
+    71, 80, 97, 114, 97, 100, 114, 97, 100, 8725, 115, 114, 97, 100, 8725, 115, 50, 112, 115, 110,
+    115, 956, 115, 109, 115, 112, 86, 110, 86, 956, 86, 109, 86, 107, 86, 77, 86, 112, 87, 110, 87,
+    956, 87, 109, 87, 107, 87, 77, 87, 107, 937, 77, 937, 97, 46, 109, 46, 66, 113, 99, 99, 99, 100,
+    67, 8725, 107, 103, 67, 111, 46, 100, 66, 71, 121, 104, 97, 72, 80, 105, 110, 75, 75, 75, 77,
+    107, 116, 108, 109, 108, 110, 108, 111, 103, 108, 120, 109, 98, 109, 105, 108, 109, 111, 108,
+    80, 72, 112, 46, 109, 46, 80, 80, 77, 80, 82, 115, 114, 83, 118, 87, 98, 86, 8725, 109, 65,
+    8725, 109, 49, 26085, 50, 26085, 51, 26085, 52, 26085, 53, 26085, 54, 26085, 55, 26085, 56,
+    26085, 57, 26085, 49, 48, 26085, 49, 49, 26085, 49, 50, 26085, 49, 51, 26085, 49, 52, 26085, 49,
+    53, 26085, 49, 54, 26085, 49, 55, 26085, 49, 56, 26085, 49, 57, 26085, 50, 48, 26085, 50, 49,
+    26085, 50, 50, 26085, 50, 51, 26085, 50, 52, 26085, 50, 53, 26085, 50, 54, 26085, 50, 55, 26085,
+    50, 56, 26085, 50, 57, 26085, 51, 48, 26085, 51, 49, 26085, 103, 97, 108, 1098, 1100, 42863, 67,
+    70, 81, 294, 339, 42791, 43831, 619, 43858, 653, 102, 102, 102, 105, 102, 108, 102, 102, 105,
+    102, 102, 108, 115, 116, 115, 116, 1396, 1398, 1396, 1381, 1396, 1387, 1406, 1398, 1396, 1389,
+    1506, 1488, 1491, 1492, 1499, 1500, 1501, 1512, 1514, 43, 1488, 1500, 1649, 1649, 1659, 1659,
+    1659, 1659, 1662, 1662, 1662, 1662, 1664, 1664, 1664, 1664, 1658, 1658, 1658, 1658, 1663, 1663,
+    1663, 1663, 1657, 1657, 1657, 1657, 1700, 1700, 1700, 1700, 1702, 1702, 1702, 1702, 1668, 1668,
+    1668, 1668, 1667, 1667, 1667, 1667, 1670, 1670, 1670, 1670, 1671, 1671, 1671, 1671, 1677, 1677,
+    1676, 1676, 1678, 1678, 1672, 1672, 1688, 1688, 1681, 1681, 1705, 1705, 1705, 1705, 1711, 1711,
+    1711, 1711, 1715, 1715, 1715, 1715, 1713, 1713, 1713, 1713, 1722, 1722, 1723, 1723, 1723, 1723,
+    1749, 1620, 1749, 1620, 1729, 1729, 1729, 1729, 1726, 1726, 1726, 1726, 1746, 1746, 1746, 1620,
+    1746, 1620, 1709, 1709, 1709, 1709, 1735, 1735, 1734, 1734, 1736, 1736, 1735, 1652, 1739, 1739,
+    1733, 1733, 1737, 1737, 1744, 1744, 1744, 1744, 1609, 1609, 1610, 1620, 1575, 1610, 1620, 1575,
+    1610, 1620, 1749, 1610, 1620, 1749, 1610, 1620, 1608, 1610, 1620, 1608, 1610, 1620, 1735, 1610,
+    1620, 1735, 1610, 1620, 1734, 1610, 1620, 1734, 1610, 1620, 1736, 1610, 1620, 1736, 1610, 1620,
+    1744, 1610, 1620, 1744, 1610, 1620, 1744, 1610, 1620, 1609, 1610, 1620, 1609, 1610, 1620, 1609,
+    1740, 1740, 1740, 1740, 1610, 1620, 1580, 1610, 1620, 1581, 1610, 1620, 1605, 1610, 1620, 1609,
+    1610, 1620, 1610, 1576, 1580, 1576, 1581, 1576, 1582, 1576, 1605, 1576, 1609, 1576, 1610, 1578,
+    1580, 1578, 1581, 1578, 1582, 1578, 1605, 1578, 1609, 1578, 1610, 1579, 1580, 1579, 1605, 1579,
+    1609, 1579, 1610, 1580, 1581, 1580, 1605, 1581, 1580, 1581, 1605, 1582, 1580, 1582, 1581, 1582,
+    1605, 1587, 1580, 1587, 1581, 1587, 1582, 1587, 1605, 1589, 1581, 1589, 1605, 1590, 1580, 1590,
+    1581, 1590, 1582, 1590, 1605, 1591, 1581, 1591, 1605, 1592, 1605, 1593, 1580, 1593, 1605, 1594,
+    1580, 1594, 1605, 1601, 1580, 1601, 1581, 1601, 1582, 1601, 1605, 1601, 1609, 1601, 1610, 1602,
+    1581, 1602, 1605, 1602, 1609, 1602, 1610, 1603, 1575, 1603, 1580, 1603, 1581, 1603, 1582, 1603,
+    1604, 1603, 1605, 1603, 1609, 1603, 1610, 1604, 1580, 1604, 1581, 1604, 1582, 1604, 1605, 1604,
+    1609, 1604, 1610, 1605, 1580, 1605, 1581, 1605, 1582, 1605, 1605, 1605, 1609, 1605, 1610, 1606,
+    1580, 1606, 1581, 1606, 1582, 1606, 1605, 1606, 1609, 1606, 1610, 1607, 1580, 1607, 1605, 1607,
+    1609, 1607, 1610, 1610, 1580, 1610, 1581, 1610, 1582, 1610, 1605, 1610, 1609, 1610, 1610, 1584,
+    1648, 1585, 1648, 1609, 1648, 32, 1612, 1617, 32, 1613, 1617, 32, 1614, 1617, 32, 1615, 1617,
+    32, 1616, 1617, 32, 1617, 1648, 1610, 1620, 1585, 1610, 1620, 1586, 1610, 1620, 1605, 1610,
+    1620, 1606, 1610, 1620, 1609, 1610, 1620, 1610, 1576, 1585, 1576, 1586, 1576, 1605, 1576, 1606,
+    1576, 1609, 1576, 1610, 1578, 1585, 1578, 1586, 1578, 1605, 1578, 1606, 1578, 1609, 1578, 1610,
+    1579, 1585, 1579, 1586, 1579, 1605, 1579, 1606, 1579, 1609, 1579, 1610, 1601, 1609, 1601, 1610,
+    1602, 1609, 1602, 1610, 1603, 1575, 1603, 1604, 1603, 1605, 1603, 1609, 1603, 1610, 1604, 1605,
+    1604, 1609, 1604, 1610, 1605, 1575, 1605, 1605, 1606, 1585, 1606, 1586, 1606, 1605, 1606, 1606,
+    1606, 1609, 1606, 1610, 1609, 1648, 1610, 1585, 1610, 1586, 1610, 1605, 1610, 1606, 1610, 1609,
+    1610, 1610, 1610, 1620, 1580, 1610, 1620, 1581, 1610, 1620, 1582, 1610, 1620, 1605, 1610, 1620,
+    1607, 1576, 1580, 1576, 1581, 1576, 1582, 1576, 1605, 1576, 1607, 1578, 1580, 1578, 1581, 1578,
+    1582, 1578, 1605, 1578, 1607, 1579, 1605, 1580, 1581, 1580, 1605, 1581, 1580, 1581, 1605, 1582,
+    1580, 1582, 1605, 1587, 1580, 1587, 1581, 1587, 1582, 1587, 1605, 1589, 1581, 1589, 1582, 1589,
+    1605, 1590, 1580, 1590, 1581, 1590, 1582, 1590, 1605, 1591, 1581, 1592, 1605, 1593, 1580, 1593,
+    1605, 1594, 1580, 1594, 1605, 1601, 1580, 1601, 1581, 1601, 1582, 1601, 1605, 1602, 1581, 1602,
+    1605, 1603, 1580, 1603, 1581, 1603, 1582, 1603, 1604, 1603, 1605, 1604, 1580, 1604, 1581, 1604,
+    1582, 1604, 1605, 1604, 1607, 1605, 1580, 1605, 1581, 1605, 1582, 1605, 1605, 1606, 1580, 1606,
+    1581, 1606, 1582, 1606, 1605, 1606, 1607, 1607, 1580, 1607, 1605, 1607, 1648, 1610, 1580, 1610,
+    1581, 1610, 1582, 1610, 1605, 1610, 1607, 1610, 1620, 1605, 1610, 1620, 1607, 1576, 1605, 1576,
+    1607, 1578, 1605, 1578, 1607, 1579, 1605, 1579, 1607, 1587, 1605, 1587, 1607, 1588, 1605, 1588,
+    1607, 1603, 1604, 1603, 1605, 1604, 1605, 1606, 1605, 1606, 1607, 1610, 1605, 1610, 1607, 1600,
+    1614, 1617, 1600, 1615, 1617, 1600, 1616, 1617, 1591, 1609, 1591, 1610, 1593, 1609, 1593, 1610,
+    1594, 1609, 1594, 1610, 1587, 1609, 1587, 1610, 1588, 1609, 1588, 1610, 1581, 1609, 1581, 1610,
+    1580, 1609, 1580, 1610, 1582, 1609, 1582, 1610, 1589, 1609, 1589, 1610, 1590, 1609, 1590, 1610,
+    1588, 1580, 1588, 1581, 1588, 1582, 1588, 1605, 1588, 1585, 1587, 1585, 1589, 1585, 1590, 1585,
+    1591, 1609, 1591, 1610, 1593, 1609, 1593, 1610, 1594, 1609, 1594, 1610, 1587, 1609, 1587, 1610,
+    1588, 1609, 1588, 1610, 1581, 1609, 1581, 1610, 1580, 1609, 1580, 1610, 1582, 1609, 1582, 1610,
+    1589, 1609, 1589, 1610, 1590, 1609, 1590, 1610, 1588, 1580, 1588, 1581, 1588, 1582, 1588, 1605,
+    1588, 1585, 1587, 1585, 1589, 1585, 1590, 1585, 1588, 1580, 1588, 1581, 1588, 1582, 1588, 1605,
+    1587, 1607, 1588, 1607, 1591, 1605, 1587, 1580, 1587, 1581, 1587, 1582, 1588, 1580, 1588, 1581,
+    1588, 1582, 1591, 1605, 1592, 1605, 1575, 1611, 1575, 1611, 1578, 1580, 1605, 1578, 1581, 1580,
+    1578, 1581, 1580, 1578, 1581, 1605, 1578, 1582, 1605, 1578, 1605, 1580, 1578, 1605, 1581, 1578,
+    1605, 1582, 1580, 1605, 1581, 1580, 1605, 1581, 1581, 1605, 1610, 1581, 1605, 1609, 1587, 1581,
+    1580, 1587, 1580, 1581, 1587, 1580, 1609, 1587, 1605, 1581, 1587, 1605, 1581, 1587, 1605, 1580,
+    1587, 1605, 1605, 1587, 1605, 1605, 1589, 1581, 1581, 1589, 1581, 1581, 1589, 1605, 1605, 1588,
+    1581, 1605, 1588, 1581, 1605, 1588, 1580, 1610, 1588, 1605, 1582, 1588, 1605, 1582, 1588, 1605,
+    1605, 1588, 1605, 1605, 1590, 1581, 1609, 1590, 1582, 1605, 1590, 1582, 1605, 1591, 1605, 1581,
+    1591, 1605, 1581, 1591, 1605, 1605, 1591, 1605, 1610, 1593, 1580, 1605, 1593, 1605, 1605, 1593,
+    1605, 1605, 1593, 1605, 1609, 1594, 1605, 1605, 1594, 1605, 1610, 1594, 1605, 1609, 1601, 1582,
+    1605, 1601, 1582, 1605, 1602, 1605, 1581, 1602, 1605, 1605, 1604, 1581, 1605, 1604, 1581, 1610,
+    1604, 1581, 1609, 1604, 1580, 1580, 1604, 1580, 1580, 1604, 1582, 1605, 1604, 1582, 1605, 1604,
+    1605, 1581, 1604, 1605, 1581, 1605, 1581, 1580, 1605, 1581, 1605, 1605, 1581, 1610, 1605, 1580,
+    1581, 1605, 1580, 1605, 1605, 1582, 1580, 1605, 1582, 1605, 1605, 1580, 1582, 1607, 1605, 1580,
+    1607, 1605, 1605, 1606, 1581, 1605, 1606, 1581, 1609, 1606, 1580, 1605, 1606, 1580, 1605, 1606,
+    1580, 1609, 1606, 1605, 1610, 1606, 1605, 1609, 1610, 1605, 1605, 1610, 1605, 1605, 1576, 1582,
+    1610, 1578, 1580, 1610, 1578, 1580, 1609, 1578, 1582, 1610, 1578, 1582, 1609, 1578, 1605, 1610,
+    1578, 1605, 1609, 1580, 1605, 1610, 1580, 1581, 1609, 1580, 1605, 1609, 1587, 1582, 1609, 1589,
+    1581, 1610, 1588, 1581, 1610, 1590, 1581, 1610, 1604, 1580, 1610, 1604, 1605, 1610, 1610, 1581,
+    1610, 1610, 1580, 1610, 1610, 1605, 1610, 1605, 1605, 1610, 1602, 1605, 1610, 1606, 1581, 1610,
+    1602, 1605, 1581, 1604, 1581, 1605, 1593, 1605, 1610, 1603, 1605, 1610, 1606, 1580, 1581, 1605,
+    1582, 1610, 1604, 1580, 1605, 1603, 1605, 1605, 1604, 1580, 1605, 1606, 1580, 1581, 1580, 1581,
+    1610, 1581, 1580, 1610, 1605, 1580, 1610, 1601, 1605, 1610, 1576, 1581, 1610, 1603, 1605, 1605,
+    1593, 1580, 1605, 1589, 1605, 1605, 1587, 1582, 1610, 1606, 1580, 1610, 1589, 1604, 1746, 1602,
+    1604, 1746, 1575, 1604, 1604, 1607, 1575, 1603, 1576, 1585, 1605, 1581, 1605, 1583, 1589, 1604,
+    1593, 1605, 1585, 1587, 1608, 1604, 1593, 1604, 1610, 1607, 1608, 1587, 1604, 1605, 1589, 1604,
+    1609, 1589, 1604, 1609, 32, 1575, 1604, 1604, 1607, 32, 1593, 1604, 1610, 1607, 32, 1608, 1587,
+    1604, 1605, 1580, 1604, 32, 1580, 1604, 1575, 1604, 1607, 1585, 1740, 1575, 1604, 44, 12289,
+    12290, 58, 59, 33, 63, 12310, 12311, 46, 46, 46, 46, 46, 8212, 8211, 95, 95, 40, 41, 123, 125,
+    12308, 12309, 12304, 12305, 12298, 12299, 12296, 12297, 12300, 12301, 12302, 12303, 91, 93, 32,
+    773, 32, 773, 32, 773, 32, 773, 95, 95, 95, 44, 12289, 46, 59, 58, 63, 33, 8212, 40, 41, 123,
+    125, 12308, 12309, 35, 38, 42, 43, 45, 60, 62, 61, 92, 36, 37, 64, 32, 1611, 1600, 1611, 32,
+    1612, 32, 1613, 32, 1614, 1600, 1614, 32, 1615, 1600, 1615, 32, 1616, 1600, 1616, 32, 1617,
+    1600, 1617, 32, 1618, 1600, 1618, 1569, 1575, 1619, 1575, 1619, 1575, 1620, 1575, 1620, 1608,
+    1620, 1608, 1620, 1575, 1621, 1575, 1621, 1610, 1620, 1610, 1620, 1610, 1620, 1610, 1620, 1575,
+    1575, 1576, 1576, 1576, 1576, 1577, 1577, 1578, 1578, 1578, 1578, 1579, 1579, 1579, 1579, 1580,
+    1580, 1580, 1580, 1581, 1581, 1581, 1581, 1582, 1582, 1582, 1582, 1583, 1583, 1584, 1584, 1585,
+    1585, 1586, 1586, 1587, 1587, 1587, 1587, 1588, 1588, 1588, 1588, 1589, 1589, 1589, 1589, 1590,
+    1590, 1590, 1590, 1591, 1591, 1591, 1591, 1592, 1592, 1592, 1592, 1593, 1593, 1593, 1593, 1594,
+    1594, 1594, 1594, 1601, 1601, 1601, 1601, 1602, 1602, 1602, 1602, 1603, 1603, 1603, 1603, 1604,
+    1604, 1604, 1604, 1605, 1605, 1605, 1605, 1606, 1606, 1606, 1606, 1607, 1607, 1607, 1607, 1608,
+    1608, 1609, 1609, 1610, 1610, 1610, 1610, 1604, 1575, 1619, 1604, 1575, 1619, 1604, 1575, 1620,
+    1604, 1575, 1620, 1604, 1575, 1621, 1604, 1575, 1621, 1604, 1575, 1604, 1575, 33, 34, 35, 36,
+    37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60,
+    61, 62, 63, 64, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84,
+    85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106,
+    107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125,
+    126, 10629, 10630, 12290, 12300, 12301, 12289, 12539, 12530, 12449, 12451, 12453, 12455, 12457,
+    12515, 12517, 12519, 12483, 12540, 12450, 12452, 12454, 12456, 12458, 12459, 12461, 12463,
+    12465, 12467, 12469, 12471, 12473, 12475, 12477, 12479, 12481, 12484, 12486, 12488, 12490,
+    12491, 12492, 12493, 12494, 12495, 12498, 12501, 12504, 12507, 12510, 12511, 12512, 12513,
+    12514, 12516, 12518, 12520, 12521, 12522, 12523, 12524, 12525, 12527, 12531, 12441, 12442, 4448,
+    4352, 4353, 4522, 4354, 4524, 4525, 4355, 4356, 4357, 4528, 4529, 4530, 4531, 4532, 4533, 4378,
+    4358, 4359, 4360, 4385, 4361, 4362, 4363, 4364, 4365, 4366, 4367, 4368, 4369, 4370, 4449, 4450,
+    4451, 4452, 4453, 4454, 4455, 4456, 4457, 4458, 4459, 4460, 4461, 4462, 4463, 4464, 4465, 4466,
+    4467, 4468, 4469, 162, 163, 172, 32, 772, 166, 165, 8361, 9474, 8592, 8593, 8594, 8595, 9632,
+    9675, 720, 721, 230, 665, 595, 675, 43878, 677, 676, 598, 599, 7569, 600, 606, 681, 612, 610,
+    608, 667, 295, 668, 615, 644, 682, 683, 620, 122628, 42894, 622, 122629, 654, 122630, 248, 630,
+    631, 113, 634, 122632, 637, 638, 640, 680, 678, 43879, 679, 648, 11377, 655, 673, 674, 664, 448,
+    449, 450, 122634, 122654, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81,
+    82, 83, 84, 85, 86, 87, 88, 89, 90, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108,
+    109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 65, 66, 67, 68, 69, 70,
+    71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 97, 98, 99, 100,
+    101, 102, 103, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
+    121, 122, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85,
+    86, 87, 88, 89, 90, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 65, 67, 68, 71, 74, 75, 78, 79, 80, 81, 83,
+    84, 85, 86, 87, 88, 89, 90, 97, 98, 99, 100, 102, 104, 105, 106, 107, 108, 109, 110, 112, 113,
+    114, 115, 116, 117, 118, 119, 120, 121, 122, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77,
+    78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 97, 98, 99, 100, 101, 102, 103, 104, 105,
+    106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 65, 66, 68,
+    69, 70, 71, 74, 75, 76, 77, 78, 79, 80, 81, 83, 84, 85, 86, 87, 88, 89, 97, 98, 99, 100, 101,
+    102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
+    121, 122, 65, 66, 68, 69, 70, 71, 73, 74, 75, 76, 77, 79, 83, 84, 85, 86, 87, 88, 89, 97, 98,
+    99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117,
+    118, 119, 120, 121, 122, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82,
+    83, 84, 85, 86, 87, 88, 89, 90, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109,
+    110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 65, 66, 67, 68, 69, 70, 71, 72,
+    73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 97, 98, 99, 100, 101,
+    102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120,
+    121, 122, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85,
+    86, 87, 88, 89, 90, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+    113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75,
+    76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 97, 98, 99, 100, 101, 102, 103, 104,
+    105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 65,
+    66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89,
+    90, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112, 113, 114, 115,
+    116, 117, 118, 119, 120, 121, 122, 65, 66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79,
+    80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 97, 98, 99, 100, 101, 102, 103, 104, 105, 106, 107,
+    108, 109, 110, 111, 112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 305, 567, 913, 914,
+    915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927, 928, 929, 920, 931, 932, 933,
+    934, 935, 936, 937, 8711, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 957, 958,
+    959, 960, 961, 962, 963, 964, 965, 966, 967, 968, 969, 8706, 949, 952, 954, 966, 961, 960, 913,
+    914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927, 928, 929, 920, 931, 932,
+    933, 934, 935, 936, 937, 8711, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 956, 957,
+    958, 959, 960, 961, 962, 963, 964, 965, 966, 967, 968, 969, 8706, 949, 952, 954, 966, 961, 960,
+    913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927, 928, 929, 920, 931,
+    932, 933, 934, 935, 936, 937, 8711, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955, 956,
+    957, 958, 959, 960, 961, 962, 963, 964, 965, 966, 967, 968, 969, 8706, 949, 952, 954, 966, 961,
+    960, 913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927, 928, 929, 920,
+    931, 932, 933, 934, 935, 936, 937, 8711, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954, 955,
+    956, 957, 958, 959, 960, 961, 962, 963, 964, 965, 966, 967, 968, 969, 8706, 949, 952, 954, 966,
+    961, 960, 913, 914, 915, 916, 917, 918, 919, 920, 921, 922, 923, 924, 925, 926, 927, 928, 929,
+    920, 931, 932, 933, 934, 935, 936, 937, 8711, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954,
+    955, 956, 957, 958, 959, 960, 961, 962, 963, 964, 965, 966, 967, 968, 969, 8706, 949, 952, 954,
+    966, 961, 960, 988, 989, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 48, 49, 50, 51, 52, 53, 54, 55,
+    56, 57, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 48, 49, 50, 51, 52, 53, 54, 55, 56, 57, 48, 49,
+    50, 51, 52, 53, 54, 55, 56, 57, 1575, 1576, 1580, 1583, 1608, 1586, 1581, 1591, 1610, 1603,
+    1604, 1605, 1606, 1587, 1593, 1601, 1589, 1602, 1585, 1588, 1578, 1579, 1582, 1584, 1590, 1592,
+    1594, 1646, 1722, 1697, 1647, 1576, 1580, 1607, 1581, 1610, 1603, 1604, 1605, 1606, 1587, 1593,
+    1601, 1589, 1602, 1588, 1578, 1579, 1582, 1590, 1594, 1580, 1581, 1610, 1604, 1606, 1587, 1593,
+    1589, 1602, 1588, 1582, 1590, 1594, 1722, 1647, 1576, 1580, 1607, 1581, 1591, 1610, 1603, 1605,
+    1606, 1587, 1593, 1601, 1589, 1602, 1588, 1578, 1579, 1582, 1590, 1592, 1594, 1646, 1697, 1575,
+    1576, 1580, 1583, 1607, 1608, 1586, 1581, 1591, 1610, 1604, 1605, 1606, 1587, 1593, 1601, 1589,
+    1602, 1585, 1588, 1578, 1579, 1582, 1584, 1590, 1592, 1594, 1576, 1580, 1583, 1608, 1586, 1581,
+    1591, 1610, 1604, 1605, 1606, 1587, 1593, 1601, 1589, 1602, 1585, 1588, 1578, 1579, 1582, 1584,
+    1590, 1592, 1594, 48, 46, 48, 44, 49, 44, 50, 44, 51, 44, 52, 44, 53, 44, 54, 44, 55, 44, 56,
+    44, 57, 44, 40, 65, 41, 40, 66, 41, 40, 67, 41, 40, 68, 41, 40, 69, 41, 40, 70, 41, 40, 71, 41,
+    40, 72, 41, 40, 73, 41, 40, 74, 41, 40, 75, 41, 40, 76, 41, 40, 77, 41, 40, 78, 41, 40, 79, 41,
+    40, 80, 41, 40, 81, 41, 40, 82, 41, 40, 83, 41, 40, 84, 41, 40, 85, 41, 40, 86, 41, 40, 87, 41,
+    40, 88, 41, 40, 89, 41, 40, 90, 41, 12308, 83, 12309, 67, 82, 67, 68, 87, 90, 65, 66, 67, 68,
+    69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 72, 86,
+    77, 86, 83, 68, 83, 83, 80, 80, 86, 87, 67, 77, 67, 77, 68, 77, 82, 68, 74, 12411, 12363, 12467,
+    12467, 12469, 25163, 23383, 21452, 12486, 12441, 20108, 22810, 35299, 22825, 20132, 26144,
+    28961, 26009, 21069, 24460, 20877, 26032, 21021, 32066, 29983, 36009, 22768, 21561, 28436,
+    25237, 25429, 19968, 19977, 36938, 24038, 20013, 21491, 25351, 36208, 25171, 31105, 31354,
+    21512, 28288, 26377, 26376, 30003, 21106, 21942, 37197, 12308, 26412, 12309, 12308, 19977,
+    12309, 12308, 20108, 12309, 12308, 23433, 12309, 12308, 28857, 12309, 12308, 25171, 12309,
+    12308, 30423, 12309, 12308, 21213, 12309, 12308, 25943, 12309, 24471, 21487, 48, 49, 50, 51, 52,
+    53, 54, 55, 56, 57,
+};
+
+template <class T>
+const std::uint32_t _unicode_data<T>::composites[] = {
+    60, 824, 8814, 61, 824, 8800, 62, 824, 8815, 65, 768, 192, 65, 769, 193, 65, 770, 194, 65, 771,
+    195, 65, 772, 256, 65, 774, 258, 65, 775, 550, 65, 776, 196, 65, 777, 7842, 65, 778, 197, 65,
+    780, 461, 65, 783, 512, 65, 785, 514, 65, 803, 7840, 65, 805, 7680, 65, 808, 260, 66, 775, 7682,
+    66, 803, 7684, 66, 817, 7686, 67, 769, 262, 67, 770, 264, 67, 775, 266, 67, 780, 268, 67, 807,
+    199, 68, 775, 7690, 68, 780, 270, 68, 803, 7692, 68, 807, 7696, 68, 813, 7698, 68, 817, 7694,
+    69, 768, 200, 69, 769, 201, 69, 770, 202, 69, 771, 7868, 69, 772, 274, 69, 774, 276, 69, 775,
+    278, 69, 776, 203, 69, 777, 7866, 69, 780, 282, 69, 783, 516, 69, 785, 518, 69, 803, 7864, 69,
+    807, 552, 69, 808, 280, 69, 813, 7704, 69, 816, 7706, 70, 775, 7710, 71, 769, 500, 71, 770, 284,
+    71, 772, 7712, 71, 774, 286, 71, 775, 288, 71, 780, 486, 71, 807, 290, 72, 770, 292, 72, 775,
+    7714, 72, 776, 7718, 72, 780, 542, 72, 803, 7716, 72, 807, 7720, 72, 814, 7722, 73, 768, 204,
+    73, 769, 205, 73, 770, 206, 73, 771, 296, 73, 772, 298, 73, 774, 300, 73, 775, 304, 73, 776,
+    207, 73, 777, 7880, 73, 780, 463, 73, 783, 520, 73, 785, 522, 73, 803, 7882, 73, 808, 302, 73,
+    816, 7724, 74, 770, 308, 75, 769, 7728, 75, 780, 488, 75, 803, 7730, 75, 807, 310, 75, 817,
+    7732, 76, 769, 313, 76, 780, 317, 76, 803, 7734, 76, 807, 315, 76, 813, 7740, 76, 817, 7738, 77,
+    769, 7742, 77, 775, 7744, 77, 803, 7746, 78, 768, 504, 78, 769, 323, 78, 771, 209, 78, 775,
+    7748, 78, 780, 327, 78, 803, 7750, 78, 807, 325, 78, 813, 7754, 78, 817, 7752, 79, 768, 210, 79,
+    769, 211, 79, 770, 212, 79, 771, 213, 79, 772, 332, 79, 774, 334, 79, 775, 558, 79, 776, 214,
+    79, 777, 7886, 79, 779, 336, 79, 780, 465, 79, 783, 524, 79, 785, 526, 79, 795, 416, 79, 803,
+    7884, 79, 808, 490, 80, 769, 7764, 80, 775, 7766, 82, 769, 340, 82, 775, 7768, 82, 780, 344, 82,
+    783, 528, 82, 785, 530, 82, 803, 7770, 82, 807, 342, 82, 817, 7774, 83, 769, 346, 83, 770, 348,
+    83, 775, 7776, 83, 780, 352, 83, 803, 7778, 83, 806, 536, 83, 807, 350, 84, 775, 7786, 84, 780,
+    356, 84, 803, 7788, 84, 806, 538, 84, 807, 354, 84, 813, 7792, 84, 817, 7790, 85, 768, 217, 85,
+    769, 218, 85, 770, 219, 85, 771, 360, 85, 772, 362, 85, 774, 364, 85, 776, 220, 85, 777, 7910,
+    85, 778, 366, 85, 779, 368, 85, 780, 467, 85, 783, 532, 85, 785, 534, 85, 795, 431, 85, 803,
+    7908, 85, 804, 7794, 85, 808, 370, 85, 813, 7798, 85, 816, 7796, 86, 771, 7804, 86, 803, 7806,
+    87, 768, 7808, 87, 769, 7810, 87, 770, 372, 87, 775, 7814, 87, 776, 7812, 87, 803, 7816, 88,
+    775, 7818, 88, 776, 7820, 89, 768, 7922, 89, 769, 221, 89, 770, 374, 89, 771, 7928, 89, 772,
+    562, 89, 775, 7822, 89, 776, 376, 89, 777, 7926, 89, 803, 7924, 90, 769, 377, 90, 770, 7824, 90,
+    775, 379, 90, 780, 381, 90, 803, 7826, 90, 817, 7828, 97, 768, 224, 97, 769, 225, 97, 770, 226,
+    97, 771, 227, 97, 772, 257, 97, 774, 259, 97, 775, 551, 97, 776, 228, 97, 777, 7843, 97, 778,
+    229, 97, 780, 462, 97, 783, 513, 97, 785, 515, 97, 803, 7841, 97, 805, 7681, 97, 808, 261, 98,
+    775, 7683, 98, 803, 7685, 98, 817, 7687, 99, 769, 263, 99, 770, 265, 99, 775, 267, 99, 780, 269,
+    99, 807, 231, 100, 775, 7691, 100, 780, 271, 100, 803, 7693, 100, 807, 7697, 100, 813, 7699,
+    100, 817, 7695, 101, 768, 232, 101, 769, 233, 101, 770, 234, 101, 771, 7869, 101, 772, 275, 101,
+    774, 277, 101, 775, 279, 101, 776, 235, 101, 777, 7867, 101, 780, 283, 101, 783, 517, 101, 785,
+    519, 101, 803, 7865, 101, 807, 553, 101, 808, 281, 101, 813, 7705, 101, 816, 7707, 102, 775,
+    7711, 103, 769, 501, 103, 770, 285, 103, 772, 7713, 103, 774, 287, 103, 775, 289, 103, 780, 487,
+    103, 807, 291, 104, 770, 293, 104, 775, 7715, 104, 776, 7719, 104, 780, 543, 104, 803, 7717,
+    104, 807, 7721, 104, 814, 7723, 104, 817, 7830, 105, 768, 236, 105, 769, 237, 105, 770, 238,
+    105, 771, 297, 105, 772, 299, 105, 774, 301, 105, 776, 239, 105, 777, 7881, 105, 780, 464, 105,
+    783, 521, 105, 785, 523, 105, 803, 7883, 105, 808, 303, 105, 816, 7725, 106, 770, 309, 106, 780,
+    496, 107, 769, 7729, 107, 780, 489, 107, 803, 7731, 107, 807, 311, 107, 817, 7733, 108, 769,
+    314, 108, 780, 318, 108, 803, 7735, 108, 807, 316, 108, 813, 7741, 108, 817, 7739, 109, 769,
+    7743, 109, 775, 7745, 109, 803, 7747, 110, 768, 505, 110, 769, 324, 110, 771, 241, 110, 775,
+    7749, 110, 780, 328, 110, 803, 7751, 110, 807, 326, 110, 813, 7755, 110, 817, 7753, 111, 768,
+    242, 111, 769, 243, 111, 770, 244, 111, 771, 245, 111, 772, 333, 111, 774, 335, 111, 775, 559,
+    111, 776, 246, 111, 777, 7887, 111, 779, 337, 111, 780, 466, 111, 783, 525, 111, 785, 527, 111,
+    795, 417, 111, 803, 7885, 111, 808, 491, 112, 769, 7765, 112, 775, 7767, 114, 769, 341, 114,
+    775, 7769, 114, 780, 345, 114, 783, 529, 114, 785, 531, 114, 803, 7771, 114, 807, 343, 114, 817,
+    7775, 115, 769, 347, 115, 770, 349, 115, 775, 7777, 115, 780, 353, 115, 803, 7779, 115, 806,
+    537, 115, 807, 351, 116, 775, 7787, 116, 776, 7831, 116, 780, 357, 116, 803, 7789, 116, 806,
+    539, 116, 807, 355, 116, 813, 7793, 116, 817, 7791, 117, 768, 249, 117, 769, 250, 117, 770, 251,
+    117, 771, 361, 117, 772, 363, 117, 774, 365, 117, 776, 252, 117, 777, 7911, 117, 778, 367, 117,
+    779, 369, 117, 780, 468, 117, 783, 533, 117, 785, 535, 117, 795, 432, 117, 803, 7909, 117, 804,
+    7795, 117, 808, 371, 117, 813, 7799, 117, 816, 7797, 118, 771, 7805, 118, 803, 7807, 119, 768,
+    7809, 119, 769, 7811, 119, 770, 373, 119, 775, 7815, 119, 776, 7813, 119, 778, 7832, 119, 803,
+    7817, 120, 775, 7819, 120, 776, 7821, 121, 768, 7923, 121, 769, 253, 121, 770, 375, 121, 771,
+    7929, 121, 772, 563, 121, 775, 7823, 121, 776, 255, 121, 777, 7927, 121, 778, 7833, 121, 803,
+    7925, 122, 769, 378, 122, 770, 7825, 122, 775, 380, 122, 780, 382, 122, 803, 7827, 122, 817,
+    7829, 168, 768, 8173, 168, 769, 901, 168, 834, 8129, 194, 768, 7846, 194, 769, 7844, 194, 771,
+    7850, 194, 777, 7848, 196, 772, 478, 197, 769, 506, 198, 769, 508, 198, 772, 482, 199, 769,
+    7688, 202, 768, 7872, 202, 769, 7870, 202, 771, 7876, 202, 777, 7874, 207, 769, 7726, 212, 768,
+    7890, 212, 769, 7888, 212, 771, 7894, 212, 777, 7892, 213, 769, 7756, 213, 772, 556, 213, 776,
+    7758, 214, 772, 554, 216, 769, 510, 220, 768, 475, 220, 769, 471, 220, 772, 469, 220, 780, 473,
+    226, 768, 7847, 226, 769, 7845, 226, 771, 7851, 226, 777, 7849, 228, 772, 479, 229, 769, 507,
+    230, 769, 509, 230, 772, 483, 231, 769, 7689, 234, 768, 7873, 234, 769, 7871, 234, 771, 7877,
+    234, 777, 7875, 239, 769, 7727, 244, 768, 7891, 244, 769, 7889, 244, 771, 7895, 244, 777, 7893,
+    245, 769, 7757, 245, 772, 557, 245, 776, 7759, 246, 772, 555, 248, 769, 511, 252, 768, 476, 252,
+    769, 472, 252, 772, 470, 252, 780, 474, 258, 768, 7856, 258, 769, 7854, 258, 771, 7860, 258,
+    777, 7858, 259, 768, 7857, 259, 769, 7855, 259, 771, 7861, 259, 777, 7859, 274, 768, 7700, 274,
+    769, 7702, 275, 768, 7701, 275, 769, 7703, 332, 768, 7760, 332, 769, 7762, 333, 768, 7761, 333,
+    769, 7763, 346, 775, 7780, 347, 775, 7781, 352, 775, 7782, 353, 775, 7783, 360, 769, 7800, 361,
+    769, 7801, 362, 776, 7802, 363, 776, 7803, 383, 775, 7835, 416, 768, 7900, 416, 769, 7898, 416,
+    771, 7904, 416, 777, 7902, 416, 803, 7906, 417, 768, 7901, 417, 769, 7899, 417, 771, 7905, 417,
+    777, 7903, 417, 803, 7907, 431, 768, 7914, 431, 769, 7912, 431, 771, 7918, 431, 777, 7916, 431,
+    803, 7920, 432, 768, 7915, 432, 769, 7913, 432, 771, 7919, 432, 777, 7917, 432, 803, 7921, 439,
+    780, 494, 490, 772, 492, 491, 772, 493, 550, 772, 480, 551, 772, 481, 552, 774, 7708, 553, 774,
+    7709, 558, 772, 560, 559, 772, 561, 658, 780, 495, 913, 768, 8122, 913, 769, 902, 913, 772,
+    8121, 913, 774, 8120, 913, 787, 7944, 913, 788, 7945, 913, 837, 8124, 917, 768, 8136, 917, 769,
+    904, 917, 787, 7960, 917, 788, 7961, 919, 768, 8138, 919, 769, 905, 919, 787, 7976, 919, 788,
+    7977, 919, 837, 8140, 921, 768, 8154, 921, 769, 906, 921, 772, 8153, 921, 774, 8152, 921, 776,
+    938, 921, 787, 7992, 921, 788, 7993, 927, 768, 8184, 927, 769, 908, 927, 787, 8008, 927, 788,
+    8009, 929, 788, 8172, 933, 768, 8170, 933, 769, 910, 933, 772, 8169, 933, 774, 8168, 933, 776,
+    939, 933, 788, 8025, 937, 768, 8186, 937, 769, 911, 937, 787, 8040, 937, 788, 8041, 937, 837,
+    8188, 940, 837, 8116, 942, 837, 8132, 945, 768, 8048, 945, 769, 940, 945, 772, 8113, 945, 774,
+    8112, 945, 787, 7936, 945, 788, 7937, 945, 834, 8118, 945, 837, 8115, 949, 768, 8050, 949, 769,
+    941, 949, 787, 7952, 949, 788, 7953, 951, 768, 8052, 951, 769, 942, 951, 787, 7968, 951, 788,
+    7969, 951, 834, 8134, 951, 837, 8131, 953, 768, 8054, 953, 769, 943, 953, 772, 8145, 953, 774,
+    8144, 953, 776, 970, 953, 787, 7984, 953, 788, 7985, 953, 834, 8150, 959, 768, 8056, 959, 769,
+    972, 959, 787, 8000, 959, 788, 8001, 961, 787, 8164, 961, 788, 8165, 965, 768, 8058, 965, 769,
+    973, 965, 772, 8161, 965, 774, 8160, 965, 776, 971, 965, 787, 8016, 965, 788, 8017, 965, 834,
+    8166, 969, 768, 8060, 969, 769, 974, 969, 787, 8032, 969, 788, 8033, 969, 834, 8182, 969, 837,
+    8179, 970, 768, 8146, 970, 769, 912, 970, 834, 8151, 971, 768, 8162, 971, 769, 944, 971, 834,
+    8167, 974, 837, 8180, 978, 769, 979, 978, 776, 980, 1030, 776, 1031, 1040, 774, 1232, 1040, 776,
+    1234, 1043, 769, 1027, 1045, 768, 1024, 1045, 774, 1238, 1045, 776, 1025, 1046, 774, 1217, 1046,
+    776, 1244, 1047, 776, 1246, 1048, 768, 1037, 1048, 772, 1250, 1048, 774, 1049, 1048, 776, 1252,
+    1050, 769, 1036, 1054, 776, 1254, 1059, 772, 1262, 1059, 774, 1038, 1059, 776, 1264, 1059, 779,
+    1266, 1063, 776, 1268, 1067, 776, 1272, 1069, 776, 1260, 1072, 774, 1233, 1072, 776, 1235, 1075,
+    769, 1107, 1077, 768, 1104, 1077, 774, 1239, 1077, 776, 1105, 1078, 774, 1218, 1078, 776, 1245,
+    1079, 776, 1247, 1080, 768, 1117, 1080, 772, 1251, 1080, 774, 1081, 1080, 776, 1253, 1082, 769,
+    1116, 1086, 776, 1255, 1091, 772, 1263, 1091, 774, 1118, 1091, 776, 1265, 1091, 779, 1267, 1095,
+    776, 1269, 1099, 776, 1273, 1101, 776, 1261, 1110, 776, 1111, 1140, 783, 1142, 1141, 783, 1143,
+    1240, 776, 1242, 1241, 776, 1243, 1256, 776, 1258, 1257, 776, 1259, 1575, 1619, 1570, 1575,
+    1620, 1571, 1575, 1621, 1573, 1608, 1620, 1572, 1610, 1620, 1574, 1729, 1620, 1730, 1746, 1620,
+    1747, 1749, 1620, 1728, 2344, 2364, 2345, 2352, 2364, 2353, 2355, 2364, 2356, 2503, 2494, 2507,
+    2503, 2519, 2508, 2887, 2878, 2891, 2887, 2902, 2888, 2887, 2903, 2892, 2962, 3031, 2964, 3014,
+    3006, 3018, 3014, 3031, 3020, 3015, 3006, 3019, 3142, 3158, 3144, 3263, 3285, 3264, 3270, 3266,
+    3274, 3270, 3285, 3271, 3270, 3286, 3272, 3274, 3285, 3275, 3398, 3390, 3402, 3398, 3415, 3404,
+    3399, 3390, 3403, 3545, 3530, 3546, 3545, 3535, 3548, 3545, 3551, 3550, 3548, 3530, 3549, 4133,
+    4142, 4134, 6917, 6965, 6918, 6919, 6965, 6920, 6921, 6965, 6922, 6923, 6965, 6924, 6925, 6965,
+    6926, 6929, 6965, 6930, 6970, 6965, 6971, 6972, 6965, 6973, 6974, 6965, 6976, 6975, 6965, 6977,
+    6978, 6965, 6979, 7734, 772, 7736, 7735, 772, 7737, 7770, 772, 7772, 7771, 772, 7773, 7778, 775,
+    7784, 7779, 775, 7785, 7840, 770, 7852, 7840, 774, 7862, 7841, 770, 7853, 7841, 774, 7863, 7864,
+    770, 7878, 7865, 770, 7879, 7884, 770, 7896, 7885, 770, 7897, 7936, 768, 7938, 7936, 769, 7940,
+    7936, 834, 7942, 7936, 837, 8064, 7937, 768, 7939, 7937, 769, 7941, 7937, 834, 7943, 7937, 837,
+    8065, 7938, 837, 8066, 7939, 837, 8067, 7940, 837, 8068, 7941, 837, 8069, 7942, 837, 8070, 7943,
+    837, 8071, 7944, 768, 7946, 7944, 769, 7948, 7944, 834, 7950, 7944, 837, 8072, 7945, 768, 7947,
+    7945, 769, 7949, 7945, 834, 7951, 7945, 837, 8073, 7946, 837, 8074, 7947, 837, 8075, 7948, 837,
+    8076, 7949, 837, 8077, 7950, 837, 8078, 7951, 837, 8079, 7952, 768, 7954, 7952, 769, 7956, 7953,
+    768, 7955, 7953, 769, 7957, 7960, 768, 7962, 7960, 769, 7964, 7961, 768, 7963, 7961, 769, 7965,
+    7968, 768, 7970, 7968, 769, 7972, 7968, 834, 7974, 7968, 837, 8080, 7969, 768, 7971, 7969, 769,
+    7973, 7969, 834, 7975, 7969, 837, 8081, 7970, 837, 8082, 7971, 837, 8083, 7972, 837, 8084, 7973,
+    837, 8085, 7974, 837, 8086, 7975, 837, 8087, 7976, 768, 7978, 7976, 769, 7980, 7976, 834, 7982,
+    7976, 837, 8088, 7977, 768, 7979, 7977, 769, 7981, 7977, 834, 7983, 7977, 837, 8089, 7978, 837,
+    8090, 7979, 837, 8091, 7980, 837, 8092, 7981, 837, 8093, 7982, 837, 8094, 7983, 837, 8095, 7984,
+    768, 7986, 7984, 769, 7988, 7984, 834, 7990, 7985, 768, 7987, 7985, 769, 7989, 7985, 834, 7991,
+    7992, 768, 7994, 7992, 769, 7996, 7992, 834, 7998, 7993, 768, 7995, 7993, 769, 7997, 7993, 834,
+    7999, 8000, 768, 8002, 8000, 769, 8004, 8001, 768, 8003, 8001, 769, 8005, 8008, 768, 8010, 8008,
+    769, 8012, 8009, 768, 8011, 8009, 769, 8013, 8016, 768, 8018, 8016, 769, 8020, 8016, 834, 8022,
+    8017, 768, 8019, 8017, 769, 8021, 8017, 834, 8023, 8025, 768, 8027, 8025, 769, 8029, 8025, 834,
+    8031, 8032, 768, 8034, 8032, 769, 8036, 8032, 834, 8038, 8032, 837, 8096, 8033, 768, 8035, 8033,
+    769, 8037, 8033, 834, 8039, 8033, 837, 8097, 8034, 837, 8098, 8035, 837, 8099, 8036, 837, 8100,
+    8037, 837, 8101, 8038, 837, 8102, 8039, 837, 8103, 8040, 768, 8042, 8040, 769, 8044, 8040, 834,
+    8046, 8040, 837, 8104, 8041, 768, 8043, 8041, 769, 8045, 8041, 834, 8047, 8041, 837, 8105, 8042,
+    837, 8106, 8043, 837, 8107, 8044, 837, 8108, 8045, 837, 8109, 8046, 837, 8110, 8047, 837, 8111,
+    8048, 837, 8114, 8052, 837, 8130, 8060, 837, 8178, 8118, 837, 8119, 8127, 768, 8141, 8127, 769,
+    8142, 8127, 834, 8143, 8134, 837, 8135, 8182, 837, 8183, 8190, 768, 8157, 8190, 769, 8158, 8190,
+    834, 8159, 8592, 824, 8602, 8594, 824, 8603, 8596, 824, 8622, 8656, 824, 8653, 8658, 824, 8655,
+    8660, 824, 8654, 8707, 824, 8708, 8712, 824, 8713, 8715, 824, 8716, 8739, 824, 8740, 8741, 824,
+    8742, 8764, 824, 8769, 8771, 824, 8772, 8773, 824, 8775, 8776, 824, 8777, 8781, 824, 8813, 8801,
+    824, 8802, 8804, 824, 8816, 8805, 824, 8817, 8818, 824, 8820, 8819, 824, 8821, 8822, 824, 8824,
+    8823, 824, 8825, 8826, 824, 8832, 8827, 824, 8833, 8828, 824, 8928, 8829, 824, 8929, 8834, 824,
+    8836, 8835, 824, 8837, 8838, 824, 8840, 8839, 824, 8841, 8849, 824, 8930, 8850, 824, 8931, 8866,
+    824, 8876, 8872, 824, 8877, 8873, 824, 8878, 8875, 824, 8879, 8882, 824, 8938, 8883, 824, 8939,
+    8884, 824, 8940, 8885, 824, 8941, 12358, 12441, 12436, 12363, 12441, 12364, 12365, 12441, 12366,
+    12367, 12441, 12368, 12369, 12441, 12370, 12371, 12441, 12372, 12373, 12441, 12374, 12375,
+    12441, 12376, 12377, 12441, 12378, 12379, 12441, 12380, 12381, 12441, 12382, 12383, 12441,
+    12384, 12385, 12441, 12386, 12388, 12441, 12389, 12390, 12441, 12391, 12392, 12441, 12393,
+    12399, 12441, 12400, 12399, 12442, 12401, 12402, 12441, 12403, 12402, 12442, 12404, 12405,
+    12441, 12406, 12405, 12442, 12407, 12408, 12441, 12409, 12408, 12442, 12410, 12411, 12441,
+    12412, 12411, 12442, 12413, 12445, 12441, 12446, 12454, 12441, 12532, 12459, 12441, 12460,
+    12461, 12441, 12462, 12463, 12441, 12464, 12465, 12441, 12466, 12467, 12441, 12468, 12469,
+    12441, 12470, 12471, 12441, 12472, 12473, 12441, 12474, 12475, 12441, 12476, 12477, 12441,
+    12478, 12479, 12441, 12480, 12481, 12441, 12482, 12484, 12441, 12485, 12486, 12441, 12487,
+    12488, 12441, 12489, 12495, 12441, 12496, 12495, 12442, 12497, 12498, 12441, 12499, 12498,
+    12442, 12500, 12501, 12441, 12502, 12501, 12442, 12503, 12504, 12441, 12505, 12504, 12442,
+    12506, 12507, 12441, 12508, 12507, 12442, 12509, 12527, 12441, 12535, 12528, 12441, 12536,
+    12529, 12441, 12537, 12530, 12441, 12538, 12541, 12441, 12542, 69785, 69818, 69786, 69787,
+    69818, 69788, 69797, 69818, 69803, 69937, 69927, 69934, 69938, 69927, 69935, 70471, 70462,
+    70475, 70471, 70487, 70476, 70841, 70832, 70844, 70841, 70842, 70843, 70841, 70845, 70846,
+    71096, 71087, 71098, 71097, 71087, 71099, 71989, 71984, 71992,
+};
+
+template <class T>
+const std::uint8_t _unicode_data<T>::case_stage1[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25,
+    26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40, 41, 40, 42, 43, 44, 45, 46, 47, 48,
+    43, 49, 50, 51, 52, 53, 54, 55, 56, 57, 58, 59, 60, 61, 62, 63, 64, 65, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 66, 67, 68, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 69, 70, 71, 72, 73, 74,
+    75, 26, 76, 26, 26, 26, 77, 78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 12, 92, 92,
+    93, 92, 94, 95, 96, 97, 98, 99, 100, 101, 102, 103, 104, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 105, 106, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 107, 108, 92, 109, 110, 111, 26, 112, 113, 26, 26, 26, 26, 26,
+    26, 26, 114, 26, 115, 116, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 117, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 86, 26, 26, 26, 26, 118, 119, 120, 121,
+    122, 123, 124, 125, 126, 26, 26, 127, 128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138,
+    139, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 140, 26, 141, 142, 26, 26, 26, 26, 26, 26, 26, 26, 143, 144, 26, 145, 146,
+    147, 148, 149, 26, 26, 26, 26, 26, 26, 26, 150, 26, 26, 26, 151, 26, 152, 26, 26, 153, 154, 155,
+    156, 26, 157, 158, 26, 26, 26, 26, 26, 26, 26, 159, 26, 26, 26, 26, 26, 26, 26, 26, 26, 160, 26,
+    26, 161, 26, 26, 26, 26, 26, 26, 162, 163, 164, 26, 26, 26, 26, 26, 165, 26, 26, 166, 167, 26,
+    168, 169, 170, 171, 172, 173, 174, 175, 176, 26, 26, 177, 50, 178, 26, 26, 179, 180, 181, 182,
+    26, 26, 183, 184, 185, 186, 187, 26, 188, 26, 26, 26, 189, 26, 190, 191, 192, 74, 26, 193, 194,
+    195, 196, 26, 26, 26, 26, 26, 197, 26, 198, 26, 199, 200, 201, 26, 26, 26, 26, 202, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 203, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 204, 205, 206, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 207, 26, 26, 26, 208, 209, 210, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 211, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 212, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 213, 214, 26, 26, 26, 26, 26, 26, 26, 215, 216, 26, 26, 217, 26, 26,
+    26, 26, 26, 26, 218, 219, 220, 221, 222, 223, 218, 218, 218, 218, 224, 225, 226, 227, 228, 229,
+    26, 26, 26, 26, 26, 26, 26, 26, 230, 231, 232, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 233, 26, 26, 26, 234, 26, 26, 26, 235, 26, 26, 26, 26, 26, 236, 237, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 238, 239,
+    240, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 136, 241, 242, 26, 26, 26, 26, 26, 26, 26, 26, 243, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+    26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26, 26,
+};
+
+template <class T>
+const std::uint16_t _unicode_data<T>::case_stage2[] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 1, 0,
+    1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 4, 0, 0, 1, 0, 1, 0, 0, 0, 0, 1, 5, 0, 1, 1, 0, 4, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 6,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 3, 3, 3, 3, 7,
+    8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 10, 11, 8, 9, 8, 9, 8, 9, 4, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 12, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8,
+    9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 13, 8, 9, 8, 9, 8, 9,
+    14, 15, 16, 8, 9, 8, 9, 17, 8, 9, 18, 18, 8, 9, 4, 19, 20, 21, 8, 9, 18, 22, 23, 24, 25, 8, 9,
+    26, 4, 24, 27, 28, 29, 8, 9, 8, 9, 8, 9, 30, 8, 9, 30, 4, 4, 8, 9, 30, 8, 9, 31, 31, 8, 9, 8, 9,
+    32, 8, 9, 4, 0, 8, 9, 4, 33, 0, 0, 0, 0, 34, 35, 36, 34, 35, 36, 34, 35, 36, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 37, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 38, 34,
+    35, 36, 8, 9, 39, 40, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8,
+    9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 41, 4, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8,
+    9, 8, 9, 4, 4, 4, 4, 4, 4, 42, 8, 9, 43, 44, 45, 45, 8, 9, 46, 47, 48, 8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 49, 50, 51, 52, 53, 4, 54, 54, 4, 55, 4, 56, 57, 4, 4, 4, 54, 58, 4, 59, 4, 60, 61, 4, 62,
+    63, 61, 64, 65, 4, 4, 63, 4, 66, 67, 4, 4, 68, 4, 4, 4, 4, 4, 4, 4, 69, 4, 4, 70, 4, 71, 70, 4,
+    4, 4, 72, 70, 73, 74, 74, 75, 4, 4, 4, 4, 4, 76, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 77, 78, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 79, 79, 79, 79, 79, 79, 79, 79, 79, 1, 1, 1, 1, 1, 1,
+    1, 79, 79, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 79, 79, 79, 79, 79, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 80, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 8, 9, 8, 9, 1, 1, 8, 9, 0, 0, 79,
+    28, 28, 28, 0, 81, 0, 0, 0, 0, 1, 1, 82, 1, 83, 83, 83, 0, 84, 0, 85, 85, 86, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 87, 88, 88, 88, 89, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 90, 3, 3, 3, 3, 3, 3, 3, 3, 3, 91, 92, 92, 93, 94, 95, 4,
+    4, 4, 96, 97, 98, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 99,
+    100, 101, 102, 103, 104, 0, 8, 9, 105, 8, 9, 4, 41, 41, 41, 106, 106, 106, 106, 106, 106, 106,
+    106, 106, 106, 106, 106, 106, 106, 106, 106, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 107, 107, 107, 107, 107, 107, 107, 107, 107, 107,
+    107, 107, 107, 107, 107, 107, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 0, 1, 1, 1, 1, 1, 1, 1, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 108, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 109, 8, 9, 8, 9, 8,
+    9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8,
+    9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8,
+    9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 0, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 0, 0, 1, 0,
+    0, 0, 0, 0, 1, 4, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+    111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+    111, 111, 111, 111, 112, 4, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1,
+    0, 1, 1, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0,
+    0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 1, 1, 0, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1,
+    0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1,
+    1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0,
+    0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    1, 1, 1, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 0, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+    113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+    113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113, 113,
+    0, 113, 0, 0, 0, 0, 0, 113, 0, 0, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114,
+    114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114,
+    114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 114, 0, 1, 114, 114, 114, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 115, 115, 115,
+    115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115,
+    115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115,
+    115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115,
+    115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115, 115,
+    115, 116, 116, 116, 116, 116, 116, 0, 0, 117, 117, 117, 117, 117, 117, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0,
+    0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 0, 0, 1,
+    1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    0, 0, 1, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 1, 1, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 118, 119, 120,
+    121, 121, 122, 123, 124, 125, 0, 0, 0, 0, 0, 0, 0, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+    126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126,
+    126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 126, 0, 0, 126, 126, 126,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 79, 127, 4, 4, 4, 128, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 129, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 130, 131, 132,
+    133, 134, 135, 4, 4, 136, 4, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 137, 137, 137, 137, 137, 137, 137, 137, 138, 138, 138, 138, 138,
+    138, 138, 138, 137, 137, 137, 137, 137, 137, 0, 0, 138, 138, 138, 138, 138, 138, 0, 0, 137, 137,
+    137, 137, 137, 137, 137, 137, 138, 138, 138, 138, 138, 138, 138, 138, 137, 137, 137, 137, 137,
+    137, 137, 137, 138, 138, 138, 138, 138, 138, 138, 138, 137, 137, 137, 137, 137, 137, 0, 0, 138,
+    138, 138, 138, 138, 138, 0, 0, 139, 137, 140, 137, 141, 137, 142, 137, 0, 138, 0, 138, 0, 138,
+    0, 138, 137, 137, 137, 137, 137, 137, 137, 137, 138, 138, 138, 138, 138, 138, 138, 138, 143,
+    143, 144, 144, 144, 144, 145, 145, 146, 146, 147, 147, 148, 148, 0, 0, 149, 150, 151, 152, 153,
+    154, 155, 156, 157, 158, 159, 160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172,
+    173, 174, 175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 137, 137, 197, 198, 199, 0, 200, 201, 138, 138, 202, 202, 203, 1, 204,
+    1, 1, 1, 205, 206, 207, 0, 208, 209, 210, 210, 210, 210, 211, 1, 1, 1, 137, 137, 212, 86, 0, 0,
+    213, 214, 138, 138, 215, 215, 0, 1, 1, 1, 137, 137, 216, 89, 217, 101, 218, 219, 138, 138, 220,
+    220, 105, 1, 1, 1, 0, 0, 221, 222, 223, 0, 224, 225, 226, 226, 227, 227, 228, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 1, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 79, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 0, 0, 0, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 4, 0, 229, 0, 4, 0, 230, 231, 4, 4, 0, 4, 4, 4, 232, 4, 4, 0, 0, 0, 0, 4, 0,
+    0, 4, 4, 4, 4, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 233, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234, 234,
+    234, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 235, 0, 0, 0, 8,
+    9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 236, 236, 236, 236, 236, 236, 236, 236,
+    236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 236, 237,
+    237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237, 237,
+    237, 237, 237, 237, 237, 237, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 110,
+    110, 110, 110, 110, 110, 110, 110, 110, 110, 110, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+    111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+    111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111, 111,
+    111, 8, 9, 238, 239, 240, 241, 242, 8, 9, 8, 9, 8, 9, 243, 244, 245, 246, 4, 8, 9, 4, 8, 9, 4,
+    4, 4, 4, 4, 79, 79, 247, 247, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 4, 0, 0, 0, 0, 0, 0, 8, 9, 8, 9, 1, 1, 1, 8, 9, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
+    248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248, 248,
+    248, 248, 248, 248, 248, 248, 0, 248, 0, 0, 0, 0, 0, 248, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8,
+    9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 0, 1, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8,
+    9, 79, 79, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 4, 4, 8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 79, 4, 4, 4, 4, 4, 4, 4, 4, 8,
+    9, 8, 9, 249, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 1, 1, 1, 8, 9, 250, 4, 0, 8, 9, 8, 9, 251, 4, 8, 9,
+    8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 252, 253, 254, 255, 252, 4, 256, 257, 258,
+    259, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 8, 9, 260, 261, 262, 8, 9, 8, 9, 0, 0, 0, 0, 0,
+    8, 9, 0, 4, 0, 4, 8, 9, 8, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 8, 9, 0, 79, 79, 4, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0,
+    0, 0, 0, 0, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 263, 4, 4, 4, 4, 4, 4, 4, 1, 79, 79, 79, 79, 4, 4, 4, 4, 4, 4, 4, 4, 4, 1, 1, 1, 0,
+    0, 0, 0, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264,
+    264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264,
+    264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264,
+    264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264, 264,
+    264, 264, 264, 264, 264, 264, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 265, 266, 267, 268, 269, 270, 270, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 271, 272, 273, 274, 275, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 1, 0, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 276, 276, 276, 276, 276, 276, 276, 276,
+    276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276,
+    276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 277, 277, 277, 277, 277, 277,
+    277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277,
+    277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 276, 276, 276, 276,
+    276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276,
+    276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 276, 0, 0, 0, 0, 277, 277, 277, 277,
+    277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277,
+    277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 277, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 0, 278,
+    278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 278, 0, 278, 278, 278, 278,
+    278, 278, 278, 0, 278, 278, 0, 279, 279, 279, 279, 279, 279, 279, 279, 279, 279, 279, 0, 279,
+    279, 279, 279, 279, 279, 279, 279, 279, 279, 279, 279, 279, 279, 279, 0, 279, 279, 279, 279,
+    279, 279, 279, 0, 279, 279, 0, 0, 0, 79, 1, 1, 79, 79, 79, 0, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 79,
+    79, 79, 79, 79, 79, 79, 79, 79, 79, 79, 0, 79, 79, 79, 79, 79, 79, 79, 79, 79, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 84,
+    84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+    84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+    84, 84, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+    91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91,
+    91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 91, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 1, 0,
+    0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1,
+    1, 0, 0, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 0,
+    1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 0,
+    1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 0,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 0, 1, 1, 0,
+    1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+    2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4,
+    4, 0, 0, 4, 0, 0, 4, 4, 0, 0, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 0, 4, 4,
+    4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 0, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4,
+    0, 4, 4, 4, 4, 4, 0, 4, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280,
+    280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 280, 281, 281, 281,
+    281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281,
+    281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 281, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+};
+
+template <class T>
+const std::int32_t _unicode_data<T>::case_mappings[] = {
+    0, 0, 0, 0, 0, 0, 0, 2, 32, 0, 32, 1, 0, -32, 0, 1, 0, 0, 0, 1, 0, 743, 775, 1, 0, 16777218,
+    16777226, 1, 0, 121, 0, 1, 1, 0, 1, 1, 0, -1, 0, 1, 16777234, 0, 16777234, 1, 0, -232, 0, 1, 0,
+    16777242, 16777250, 1, -121, 0, -121, 1, 0, -300, -268, 1, 0, 195, 0, 1, 210, 0, 210, 1, 206, 0,
+    206, 1, 205, 0, 205, 1, 79, 0, 79, 1, 202, 0, 202, 1, 203, 0, 203, 1, 207, 0, 207, 1, 0, 97, 0,
+    1, 211, 0, 211, 1, 209, 0, 209, 1, 0, 163, 0, 1, 213, 0, 213, 1, 0, 130, 0, 1, 214, 0, 214, 1,
+    218, 0, 218, 1, 217, 0, 217, 1, 219, 0, 219, 1, 0, 56, 0, 1, 2, 0, 2, 1, 1, -1, 1, 1, 0, -2, 0,
+    1, 0, -79, 0, 1, 0, 16777258, 16777266, 1, -97, 0, -97, 1, -56, 0, -56, 1, -130, 0, -130, 1,
+    10795, 0, 10795, 1, -163, 0, -163, 1, 10792, 0, 10792, 1, 0, 10815, 0, 1, -195, 0, -195, 1, 69,
+    0, 69, 1, 71, 0, 71, 1, 0, 10783, 0, 1, 0, 10780, 0, 1, 0, 10782, 0, 1, 0, -210, 0, 1, 0, -206,
+    0, 1, 0, -205, 0, 1, 0, -202, 0, 1, 0, -203, 0, 1, 0, 42319, 0, 1, 0, 42315, 0, 1, 0, -207, 0,
+    1, 0, 42280, 0, 1, 0, 42308, 0, 1, 0, -209, 0, 1, 0, -211, 0, 1, 0, 10743, 0, 1, 0, 42305, 0, 1,
+    0, 10749, 0, 1, 0, -213, 0, 1, 0, -214, 0, 1, 0, 10727, 0, 1, 0, -218, 0, 1, 0, 42307, 0, 1, 0,
+    42282, 0, 1, 0, -69, 0, 1, 0, -217, 0, 1, 0, -71, 0, 1, 0, -219, 0, 1, 0, 42261, 0, 1, 0, 42258,
+    0, 1, 0, 0, 0, 3, 0, 84, 116, 3, 116, 0, 116, 1, 38, 0, 38, 1, 37, 0, 37, 1, 64, 0, 64, 1, 63,
+    0, 63, 1, 0, 16777275, 16777287, 1, 0, -38, 0, 1, 0, -37, 0, 1, 0, 16777299, 16777311, 1, 0,
+    -31, 1, 1, 0, -64, 0, 1, 0, -63, 0, 1, 8, 0, 8, 1, 0, -62, -30, 1, 0, -57, -25, 1, 0, -47, -15,
+    1, 0, -54, -22, 1, 0, -8, 0, 1, 0, -86, -54, 1, 0, -80, -48, 1, 0, 7, 0, 1, 0, -116, 0, 1, -60,
+    0, -60, 1, 0, -96, -64, 1, -7, 0, -7, 1, 80, 0, 80, 1, 0, -80, 0, 1, 15, 0, 15, 1, 0, -15, 0, 1,
+    48, 0, 48, 1, 0, -48, 0, 1, 0, 16777322, 16777330, 1, 7264, 0, 7264, 1, 0, 3008, 0, 1, 38864, 0,
+    0, 1, 8, 0, 0, 1, 0, -8, -8, 1, 0, -6254, -6222, 1, 0, -6253, -6221, 1, 0, -6244, -6212, 1, 0,
+    -6242, -6210, 1, 0, -6243, -6211, 1, 0, -6236, -6204, 1, 0, -6181, -6180, 1, 0, 35266, 35267, 1,
+    -3008, 0, -3008, 1, 0, 35332, 0, 1, 0, 3814, 0, 1, 0, 35384, 0, 1, 0, 16777338, 16777346, 1, 0,
+    16777354, 16777362, 1, 0, 16777370, 16777378, 1, 0, 16777386, 16777394, 1, 0, 16777402,
+    16777410, 1, 0, -59, -58, 1, -7615, 0, 16777226, 1, 0, 8, 0, 1, -8, 0, -8, 1, 0, 16777418,
+    16777426, 1, 0, 16777435, 16777447, 1, 0, 16777459, 16777471, 1, 0, 16777483, 16777495, 1, 0,
+    74, 0, 1, 0, 86, 0, 1, 0, 100, 0, 1, 0, 128, 0, 1, 0, 112, 0, 1, 0, 126, 0, 1, 0, 16777506,
+    16777514, 1, 0, 16777522, 16777530, 1, 0, 16777538, 16777546, 1, 0, 16777554, 16777562, 1, 0,
+    16777570, 16777578, 1, 0, 16777586, 16777594, 1, 0, 16777602, 16777610, 1, 0, 16777618,
+    16777626, 1, -8, 16777506, 16777514, 1, -8, 16777522, 16777530, 1, -8, 16777538, 16777546, 1,
+    -8, 16777554, 16777562, 1, -8, 16777570, 16777578, 1, -8, 16777586, 16777594, 1, -8, 16777602,
+    16777610, 1, -8, 16777618, 16777626, 1, 0, 16777634, 16777642, 1, 0, 16777650, 16777658, 1, 0,
+    16777666, 16777674, 1, 0, 16777682, 16777690, 1, 0, 16777698, 16777706, 1, 0, 16777714,
+    16777722, 1, 0, 16777730, 16777738, 1, 0, 16777746, 16777754, 1, -8, 16777634, 16777642, 1, -8,
+    16777650, 16777658, 1, -8, 16777666, 16777674, 1, -8, 16777682, 16777690, 1, -8, 16777698,
+    16777706, 1, -8, 16777714, 16777722, 1, -8, 16777730, 16777738, 1, -8, 16777746, 16777754, 1, 0,
+    16777762, 16777770, 1, 0, 16777778, 16777786, 1, 0, 16777794, 16777802, 1, 0, 16777810,
+    16777818, 1, 0, 16777826, 16777834, 1, 0, 16777842, 16777850, 1, 0, 16777858, 16777866, 1, 0,
+    16777874, 16777882, 1, -8, 16777762, 16777770, 1, -8, 16777778, 16777786, 1, -8, 16777794,
+    16777802, 1, -8, 16777810, 16777818, 1, -8, 16777826, 16777834, 1, -8, 16777842, 16777850, 1,
+    -8, 16777858, 16777866, 1, -8, 16777874, 16777882, 1, 0, 16777890, 16777898, 1, 0, 16777906,
+    16777914, 1, 0, 16777922, 16777930, 1, 0, 16777938, 16777946, 1, 0, 16777955, 16777967, 1, -74,
+    0, -74, 1, -9, 16777906, 16777914, 1, 0, -7205, -7173, 1, 0, 16777978, 16777986, 1, 0, 16777994,
+    16778002, 1, 0, 16778010, 16778018, 1, 0, 16778026, 16778034, 1, 0, 16778043, 16778055, 1, -86,
+    0, -86, 1, -9, 16777994, 16778002, 1, 0, 16778067, 16778079, 1, 0, 16778090, 16778098, 1, 0,
+    16778107, 16778119, 1, -100, 0, -100, 1, 0, 16778131, 16778143, 1, 0, 16778154, 16778162, 1, 0,
+    16778170, 16778178, 1, 0, 16778187, 16778199, 1, -112, 0, -112, 1, 0, 16778210, 16778218, 1, 0,
+    16778226, 16778234, 1, 0, 16778242, 16778250, 1, 0, 16778258, 16778266, 1, 0, 16778275,
+    16778287, 1, -128, 0, -128, 1, -126, 0, -126, 1, -9, 16778226, 16778234, 1, -7517, 0, -7517, 1,
+    -8383, 0, -8383, 1, -8262, 0, -8262, 1, 28, 0, 28, 1, 0, -28, 0, 1, 16, 0, 16, 1, 0, -16, 0, 1,
+    26, 0, 26, 1, 0, -26, 0, 1, -10743, 0, -10743, 1, -3814, 0, -3814, 1, -10727, 0, -10727, 1, 0,
+    -10795, 0, 1, 0, -10792, 0, 1, -10780, 0, -10780, 1, -10749, 0, -10749, 1, -10783, 0, -10783, 1,
+    -10782, 0, -10782, 1, -10815, 0, -10815, 1, 0, -7264, 0, 1, -35332, 0, -35332, 1, -42280, 0,
+    -42280, 1, 0, 48, 0, 1, -42308, 0, -42308, 1, -42319, 0, -42319, 1, -42315, 0, -42315, 1,
+    -42305, 0, -42305, 1, -42258, 0, -42258, 1, -42282, 0, -42282, 1, -42261, 0, -42261, 1, 928, 0,
+    928, 1, -48, 0, -48, 1, -42307, 0, -42307, 1, -35384, 0, -35384, 1, 0, -928, 0, 1, 0, -38864,
+    -38864, 1, 0, 16778298, 16778306, 1, 0, 16778314, 16778322, 1, 0, 16778330, 16778338, 1, 0,
+    16778347, 16778359, 1, 0, 16778371, 16778383, 1, 0, 16778394, 16778402, 1, 0, 16778410,
+    16778418, 1, 0, 16778426, 16778434, 1, 0, 16778442, 16778450, 1, 0, 16778458, 16778466, 1, 0,
+    16778474, 16778482, 1, 40, 0, 40, 1, 0, -40, 0, 1, 39, 0, 39, 1, 0, -39, 0, 1, 34, 0, 34, 1, 0,
+    -34, 0, 1,
+};
+
+template <class T>
+const std::uint32_t _unicode_data<T>::case_pool[] = {
+    83, 83, 115, 115, 105, 775, 700, 78, 700, 110, 74, 780, 106, 780, 921, 776, 769, 953, 776, 769,
+    933, 776, 769, 965, 776, 769, 1333, 1362, 1381, 1410, 72, 817, 104, 817, 84, 776, 116, 776, 87,
+    778, 119, 778, 89, 778, 121, 778, 65, 702, 97, 702, 933, 787, 965, 787, 933, 787, 768, 965, 787,
+    768, 933, 787, 769, 965, 787, 769, 933, 787, 834, 965, 787, 834, 7944, 921, 7936, 953, 7945,
+    921, 7937, 953, 7946, 921, 7938, 953, 7947, 921, 7939, 953, 7948, 921, 7940, 953, 7949, 921,
+    7941, 953, 7950, 921, 7942, 953, 7951, 921, 7943, 953, 7976, 921, 7968, 953, 7977, 921, 7969,
+    953, 7978, 921, 7970, 953, 7979, 921, 7971, 953, 7980, 921, 7972, 953, 7981, 921, 7973, 953,
+    7982, 921, 7974, 953, 7983, 921, 7975, 953, 8040, 921, 8032, 953, 8041, 921, 8033, 953, 8042,
+    921, 8034, 953, 8043, 921, 8035, 953, 8044, 921, 8036, 953, 8045, 921, 8037, 953, 8046, 921,
+    8038, 953, 8047, 921, 8039, 953, 8122, 921, 8048, 953, 913, 921, 945, 953, 902, 921, 940, 953,
+    913, 834, 945, 834, 913, 834, 921, 945, 834, 953, 8138, 921, 8052, 953, 919, 921, 951, 953, 905,
+    921, 942, 953, 919, 834, 951, 834, 919, 834, 921, 951, 834, 953, 921, 776, 768, 953, 776, 768,
+    921, 834, 953, 834, 921, 776, 834, 953, 776, 834, 933, 776, 768, 965, 776, 768, 929, 787, 961,
+    787, 933, 834, 965, 834, 933, 776, 834, 965, 776, 834, 8186, 921, 8060, 953, 937, 921, 969, 953,
+    911, 921, 974, 953, 937, 834, 969, 834, 937, 834, 921, 969, 834, 953, 70, 70, 102, 102, 70, 73,
+    102, 105, 70, 76, 102, 108, 70, 70, 73, 102, 102, 105, 70, 70, 76, 102, 102, 108, 83, 84, 115,
+    116, 1348, 1350, 1396, 1398, 1348, 1333, 1396, 1381, 1348, 1339, 1396, 1387, 1358, 1350, 1406,
+    1398, 1348, 1341, 1396, 1389,
+};
+
+template <class T>
+const std::uint8_t _unicode_data<T>::grapheme_stage1[] = {
+    0, 1, 2, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 5, 3, 3, 3, 3, 6, 3, 3, 3, 7, 8, 9, 10, 3, 11, 12, 13,
+    14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 24, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36,
+    37, 38, 39, 40, 41, 42, 43, 44, 45, 46, 47, 48, 49, 3, 50, 51, 52, 53, 3, 3, 3, 3, 3, 54, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 55, 56, 57, 58, 59, 3, 60, 3, 61, 3, 3, 3, 62, 63, 64, 65,
+    66, 67, 68, 69, 70, 3, 3, 71, 3, 3, 3, 4, 3, 3, 3, 3, 3, 3, 3, 3, 72, 73, 3, 74, 75, 3, 76, 3,
+    3, 3, 3, 3, 77, 3, 78, 79, 3, 3, 3, 80, 3, 3, 81, 82, 83, 84, 85, 84, 86, 87, 88, 3, 3, 3, 3, 3,
+    89, 3, 3, 3, 3, 3, 3, 3, 90, 91, 3, 3, 3, 3, 3, 92, 3, 93, 3, 94, 3, 3, 3, 3, 3, 3, 3, 3, 95, 3,
+    96, 3, 3, 3, 3, 3, 3, 3, 97, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 98, 99, 100, 3, 3, 3, 3,
+    101, 3, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 3, 3, 3, 112, 113, 114, 115, 116, 117,
+    118, 119, 113, 114, 115, 116, 117, 118, 119, 113, 114, 115, 116, 117, 118, 119, 113, 114, 115,
+    116, 117, 118, 119, 113, 114, 115, 116, 117, 118, 119, 113, 114, 115, 116, 117, 118, 119, 113,
+    114, 115, 116, 117, 118, 119, 113, 114, 115, 116, 117, 118, 119, 113, 114, 115, 116, 117, 118,
+    119, 113, 114, 115, 116, 117, 118, 119, 113, 114, 115, 116, 117, 118, 119, 113, 114, 115, 116,
+    117, 118, 119, 113, 114, 115, 116, 117, 118, 119, 113, 114, 115, 116, 117, 118, 119, 113, 114,
+    115, 116, 117, 118, 119, 113, 114, 115, 116, 117, 118, 119, 113, 114, 115, 116, 117, 118, 119,
+    113, 114, 115, 116, 117, 118, 119, 113, 114, 115, 116, 117, 118, 119, 113, 114, 115, 116, 117,
+    118, 119, 113, 114, 115, 116, 117, 118, 119, 113, 114, 115, 116, 117, 118, 119, 113, 114, 115,
+    116, 117, 118, 119, 113, 114, 115, 116, 117, 118, 119, 113, 114, 115, 116, 117, 118, 120, 121,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 122, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 123, 3, 3, 1, 3, 3,
+    99, 124, 3, 3, 3, 3, 3, 3, 3, 125, 3, 3, 3, 126, 3, 127, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 128, 3, 3, 129, 3, 3, 3, 3, 3, 3, 3, 3, 130, 3, 3, 3, 3,
+    3, 131, 3, 3, 132, 133, 3, 134, 135, 136, 137, 138, 139, 140, 141, 142, 3, 3, 143, 35, 144, 3,
+    3, 145, 146, 147, 148, 3, 3, 149, 150, 151, 152, 153, 3, 154, 3, 3, 3, 155, 3, 3, 3, 156, 157,
+    3, 158, 159, 160, 161, 3, 3, 3, 3, 3, 162, 3, 163, 3, 164, 165, 166, 3, 3, 3, 3, 167, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 168, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 169, 170, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    171, 172, 173, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 174, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 175, 176, 3, 3, 3, 3, 3, 3, 3, 177, 178, 3, 3, 179, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 180, 181, 182, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 183, 3, 3, 3, 170, 3, 3, 3, 3, 3, 184, 185, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 186, 3, 187, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 84, 84, 84, 84, 188, 189, 190, 191, 192, 193, 84,
+    84, 84, 84, 84, 194, 84, 84, 84, 84, 195, 196, 84, 84, 84, 197, 84, 84, 3, 198, 3, 199, 200,
+    201, 202, 84, 203, 204, 84, 84, 84, 84, 84, 84, 3, 3, 3, 3, 84, 84, 84, 84, 84, 84, 84, 84, 84,
+    84, 84, 84, 84, 84, 84, 195, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+};
+
+template <class T>
+const std::uint8_t _unicode_data<T>::grapheme_stage2[] = {
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 3, 3, 1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 3, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0,
+    4, 0, 4, 4, 0, 4, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 7, 7, 7, 7, 7, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 3, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 7, 0,
+    4, 4, 4, 4, 4, 4, 0, 0, 4, 4, 0, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 0, 4, 4, 4, 0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 7, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 4, 0, 8,
+    8, 8, 4, 4, 4, 4, 4, 4, 4, 4, 8, 8, 8, 8, 4, 8, 8, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4,
+    8, 8, 4, 4, 4, 4, 0, 0, 8, 8, 0, 0, 8, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+    0, 0, 4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 8,
+    8, 8, 4, 4, 0, 0, 0, 0, 4, 4, 0, 0, 4, 4, 4, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 8, 4, 4, 4, 4, 4, 0, 4, 4, 8, 0, 8, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4,
+    4, 0, 4, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4,
+    4, 8, 4, 4, 4, 4, 0, 0, 8, 8, 0, 0, 8, 8, 4, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+    8, 4, 8, 8, 0, 0, 0, 8, 8, 8, 0, 8, 8, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 8, 8, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4,
+    4, 4, 8, 8, 8, 8, 0, 4, 4, 4, 0, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 8,
+    4, 8, 8, 4, 8, 8, 0, 4, 8, 8, 0, 8, 8, 4, 4, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 4, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 4,
+    8, 8, 4, 4, 4, 4, 0, 8, 8, 8, 0, 8, 8, 8, 4, 7, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 4, 8, 8, 4, 4, 4, 0, 4, 0, 8, 8, 8, 8, 8, 8, 8,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 8, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 4, 0, 4, 0, 0, 0, 0, 8,
+    8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    8, 4, 4, 4, 4, 4, 0, 4, 4, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 8, 4, 4, 4, 4, 4, 4, 0, 4, 4, 8, 8, 4, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 4, 4, 0, 0, 0, 0, 4,
+    4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 0, 8, 4, 4, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 8, 4, 4, 4, 4, 4, 4, 4, 8, 8, 8, 8, 8, 8, 8, 8, 4, 8, 8,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 4, 4, 3, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 8, 8, 8, 8, 4, 4,
+    8, 8, 8, 0, 0, 0, 0, 8, 8, 4, 8, 8, 8, 8, 8, 8, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 8, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 4, 8, 4, 4, 4, 4, 4, 4, 4, 0, 4, 0, 4, 0, 0, 4, 4, 4, 4,
+    4, 4, 4, 4, 8, 8, 8, 8, 8, 8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 8, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 8, 4, 8, 8, 8, 8, 8, 4, 8, 8, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 8, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 4, 4, 4, 4, 8, 8, 4,
+    4, 8, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 4,
+    4, 8, 8, 8, 4, 8, 4, 4, 4, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 8,
+    8, 8, 8, 4, 4, 4, 4, 4, 4, 4, 4, 8, 8, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 8, 4, 4, 4, 4, 4, 4, 4,
+    0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 4, 0, 0, 8, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 3, 4, 5, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3,
+    3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3, 3, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 16, 16, 16, 0, 0, 0, 0, 0,
+    0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 16,
+    16, 0, 16, 16, 16, 16, 16, 16, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 16, 0, 16, 0, 0, 0, 0,
+    0, 0, 16, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 16, 0, 0, 0, 0, 16, 0, 16, 0, 0, 0, 0, 16, 16, 16, 0,
+    16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    16, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    16, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4,
+    4, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 4, 0, 0, 0, 0, 4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 4, 4, 8, 0, 0, 0, 0, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 4, 4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 0, 0, 0, 4, 4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 4, 8, 8, 4, 4, 4, 4, 8, 8, 4, 4, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4,
+    4, 4, 8, 8, 4, 4, 8, 8, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+    8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 0, 4, 4, 4, 0, 0, 4, 4, 0, 0, 0, 0, 0, 4, 4, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 4,
+    4, 8, 8, 0, 0, 0, 0, 0, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 4, 8, 8, 4, 8, 8, 0, 8,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 12, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 12, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 12, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 12, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 12, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 12, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10,
+    10, 10, 0, 0, 0, 0, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11, 11,
+    11, 11, 11, 11, 11, 11, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 4, 4, 4, 0, 4, 4, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4, 4, 4, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 4,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 4,
+    4, 4, 4, 8, 8, 4, 4, 0, 0, 7, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 8, 4, 4, 4, 4, 4, 4, 4,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8,
+    8, 8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 8, 8, 0, 7, 7, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 8, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 4, 4, 4, 8, 8,
+    4, 8, 4, 4, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 8, 8, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 8, 8, 8, 0, 0, 8, 8, 0, 0, 8, 8, 8, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 4, 4, 4, 4,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 8, 8, 8, 4, 4, 4, 4, 4, 4, 4, 4, 8, 8, 4, 4, 4, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 8, 4,
+    4, 4, 4, 4, 4, 8, 4, 8, 8, 4, 8, 4, 4, 8, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 8, 4, 4,
+    4, 4, 0, 0, 8, 8, 8, 8, 4, 4, 8, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 4,
+    4, 4, 4, 4, 4, 4, 4, 8, 8, 4, 8, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 4, 8, 8, 4, 4, 4, 4,
+    4, 4, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 4, 4, 4, 4, 8, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 8, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 8, 8,
+    8, 8, 0, 8, 8, 0, 0, 4, 4, 8, 4, 7, 8, 7, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8,
+    4, 4, 4, 4, 0, 0, 4, 4, 8, 8, 8, 8, 4, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+    4, 4, 4, 4, 4, 8, 7, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4,
+    4, 4, 4, 8, 8, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 8, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 4, 4, 4, 4,
+    4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 8, 4, 4, 4, 4, 4, 4, 4, 8, 4, 4,
+    8, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4,
+    4, 4, 4, 0, 0, 0, 4, 0, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 7, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 8, 8, 8, 0, 4, 4, 0, 8,
+    8, 4, 8, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4,
+    4, 8, 8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 3, 3,
+    3, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4,
+    4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4,
+    4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 8, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 8, 8, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 0, 3, 3, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 8, 4, 4, 4, 0, 0, 0, 8, 4, 4, 4, 4, 4, 3,
+    3, 3, 3, 3, 3, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0,
+    0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 4, 4, 0, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4,
+    4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 4, 4, 4, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 16, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 16, 16, 16,
+    16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0,
+    0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 0, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 4, 4, 4, 4, 4, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 16, 16, 16, 16, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    0, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+    16, 16, 16, 16, 16, 16, 16, 16, 16, 16,
+};
+
+} // namespace detail
+} // namespace utf8er
+
+#endif // UTF8ER_UTF8ER_UNICODE_DATA_HPP